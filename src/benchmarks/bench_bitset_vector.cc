@@ -0,0 +1,211 @@
+// Presence masks and a bloom filter on s21::bitset_vector (64 bits per word)
+// versus s21::vector<bool> (a byte per bit), both over the same bits.
+//
+// bloom insert / lookup: 3 hashed bit positions per key, random access
+// count: number of set bits
+// and: mask &= other mask
+// walk set bits: visit every set bit of a 1%-dense mask
+//
+// Usage: bench_bitset_vector [bits] [keys]   (defaults: 33554432, 4000000)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../s21_bitset_vector.h"
+#include "../s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using ByteMask = s21::vector<bool>;
+
+constexpr int kHashes = 3;
+
+double Milliseconds(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+// s21::vector<bool>(size) leaves the bytes uninitialized
+ByteMask MakeByteMask(std::size_t bits) {
+    ByteMask mask(bits);
+    std::fill(mask.data(), mask.data() + bits, false);
+    return mask;
+}
+
+std::uint64_t Mix(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Bit h of a key for a filter of bits bits (double hashing)
+std::size_t BloomBit(std::uint64_t key, int h, std::size_t bits) {
+    std::uint64_t hash = Mix(key);
+    return static_cast<std::size_t>((hash + h * (hash >> 32 | 1)) % bits);
+}
+
+void BloomInsert(s21::bitset_vector &filter, std::uint64_t key) {
+    for (int h = 0; h < kHashes; ++h) {
+        filter[BloomBit(key, h, filter.size())] = true;
+    }
+}
+
+void BloomInsert(ByteMask &filter, std::uint64_t key) {
+    for (int h = 0; h < kHashes; ++h) {
+        filter.data()[BloomBit(key, h, filter.size())] = true;
+    }
+}
+
+bool BloomContains(const s21::bitset_vector &filter, std::uint64_t key) {
+    for (int h = 0; h < kHashes; ++h) {
+        if (!filter[BloomBit(key, h, filter.size())]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BloomContains(const ByteMask &filter, std::uint64_t key) {
+    for (int h = 0; h < kHashes; ++h) {
+        if (!filter.data()[BloomBit(key, h, filter.size())]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t Count(const s21::bitset_vector &mask) {
+    return mask.count();
+}
+
+std::size_t Count(const ByteMask &mask) {
+    return static_cast<std::size_t>(
+        std::count(mask.data(), mask.data() + mask.size(), true));
+}
+
+void And(s21::bitset_vector &mask, const s21::bitset_vector &other) {
+    mask &= other;
+}
+
+void And(ByteMask &mask, const ByteMask &other) {
+    bool *dst = mask.data();
+    const bool *src = other.data();
+    for (std::size_t i = 0, n = mask.size(); i < n; ++i) {
+        dst[i] = dst[i] & src[i];
+    }
+}
+
+std::size_t WalkSetBits(const s21::bitset_vector &mask) {
+    std::size_t sum = 0;
+    for (auto i = mask.find_first(); i != mask.npos; i = mask.find_next(i)) {
+        sum += i;
+    }
+    return sum;
+}
+
+std::size_t WalkSetBits(const ByteMask &mask) {
+    std::size_t sum = 0;
+    const bool *bit = mask.data();
+    for (std::size_t i = 0, n = mask.size(); i < n; ++i) {
+        if (bit[i]) {
+            sum += i;
+        }
+    }
+    return sum;
+}
+
+void SetRandom(s21::bitset_vector &mask, std::size_t every, unsigned seed) {
+    std::mt19937_64 gen(seed);
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        mask[i] = gen() % every == 0;
+    }
+}
+
+void SetRandom(ByteMask &mask, std::size_t every, unsigned seed) {
+    std::mt19937_64 gen(seed);
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        mask.data()[i] = gen() % every == 0;
+    }
+}
+
+struct Timings {
+    double insert;
+    double lookup;
+    double count;
+    double and_;
+    double walk;
+};
+
+template <typename Mask>
+Timings Run(Mask filter, Mask dense, Mask other, Mask sparse, long keys,
+            std::size_t &checksum) {
+    Timings t{};
+    auto start = Clock::now();
+    for (long key = 0; key < keys; ++key) {
+        BloomInsert(filter, static_cast<std::uint64_t>(key));
+    }
+    t.insert = Milliseconds(start);
+
+    start = Clock::now();
+    for (long key = 0; key < keys; ++key) {
+        checksum += BloomContains(filter, static_cast<std::uint64_t>(key) * 7);
+    }
+    t.lookup = Milliseconds(start);
+
+    start = Clock::now();
+    checksum += Count(dense);
+    t.count = Milliseconds(start);
+
+    start = Clock::now();
+    And(dense, other);
+    t.and_ = Milliseconds(start);
+    checksum += Count(dense);
+
+    start = Clock::now();
+    checksum += WalkSetBits(sparse);
+    t.walk = Milliseconds(start);
+    return t;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::size_t bits = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1 << 25;
+    long keys = argc > 2 ? std::atol(argv[2]) : 4000000;
+    std::size_t checksum = 0;
+
+    s21::bitset_vector dense(bits), other(bits), sparse(bits);
+    SetRandom(dense, 2, 1);
+    SetRandom(other, 2, 2);
+    SetRandom(sparse, 100, 3);
+    ByteMask byte_dense = MakeByteMask(bits), byte_other = MakeByteMask(bits),
+             byte_sparse = MakeByteMask(bits);
+    SetRandom(byte_dense, 2, 1);
+    SetRandom(byte_other, 2, 2);
+    SetRandom(byte_sparse, 100, 3);
+
+    Timings packed = Run(s21::bitset_vector(bits), dense, other, sparse, keys,
+                         checksum);
+    Timings bytes = Run(MakeByteMask(bits), byte_dense, byte_other,
+                        byte_sparse, keys, checksum);
+
+    std::printf("bits: %zu (%zu KiB packed, %zu KiB as bytes), keys: %ld\n",
+                bits, bits / 8 / 1024, bits / 1024, keys);
+    std::printf("%16s %16s %16s\n", "operation", "bitset_vector ms",
+                "vector<bool> ms");
+    std::printf("%16s %16.1f %16.1f\n", "bloom insert", packed.insert,
+                bytes.insert);
+    std::printf("%16s %16.1f %16.1f\n", "bloom lookup", packed.lookup,
+                bytes.lookup);
+    std::printf("%16s %16.2f %16.2f\n", "count", packed.count, bytes.count);
+    std::printf("%16s %16.2f %16.2f\n", "and", packed.and_, bytes.and_);
+    std::printf("%16s %16.2f %16.2f\n", "walk set bits", packed.walk,
+                bytes.walk);
+    std::printf("(checksum %zu)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Read/write mix on s21::concurrent_map versus an s21::set guarded by a single
+// mutex, over 1..32 threads. Each operation is a lookup with probability
+// 1 - write_share, otherwise an insert or an erase of a random key.
+//
+// Usage: bench_concurrent_map [operations per thread] [write share, %]
+//        (defaults: 200000, 10)
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_map.h"
+#include "../s21_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kKeyRange = 1 << 20;
+
+template <typename Operation>
+double RunThreads(std::size_t threads, const Operation &operation) {
+    std::vector<std::thread> workers;
+    auto start = Clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&operation, t] { operation(t); });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+struct Mix {
+    std::size_t operations;
+    int write_percent;
+};
+
+template <typename Find, typename Insert, typename Erase>
+void RunMix(const Mix &mix, std::size_t seed, const Find &find,
+            const Insert &insert, const Erase &erase) {
+    std::mt19937 generator(static_cast<unsigned>(seed));
+    std::uniform_int_distribution<int> key(0, kKeyRange - 1);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (std::size_t i = 0; i < mix.operations; ++i) {
+        int roll = percent(generator);
+        if (roll >= mix.write_percent) {
+            find(key(generator));
+        } else if (roll % 2 == 0) {
+            insert(key(generator));
+        } else {
+            erase(key(generator));
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Mix mix{argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000,
+            argc > 2 ? std::atoi(argv[2]) : 10};
+    std::printf("operations per thread: %zu, writes: %d%%\n", mix.operations,
+                mix.write_percent);
+    std::printf("%8s %20s %20s\n", "threads", "mutex+set Mops/s",
+                "concurrent Mops/s");
+
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32}) {
+        std::mutex mutex;
+        s21::set<int> locked;
+        s21::concurrent_map<int, int> concurrent;
+        for (int key = 0; key < kKeyRange; key += 2) {
+            locked.insert(key);
+            concurrent.insert(key, key);
+        }
+
+        std::atomic<std::size_t> found{0};
+        double locked_time = RunThreads(threads, [&](std::size_t t) {
+            RunMix(
+                mix, t,
+                [&](int key) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    found += locked.contains(key);
+                },
+                [&](int key) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    locked.insert(key);
+                },
+                [&](int key) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto it = locked.find(key);
+                    if (it != locked.end()) {
+                        locked.erase(it);
+                    }
+                });
+        });
+
+        double concurrent_time = RunThreads(threads, [&](std::size_t t) {
+            RunMix(
+                mix, t,
+                [&](int key) { found += concurrent.contains(key); },
+                [&](int key) { concurrent.insert(key, key); },
+                [&](int key) { concurrent.erase(key); });
+        });
+
+        double total = static_cast<double>(threads * mix.operations) / 1e6;
+        std::printf("%8zu %20.2f %20.2f\n", threads, total / locked_time,
+                    total / concurrent_time);
+    }
+
+    return 0;
+}
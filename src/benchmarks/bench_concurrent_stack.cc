@@ -0,0 +1,101 @@
+// Shared free-list workload on s21::concurrent_stack (with and without the
+// elimination array) versus an s21::stack guarded by a single mutex, over
+// 1..32 threads. Every thread repeatedly takes a "buffer" from the stack (or
+// makes a new one if the stack is empty) and gives it back.
+//
+// Usage: bench_concurrent_stack [pairs per thread]   (default: 1000000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_stack.h"
+#include "../s21_stack.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// s21::stack behind a mutex, with the same interface as concurrent_stack
+class MutexStack {
+  public:
+    explicit MutexStack(std::size_t) {
+    }
+
+    void push(long value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stack_.push(value);
+    }
+
+    bool try_pop(long &value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stack_.empty()) {
+            return false;
+        }
+        value = stack_.top();
+        stack_.pop();
+        return true;
+    }
+
+  private:
+    std::mutex mutex_;
+    s21::stack<long> stack_;
+};
+
+template <typename Stack>
+double PairsMops(std::size_t threads, long pairs, std::size_t slots,
+                 long long &checksum) {
+    Stack stack(slots);
+    std::vector<long long> sums(threads);
+    std::vector<std::thread> workers;
+    auto start = Clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&stack, &sums, pairs, t] {
+            long long sum = 0;
+            for (long i = 0; i < pairs; ++i) {
+                long buffer = i;
+                if (stack.try_pop(buffer)) {
+                    sum += buffer;
+                }
+                stack.push(buffer);
+            }
+            sums[t] = sum;
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    for (long long sum : sums) {
+        checksum += sum;
+    }
+    return 2.0 * static_cast<double>(pairs) * static_cast<double>(threads) /
+           seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long pairs = argc > 1 ? std::atol(argv[1]) : 1000000;
+    long long checksum = 0;
+
+    std::printf("pop+push pairs per thread: %ld\n", pairs);
+    std::printf("%8s %20s %20s %16s\n", "threads", "elimination Mops",
+                "no elimination Mops", "mutex Mops");
+    for (std::size_t threads = 1; threads <= 32; threads *= 2) {
+        std::size_t slots = std::max<std::size_t>(threads / 2, 1);
+        double eliminating = PairsMops<s21::concurrent_stack<long>>(
+            threads, pairs, slots, checksum);
+        double plain = PairsMops<s21::concurrent_stack<long>>(threads, pairs,
+                                                              0, checksum);
+        double mutex = PairsMops<MutexStack>(threads, pairs, 0, checksum);
+        std::printf("%8zu %20.1f %20.1f %16.1f\n", threads, eliminating,
+                    plain, mutex);
+    }
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
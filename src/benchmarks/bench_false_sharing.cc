@@ -0,0 +1,91 @@
+// Per-thread counters: every thread increments only its own counter, yet with
+// the counters packed next to each other (s21::array<std::atomic<long>, N>)
+// the threads write the same cache line and it ping-pongs between cores.
+// s21::cache_padded and an s21::vector aligned to kCacheLineSize of padded
+// counters give each counter a line of its own. The gap only shows with
+// several cores; on one core the rows are equal.
+//
+// Usage: bench_false_sharing [increments per thread]   (default: 20000000)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "../s21_array.h"
+#include "../s21_cache_line.h"
+#include "../s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kMaxThreads = 16;
+
+std::atomic<long> &Counter(std::atomic<long> &counter) {
+    return counter;
+}
+
+std::atomic<long> &Counter(s21::cache_padded<std::atomic<long>> &counter) {
+    return *counter;
+}
+
+// counters: anything with data() over at least threads counters
+template <typename Counters>
+double IncrementsMops(Counters &counters, std::size_t threads,
+                      long increments, long long &checksum) {
+    auto *slots = counters.data();
+    std::vector<std::thread> workers;
+    auto start = Clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([slots, increments, t] {
+            std::atomic<long> &counter = Counter(slots[t]);
+            for (long i = 0; i < increments; ++i) {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    for (std::size_t t = 0; t < threads; ++t) {
+        checksum += Counter(slots[t]).exchange(0);
+    }
+    return static_cast<double>(increments) * static_cast<double>(threads) /
+           seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long increments = argc > 1 ? std::atol(argv[1]) : 20000000;
+    std::size_t max_threads = std::clamp<std::size_t>(
+        std::thread::hardware_concurrency(), 2, kMaxThreads);
+    long long checksum = 0;
+
+    s21::array<std::atomic<long>, kMaxThreads> packed{};
+    s21::array<s21::cache_padded<std::atomic<long>>, kMaxThreads> padded{};
+    s21::vector<s21::cache_padded<std::atomic<long>>, s21::kCacheLineSize>
+        padded_vector(kMaxThreads);
+
+    std::printf("increments per thread: %ld\n", increments);
+    std::printf("%8s %14s %14s %20s\n", "threads", "packed Mops",
+                "padded Mops", "padded vector Mops");
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        double packed_mops =
+            IncrementsMops(packed, threads, increments, checksum);
+        double padded_mops =
+            IncrementsMops(padded, threads, increments, checksum);
+        double vector_mops =
+            IncrementsMops(padded_vector, threads, increments, checksum);
+        std::printf("%8zu %14.1f %14.1f %20.1f\n", threads, packed_mops,
+                    padded_mops, vector_mops);
+    }
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,67 @@
+// s21::list::sort versus std::list::sort on sorted, reversed, random and
+// duplicate-heavy input.
+//
+// Usage: bench_list_sort [elements]   (default: 1000000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "../s21_list.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename List>
+double MeasureSort(const std::vector<int> &values) {
+    List l;
+    for (int value : values) {
+        l.push_back(value);
+    }
+    auto start = Clock::now();
+    l.sort();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    std::mt19937 generator(1);
+
+    std::vector<int> sorted(count);
+    for (int i = 0; i < count; ++i) {
+        sorted[i] = i;
+    }
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+    std::vector<int> random(count);
+    std::vector<int> duplicates(count);
+    std::uniform_int_distribution<int> any(0, count);
+    std::uniform_int_distribution<int> few(0, 15);
+    for (int i = 0; i < count; ++i) {
+        random[i] = any(generator);
+        duplicates[i] = few(generator);
+    }
+
+    struct Input {
+        const char *name;
+        const std::vector<int> *values;
+    };
+    std::printf("elements: %d\n%12s %12s %12s\n", count, "input", "s21 ms",
+                "std ms");
+    for (const Input &input : {Input{"sorted", &sorted},
+                               Input{"reversed", &reversed},
+                               Input{"random", &random},
+                               Input{"duplicates", &duplicates}}) {
+        std::printf("%12s %12.1f %12.1f\n", input.name,
+                    MeasureSort<s21::list<int>>(*input.values),
+                    MeasureSort<std::list<int>>(*input.values));
+    }
+
+    return 0;
+}
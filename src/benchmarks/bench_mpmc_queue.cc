@@ -0,0 +1,105 @@
+// Contention on s21::mpmc_queue versus an s21::queue guarded by a single
+// mutex, over 1..32 threads. Every thread repeatedly pushes one int and pops
+// one int (so the queue never runs dry for long and no thread can block
+// forever); all threads hammer both ends of the same queue.
+//
+// Usage: bench_mpmc_queue [pairs per thread]   (default: 1000000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_mpmc_queue.h"
+#include "../s21_queue.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kCapacity = 1024;
+
+// s21::queue behind a mutex, with the same blocking pop as mpmc_queue
+class MutexQueue {
+  public:
+    explicit MutexQueue(std::size_t) {
+    }
+
+    void push(int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push(value);
+    }
+
+    void pop(int &value) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!queue_.empty()) {
+                    value = queue_.front();
+                    queue_.pop();
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    std::mutex mutex_;
+    s21::queue<int> queue_;
+};
+
+template <typename Queue>
+double PairsMops(std::size_t threads, long pairs, long long &checksum) {
+    Queue q(kCapacity);
+    std::vector<long long> sums(threads);
+    std::vector<std::thread> workers;
+    auto start = Clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&q, &sums, pairs, t] {
+            long long sum = 0;
+            for (long i = 0; i < pairs; ++i) {
+                q.push(static_cast<int>(i));
+                int value;
+                q.pop(value);
+                sum += value;
+            }
+            sums[t] = sum;
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    for (long long sum : sums) {
+        checksum += sum;
+    }
+    return 2.0 * static_cast<double>(pairs) * static_cast<double>(threads) /
+           seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long pairs = argc > 1 ? std::atol(argv[1]) : 1000000;
+    long long checksum = 0;
+
+    std::printf("push+pop pairs per thread: %ld, capacity: %zu\n", pairs,
+                kCapacity);
+    std::printf("%8s %16s %16s %16s\n", "threads", "mpmc yield Mops",
+                "mpmc futex Mops", "mutex Mops");
+    for (std::size_t threads = 1; threads <= 32; threads *= 2) {
+        double yield = PairsMops<s21::mpmc_queue<int, s21::yield_wait>>(
+            threads, pairs, checksum);
+        double futex = PairsMops<s21::mpmc_queue<int, s21::futex_wait>>(
+            threads, pairs, checksum);
+        double mutex = PairsMops<MutexQueue>(threads, pairs, checksum);
+        std::printf("%8zu %16.1f %16.1f %16.1f\n", threads, yield, futex,
+                    mutex);
+    }
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Scaling of the parallel set operations (bulk build, merge, set algebra) over
+// 1/2/4/8/16 threads.
+//
+// Usage: bench_parallel_set [elements]   (default: 2000000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../s21_set.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::vector<int> RandomValues(std::size_t count, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, 1 << 30);
+    std::vector<int> values(count);
+    for (auto &value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+template <typename Function>
+double Measure(const Function &function) {
+    auto start = Clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+    std::vector<int> values1 = RandomValues(count, 1);
+    std::vector<int> values2 = RandomValues(count, 2);
+
+    std::printf("elements: %zu\n", count);
+    double sequential_insert = Measure([&] {
+        s21::set<int> s;
+        for (int value : values1) {
+            s.insert(value);
+        }
+    });
+    std::printf("baseline insert loop: %10.1f ms\n", sequential_insert);
+
+    double sequential_merge = 0;
+    {
+        s21::set<int> s1(values1.begin(), values1.end());
+        s21::set<int> s2(values2.begin(), values2.end());
+        sequential_merge = Measure([&] { s1.merge(s2); });
+    }
+    std::printf("baseline merge:       %10.1f ms\n\n", sequential_merge);
+
+    std::printf("%8s %12s %12s %12s %12s\n", "threads", "build ms", "merge ms",
+                "union ms", "intersect ms");
+    for (std::size_t threads : {1, 2, 4, 8, 16}) {
+        s21::ThreadPool pool(threads);
+        s21::parallel_policy policy(pool);
+
+        double build = Measure([&] {
+            s21::set<int> s(values1.begin(), values1.end(), policy);
+        });
+
+        s21::set<int> s1(values1.begin(), values1.end(), policy);
+        s21::set<int> s2(values2.begin(), values2.end(), policy);
+
+        double set_union =
+            Measure([&] { s21::set<int> r = s1.set_union(s2, policy); });
+        double intersection =
+            Measure([&] { s21::set<int> r = s1.set_intersection(s2, policy); });
+        double merge = Measure([&] { s1.merge(s2, policy); });
+
+        std::printf("%8zu %12.1f %12.1f %12.1f %12.1f\n", threads, build, merge,
+                    set_union, intersection);
+    }
+
+    return 0;
+}
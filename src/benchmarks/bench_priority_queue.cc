@@ -0,0 +1,200 @@
+// Scheduler-like workloads on s21::priority_queue (2/4/8-ary) versus a queue
+// built on s21::multiset (insert + erase(begin())) and std::priority_queue.
+// All queues are min-queues over int64 "deadlines".
+//
+// hold: the queue holds `size` events; each step pops the earliest one and
+//       pushes it back with a random later deadline.
+// build: `size` events pushed one by one versus one push_range (heapify).
+// decrease-key: s21::indexed_priority_queue versus multiset erase + insert;
+//       each step moves a random event earlier, every 4th step pops one.
+//
+// Usage: bench_priority_queue [size] [steps]   (defaults: 100000, 2000000)
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../s21_multiset.h"
+#include "../s21_priority_queue.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Deadline = std::int64_t;
+
+// Min-queue on top of s21::multiset: the setup s21::priority_queue replaces
+class MultisetQueue {
+  public:
+    void push(Deadline value) {
+        set_.insert(value);
+    }
+
+    Deadline top() const {
+        return *set_.begin();
+    }
+
+    void pop() {
+        set_.erase(set_.begin());
+    }
+
+  private:
+    s21::multiset<Deadline> set_;
+};
+
+template <std::size_t Arity>
+using DaryQueue = s21::priority_queue<Deadline, s21::vector<Deadline>,
+                                      std::greater<Deadline>, Arity>;
+
+using StdQueue = std::priority_queue<Deadline, std::vector<Deadline>,
+                                     std::greater<Deadline>>;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template <typename Queue>
+double HoldMops(long size, long steps, long long &checksum) {
+    std::mt19937_64 gen(42);
+    Queue q;
+    for (long i = 0; i < size; ++i) {
+        q.push(static_cast<Deadline>(gen() % 1000000));
+    }
+    auto start = Clock::now();
+    for (long i = 0; i < steps; ++i) {
+        Deadline now = q.top();
+        q.pop();
+        q.push(now + static_cast<Deadline>(gen() % 1000));
+        checksum += now;
+    }
+    return static_cast<double>(steps) / Seconds(start) / 1e6;
+}
+
+template <typename Queue>
+double BuildByPushMs(const std::vector<Deadline> &values,
+                     long long &checksum) {
+    auto start = Clock::now();
+    Queue q;
+    for (Deadline value : values) {
+        q.push(value);
+    }
+    checksum += q.top();
+    return Seconds(start) * 1e3;
+}
+
+template <std::size_t Arity>
+double BuildByRangeMs(const std::vector<Deadline> &values,
+                      long long &checksum) {
+    auto start = Clock::now();
+    DaryQueue<Arity> q;
+    q.push_range(values.begin(), values.end());
+    checksum += q.top();
+    return Seconds(start) * 1e3;
+}
+
+template <std::size_t Arity>
+double IndexedDecreaseKeyMops(long size, long steps, long long &checksum) {
+    std::mt19937_64 gen(7);
+    s21::indexed_priority_queue<Deadline, std::greater<Deadline>, Arity> q;
+    std::vector<Deadline> deadlines(size);
+    for (long i = 0; i < size; ++i) {
+        deadlines[i] = static_cast<Deadline>(gen() % 1000000000);
+        q.push(deadlines[i]);
+    }
+    auto start = Clock::now();
+    for (long i = 0; i < steps; ++i) {
+        std::size_t handle = gen() % deadlines.size();
+        if (q.contains(handle)) {
+            deadlines[handle] -= static_cast<Deadline>(gen() % 1000);
+            q.decrease_key(handle, deadlines[handle]);
+        }
+        if (i % 4 == 0) {
+            checksum += q.top();
+            std::size_t top = q.top_handle();
+            q.pop();
+            // Reinsert so the queue keeps its size (reuses the same handle)
+            deadlines[top] += 1000000;
+            q.push(deadlines[top]);
+        }
+    }
+    return static_cast<double>(steps) / Seconds(start) / 1e6;
+}
+
+double MultisetDecreaseKeyMops(long size, long steps, long long &checksum) {
+    std::mt19937_64 gen(7);
+    s21::multiset<Deadline> set;
+    std::vector<Deadline> deadlines(size);
+    std::vector<s21::multiset<Deadline>::iterator> where;
+    where.reserve(size);
+    for (long i = 0; i < size; ++i) {
+        deadlines[i] = static_cast<Deadline>(gen() % 1000000000);
+        where.push_back(set.insert(deadlines[i]));
+    }
+    auto start = Clock::now();
+    for (long i = 0; i < steps; ++i) {
+        std::size_t index = gen() % deadlines.size();
+        set.erase(where[index]);
+        deadlines[index] -= static_cast<Deadline>(gen() % 1000);
+        where[index] = set.insert(deadlines[index]);
+        if (i % 4 == 0) {
+            // Which event is the earliest is not tracked here: moving the
+            // first element back costs the same erase + insert
+            auto first = set.begin();
+            checksum += *first;
+            Deadline later = *first + 1000000;
+            set.erase(first);
+            set.insert(later);
+        }
+    }
+    return static_cast<double>(steps) / Seconds(start) / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long size = argc > 1 ? std::atol(argv[1]) : 100000;
+    long steps = argc > 2 ? std::atol(argv[2]) : 2000000;
+    long long checksum = 0;
+
+    std::printf("size: %ld, steps: %ld\n\n", size, steps);
+    std::printf("%-28s %10s\n", "hold (pop + push)", "Mops/s");
+    std::printf("%-28s %10.1f\n", "s21::multiset",
+                HoldMops<MultisetQueue>(size, steps, checksum));
+    std::printf("%-28s %10.1f\n", "s21::priority_queue 2-ary",
+                HoldMops<DaryQueue<2>>(size, steps, checksum));
+    std::printf("%-28s %10.1f\n", "s21::priority_queue 4-ary",
+                HoldMops<DaryQueue<4>>(size, steps, checksum));
+    std::printf("%-28s %10.1f\n", "s21::priority_queue 8-ary",
+                HoldMops<DaryQueue<8>>(size, steps, checksum));
+    std::printf("%-28s %10.1f\n", "std::priority_queue",
+                HoldMops<StdQueue>(size, steps, checksum));
+
+    std::mt19937_64 gen(1);
+    std::vector<Deadline> values(size);
+    for (auto &value : values) {
+        value = static_cast<Deadline>(gen());
+    }
+    std::printf("\n%-28s %10s\n", "build", "ms");
+    std::printf("%-28s %10.2f\n", "s21::multiset inserts",
+                BuildByPushMs<MultisetQueue>(values, checksum));
+    std::printf("%-28s %10.2f\n", "4-ary pushes",
+                BuildByPushMs<DaryQueue<4>>(values, checksum));
+    std::printf("%-28s %10.2f\n", "4-ary push_range",
+                BuildByRangeMs<4>(values, checksum));
+    std::printf("%-28s %10.2f\n", "2-ary push_range",
+                BuildByRangeMs<2>(values, checksum));
+
+    std::printf("\n%-28s %10s\n", "decrease-key", "Mops/s");
+    std::printf("%-28s %10.1f\n", "s21::multiset erase+insert",
+                MultisetDecreaseKeyMops(size, steps, checksum));
+    std::printf("%-28s %10.1f\n", "indexed 2-ary",
+                IndexedDecreaseKeyMops<2>(size, steps, checksum));
+    std::printf("%-28s %10.1f\n", "indexed 4-ary",
+                IndexedDecreaseKeyMops<4>(size, steps, checksum));
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,146 @@
+// Throughput of s21::queue and s21::stack over different containers.
+//
+// queue: s21::list, s21::deque and std::queue (std::deque). s21::vector has no
+// pop_front, so it cannot back a queue; it is measured as a stack instead.
+// s21::static_queue/static_stack hold a burst inline and never allocate.
+// Each run keeps the adapter at a steady depth: push a burst, pop a burst.
+// The "batched" rows move each burst with push_range() and pop_n().
+//
+// Usage: bench_queue [operations]   (default: 10000000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <queue>
+#include <stack>
+
+#include "../s21_containers.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kBurst = 64;
+
+template <typename Queue>
+double QueueMops(long operations, long long &checksum) {
+    Queue q;
+    auto start = Clock::now();
+    for (long done = 0; done < operations; done += 2 * kBurst) {
+        for (int i = 0; i < kBurst; ++i) {
+            q.push(static_cast<int>(done + i));
+        }
+        for (int i = 0; i < kBurst; ++i) {
+            checksum += q.front();
+            q.pop();
+        }
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(operations) / seconds / 1e6;
+}
+
+template <typename Stack>
+double StackMops(long operations, long long &checksum) {
+    Stack s;
+    auto start = Clock::now();
+    for (long done = 0; done < operations; done += 2 * kBurst) {
+        for (int i = 0; i < kBurst; ++i) {
+            s.push(static_cast<int>(done + i));
+        }
+        for (int i = 0; i < kBurst; ++i) {
+            checksum += s.top();
+            s.pop();
+        }
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(operations) / seconds / 1e6;
+}
+
+template <typename Queue>
+double QueueBatchedMops(long operations, long long &checksum) {
+    Queue q;
+    int burst[kBurst];
+    int out[kBurst];
+    auto start = Clock::now();
+    for (long done = 0; done < operations; done += 2 * kBurst) {
+        for (int i = 0; i < kBurst; ++i) {
+            burst[i] = static_cast<int>(done + i);
+        }
+        q.push_range(burst, burst + kBurst);
+        q.pop_n(out, kBurst);
+        checksum += std::accumulate(out, out + kBurst, 0LL);
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(operations) / seconds / 1e6;
+}
+
+template <typename Stack>
+double StackBatchedMops(long operations, long long &checksum) {
+    Stack s;
+    int burst[kBurst];
+    int out[kBurst];
+    auto start = Clock::now();
+    for (long done = 0; done < operations; done += 2 * kBurst) {
+        for (int i = 0; i < kBurst; ++i) {
+            burst[i] = static_cast<int>(done + i);
+        }
+        s.push_range(burst, burst + kBurst);
+        s.pop_n(out, kBurst);
+        checksum += std::accumulate(out, out + kBurst, 0LL);
+    }
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(operations) / seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long operations = argc > 1 ? std::atol(argv[1]) : 10000000;
+    long long checksum = 0;
+
+    std::printf("operations: %ld, burst: %d\n", operations, kBurst);
+    std::printf("%-28s %10s\n", "adapter", "Mops/s");
+    std::printf("%-28s %10.1f\n", "s21::queue<list>",
+                QueueMops<s21::queue<int, s21::list<int>>>(operations,
+                                                            checksum));
+    std::printf("%-28s %10.1f\n", "s21::queue<deque> (default)",
+                QueueMops<s21::queue<int>>(operations, checksum));
+    std::printf("%-28s %10.1f\n", "s21::queue<list> batched",
+                QueueBatchedMops<s21::queue<int, s21::list<int>>>(
+                    operations, checksum));
+    std::printf("%-28s %10.1f\n", "s21::queue<deque> batched",
+                QueueBatchedMops<s21::queue<int>>(operations, checksum));
+    std::printf("%-28s %10.1f\n", "s21::static_queue",
+                QueueMops<s21::static_queue<int, kBurst>>(operations,
+                                                         checksum));
+    std::printf("%-28s %10.1f\n", "s21::static_queue batched",
+                QueueBatchedMops<s21::static_queue<int, kBurst>>(operations,
+                                                                checksum));
+    std::printf("%-28s %10.1f\n", "std::queue<std::deque>",
+                QueueMops<std::queue<int>>(operations, checksum));
+    std::printf("%-28s %10.1f\n", "s21::stack<list>",
+                StackMops<s21::stack<int, s21::list<int>>>(operations,
+                                                            checksum));
+    std::printf("%-28s %10.1f\n", "s21::stack<vector>",
+                StackMops<s21::stack<int, s21::vector<int>>>(operations,
+                                                              checksum));
+    std::printf("%-28s %10.1f\n", "s21::stack<deque> (default)",
+                StackMops<s21::stack<int>>(operations, checksum));
+    std::printf("%-28s %10.1f\n", "s21::static_stack",
+                StackMops<s21::static_stack<int, kBurst>>(operations,
+                                                         checksum));
+    std::printf("%-28s %10.1f\n", "s21::stack<deque> batched",
+                StackBatchedMops<s21::stack<int>>(operations, checksum));
+    std::printf("%-28s %10.1f\n", "s21::static_stack batched",
+                StackBatchedMops<s21::static_stack<int, kBurst>>(operations,
+                                                                checksum));
+    std::printf("%-28s %10.1f\n", "std::stack<std::deque>",
+                StackMops<std::stack<int>>(operations, checksum));
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
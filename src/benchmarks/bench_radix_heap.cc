@@ -0,0 +1,106 @@
+// Timer workloads on s21::radix_heap versus a queue built on s21::multiset
+// (insert + erase(begin())) and s21::priority_queue. Keys are uint64
+// deadlines; nothing is ever scheduled before the current time.
+//
+// wheel: `active` timers are pending; the earliest one fires and schedules a
+//        new timer at now + random delay, until `timers` timers have fired.
+// bulk: all `timers` timers are scheduled up front, then all fire.
+//
+// Usage: bench_radix_heap [timers] [active]   (defaults: 10000000, 100000)
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+
+#include "../s21_multiset.h"
+#include "../s21_priority_queue.h"
+#include "../s21_radix_heap.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Deadline = std::uint64_t;
+
+// Min-queue on top of s21::multiset: the setup s21::radix_heap replaces
+class MultisetQueue {
+  public:
+    void push(Deadline value) {
+        set_.insert(value);
+    }
+
+    Deadline top() const {
+        return *set_.begin();
+    }
+
+    void pop() {
+        set_.erase(set_.begin());
+    }
+
+  private:
+    s21::multiset<Deadline> set_;
+};
+
+using DaryQueue = s21::priority_queue<Deadline, s21::vector<Deadline>,
+                                      std::greater<Deadline>>;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template <typename Queue>
+double WheelMops(long timers, long active, long long &checksum) {
+    std::mt19937_64 gen(42);
+    auto start = Clock::now();
+    Queue q;
+    for (long i = 0; i < active; ++i) {
+        q.push(gen() % 1000000);
+    }
+    for (long fired = 0; fired < timers; ++fired) {
+        Deadline now = q.top();
+        q.pop();
+        q.push(now + gen() % 1000000);
+        checksum += static_cast<long long>(now);
+    }
+    return static_cast<double>(timers) / Seconds(start) / 1e6;
+}
+
+template <typename Queue>
+double BulkMops(long timers, long long &checksum) {
+    std::mt19937_64 gen(7);
+    auto start = Clock::now();
+    Queue q;
+    for (long i = 0; i < timers; ++i) {
+        q.push(gen() % 1000000000);
+    }
+    for (long i = 0; i < timers; ++i) {
+        checksum += static_cast<long long>(q.top());
+        q.pop();
+    }
+    return static_cast<double>(timers) / Seconds(start) / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long timers = argc > 1 ? std::atol(argv[1]) : 10000000;
+    long active = argc > 2 ? std::atol(argv[2]) : 100000;
+    long long checksum = 0;
+
+    std::printf("timers: %ld, active: %ld\n\n", timers, active);
+    std::printf("%-28s %12s %12s\n", "Mtimers/s", "wheel", "bulk");
+    std::printf("%-28s %12.1f %12.1f\n", "s21::multiset",
+                WheelMops<MultisetQueue>(timers, active, checksum),
+                BulkMops<MultisetQueue>(timers, checksum));
+    std::printf("%-28s %12.1f %12.1f\n", "s21::priority_queue 4-ary",
+                WheelMops<DaryQueue>(timers, active, checksum),
+                BulkMops<DaryQueue>(timers, checksum));
+    std::printf("%-28s %12.1f %12.1f\n", "s21::radix_heap",
+                WheelMops<s21::radix_heap<Deadline>>(timers, active,
+                                                     checksum),
+                BulkMops<s21::radix_heap<Deadline>>(timers, checksum));
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
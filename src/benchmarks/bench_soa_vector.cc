@@ -0,0 +1,170 @@
+// Scans over 64-byte order records stored as an array of structures
+// (s21::vector<Order>) versus a structure of arrays (s21::soa_vector with
+// one column per field).
+//
+// price sum: reads one 8-byte field per record
+// filtered sum: reads price and quantity (12 of the 64 bytes)
+// full record: reads every field; there the layouts should be on par
+//
+// Usage: bench_soa_vector [records] [passes]   (defaults: 4000000, 20)
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../s21_soa_vector.h"
+#include "../s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Order {
+    std::uint64_t id;
+    double price;
+    std::int32_t quantity;
+    std::uint32_t flags;
+    std::uint64_t customer;
+    std::uint64_t created;
+    std::uint64_t updated;
+    std::uint64_t route;
+    std::uint64_t reserved;
+};
+
+static_assert(sizeof(Order) == 64);
+
+using Orders = s21::soa_vector<std::uint64_t, double, std::int32_t,
+                               std::uint32_t, std::uint64_t, std::uint64_t,
+                               std::uint64_t, std::uint64_t, std::uint64_t>;
+
+constexpr std::int32_t kMinQuantity = 50;
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// s21::vector::operator[] checks bounds, the loops go through data()
+double PriceSum(const s21::vector<Order> &orders) {
+    const Order *order = orders.data();
+    double sum = 0;
+    for (std::size_t i = 0, n = orders.size(); i < n; ++i) {
+        sum += order[i].price;
+    }
+    return sum;
+}
+
+double PriceSum(const Orders &orders) {
+    double sum = 0;
+    for (double price : orders.column<1>()) {
+        sum += price;
+    }
+    return sum;
+}
+
+double FilteredSum(const s21::vector<Order> &orders) {
+    const Order *order = orders.data();
+    double sum = 0;
+    for (std::size_t i = 0, n = orders.size(); i < n; ++i) {
+        sum += order[i].quantity >= kMinQuantity ? order[i].price : 0.0;
+    }
+    return sum;
+}
+
+double FilteredSum(const Orders &orders) {
+    const double *price = orders.data<1>();
+    const std::int32_t *quantity = orders.data<2>();
+    double sum = 0;
+    for (std::size_t i = 0, n = orders.size(); i < n; ++i) {
+        sum += quantity[i] >= kMinQuantity ? price[i] : 0.0;
+    }
+    return sum;
+}
+
+double FullRecordSum(const s21::vector<Order> &orders) {
+    const Order *order = orders.data();
+    double sum = 0;
+    for (std::size_t i = 0, n = orders.size(); i < n; ++i) {
+        const Order &o = order[i];
+        sum += static_cast<double>(o.id + o.flags + o.customer + o.created +
+                                   o.updated + o.route + o.reserved) +
+               o.price * o.quantity;
+    }
+    return sum;
+}
+
+double FullRecordSum(const Orders &orders) {
+    double sum = 0;
+    for (auto [id, price, quantity, flags, customer, created, updated, route,
+               reserved] : orders) {
+        sum += static_cast<double>(id + flags + customer + created + updated +
+                                   route + reserved) +
+               price * quantity;
+    }
+    return sum;
+}
+
+// Records scanned per second over passes passes, in millions
+template <typename Container, typename Scan>
+double ScanMrecords(const Container &orders, long passes, Scan scan,
+                    double &checksum) {
+    auto start = Clock::now();
+    for (long pass = 0; pass < passes; ++pass) {
+        checksum += scan(orders);
+    }
+    return static_cast<double>(orders.size()) * static_cast<double>(passes) /
+           Seconds(start) / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long records = argc > 1 ? std::atol(argv[1]) : 4000000;
+    long passes = argc > 2 ? std::atol(argv[2]) : 20;
+    double checksum = 0;
+
+    std::mt19937_64 gen(42);
+    s21::vector<Order> aos;
+    Orders soa;
+    aos.reserve(records);
+    soa.reserve(records);
+    for (long i = 0; i < records; ++i) {
+        Order order{static_cast<std::uint64_t>(i),
+                    static_cast<double>(gen() % 10000) / 100,
+                    static_cast<std::int32_t>(gen() % 100),
+                    static_cast<std::uint32_t>(gen() % 4),
+                    gen() % 100000,
+                    gen(),
+                    gen(),
+                    gen() % 64,
+                    0};
+        aos.push_back(order);
+        soa.emplace_back(order.id, order.price, order.quantity, order.flags,
+                         order.customer, order.created, order.updated,
+                         order.route, order.reserved);
+    }
+
+    std::printf("records: %ld, passes: %ld\n", records, passes);
+    std::printf("%14s %16s %16s\n", "scan", "AoS Mrecords/s", "SoA Mrecords/s");
+
+    auto row = [&](const char *name, auto aos_scan, auto soa_scan) {
+        double aos_rate = ScanMrecords(aos, passes, aos_scan, checksum);
+        double soa_rate = ScanMrecords(soa, passes, soa_scan, checksum);
+        std::printf("%14s %16.1f %16.1f\n", name, aos_rate, soa_rate);
+    };
+    row(
+        "price sum", [](const s21::vector<Order> &o) { return PriceSum(o); },
+        [](const Orders &o) { return PriceSum(o); });
+    row(
+        "filtered sum",
+        [](const s21::vector<Order> &o) { return FilteredSum(o); },
+        [](const Orders &o) { return FilteredSum(o); });
+    row(
+        "full record",
+        [](const s21::vector<Order> &o) { return FullRecordSum(o); },
+        [](const Orders &o) { return FullRecordSum(o); });
+
+    std::printf("(checksum %g)\n", checksum);
+    return 0;
+}
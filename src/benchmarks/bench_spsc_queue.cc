@@ -0,0 +1,219 @@
+// Producer -> consumer handoff of ints through s21::spsc_queue with each wait
+// strategy, one element at a time and in batches of kBatch (push_n/pop_n),
+// versus s21::queue guarded by a mutex. The producer is pinned to CPU 0 and the
+// consumer to CPU 1 (Linux only).
+//
+// throughput: the producer streams `operations` ints, the consumer sums them.
+// latency: round trip of one int through two queues (ping -> echo -> pong),
+// median and 99th percentile.
+//
+// Spinning needs the other side to run on its own core, so spin_wait is
+// skipped on a single-CPU machine.
+//
+// Usage: bench_spsc_queue [operations] [round trips]
+//        (defaults: 10000000, 100000)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "../s21_queue.h"
+#include "../s21_spsc_queue.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 64;
+
+void PinCurrentThread(unsigned cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % std::max(1U, std::thread::hardware_concurrency()), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+// s21::queue behind a mutex: the setup spsc_queue replaces
+class MutexQueue {
+  public:
+    explicit MutexQueue(std::size_t) {
+    }
+
+    void push(int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push(value);
+    }
+
+    void pop(int &value) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!queue_.empty()) {
+                    value = queue_.front();
+                    queue_.pop();
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    std::mutex mutex_;
+    s21::queue<int> queue_;
+};
+
+template <typename Queue>
+double ThroughputMops(long operations, long long &checksum) {
+    Queue q(kCapacity);
+    auto start = Clock::now();
+    std::thread producer([&] {
+        PinCurrentThread(0);
+        for (long i = 0; i < operations; ++i) {
+            q.push(static_cast<int>(i));
+        }
+    });
+    PinCurrentThread(1);
+    for (long i = 0; i < operations; ++i) {
+        int value;
+        q.pop(value);
+        checksum += value;
+    }
+    producer.join();
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(operations) / seconds / 1e6;
+}
+
+template <typename Queue>
+double BatchThroughputMops(long operations, long long &checksum) {
+    Queue q(kCapacity);
+    auto start = Clock::now();
+    std::thread producer([&] {
+        PinCurrentThread(0);
+        int batch[kBatch];
+        long next = 0;
+        while (next < operations) {
+            std::size_t n =
+                std::min<long>(static_cast<long>(kBatch), operations - next);
+            for (std::size_t i = 0; i < n; ++i) {
+                batch[i] = static_cast<int>(next + i);
+            }
+            std::size_t pushed = 0;
+            while (pushed < n) {
+                std::size_t done = q.push_n(batch + pushed, n - pushed);
+                if (done == 0) {
+                    std::this_thread::yield();
+                }
+                pushed += done;
+            }
+            next += static_cast<long>(n);
+        }
+    });
+    PinCurrentThread(1);
+    int batch[kBatch];
+    for (long received = 0; received < operations;) {
+        std::size_t n = q.pop_n(batch, kBatch);
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            checksum += batch[i];
+        }
+        received += static_cast<long>(n);
+    }
+    producer.join();
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(operations) / seconds / 1e6;
+}
+
+struct Latency {
+    double median_ns;
+    double p99_ns;
+};
+
+template <typename Queue>
+Latency RoundTrip(long rounds) {
+    Queue ping(kCapacity);
+    Queue pong(kCapacity);
+    std::thread echo([&] {
+        PinCurrentThread(0);
+        for (long i = 0; i < rounds; ++i) {
+            int value;
+            ping.pop(value);
+            pong.push(value);
+        }
+    });
+    PinCurrentThread(1);
+    std::vector<double> samples(rounds);
+    for (long i = 0; i < rounds; ++i) {
+        auto start = Clock::now();
+        ping.push(static_cast<int>(i));
+        int value;
+        pong.pop(value);
+        samples[i] =
+            std::chrono::duration<double, std::nano>(Clock::now() - start)
+                .count();
+    }
+    echo.join();
+    std::sort(samples.begin(), samples.end());
+    return {samples[samples.size() / 2], samples[samples.size() * 99 / 100]};
+}
+
+template <typename Queue, bool Batches = true>
+void Report(const char *name, long operations, long rounds,
+            long long &checksum) {
+    double single = ThroughputMops<Queue>(operations, checksum);
+    Latency latency = RoundTrip<Queue>(rounds);
+    if constexpr (Batches) {
+        double batched = BatchThroughputMops<Queue>(operations, checksum);
+        std::printf("%-20s %12.1f %12.1f %12.0f %12.0f\n", name, single,
+                    batched, latency.median_ns, latency.p99_ns);
+    } else {
+        std::printf("%-20s %12.1f %12s %12.0f %12.0f\n", name, single, "-",
+                    latency.median_ns, latency.p99_ns);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    long operations = argc > 1 ? std::atol(argv[1]) : 10000000;
+    long rounds = argc > 2 ? std::atol(argv[2]) : 100000;
+    long long checksum = 0;
+
+    std::printf("operations: %ld, round trips: %ld, capacity: %zu, "
+                "batch: %zu\n",
+                operations, rounds, kCapacity, kBatch);
+    std::printf("%-20s %12s %12s %12s %12s\n", "queue", "Mops/s",
+                "batch Mops/s", "rtt p50, ns", "rtt p99, ns");
+    if (std::thread::hardware_concurrency() > 1) {
+        Report<s21::spsc_queue<int, s21::spin_wait>>("spsc spin", operations,
+                                                     rounds, checksum);
+    } else {
+        std::printf("%-20s %12s\n", "spsc spin", "skipped (1 CPU)");
+    }
+    Report<s21::spsc_queue<int, s21::yield_wait>>("spsc yield", operations,
+                                                  rounds, checksum);
+    Report<s21::spsc_queue<int, s21::futex_wait>>("spsc futex", operations,
+                                                  rounds, checksum);
+    Report<MutexQueue, false>("mutex + s21::queue", operations, rounds,
+                              checksum);
+    std::printf("(checksum %lld)\n", checksum);
+    return 0;
+}
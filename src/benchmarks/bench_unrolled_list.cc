@@ -0,0 +1,126 @@
+// s21::unrolled_list versus s21::list for int elements: memory footprint,
+// push_back, full scan, and insertion/erasure in the middle through a
+// walking iterator.
+//
+// Usage: bench_unrolled_list [elements]   (default: 1000000)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "../s21_list.h"
+#include "../s21_unrolled_list.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::size_t allocated_bytes = 0;
+
+double Milliseconds(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+// s21::list::erase() ничего не возвращает
+template <typename Iterator>
+Iterator EraseAt(s21::list<int> &l, Iterator it) {
+    Iterator next = it;
+    ++next;
+    l.erase(it);
+    return next;
+}
+
+template <typename List, typename Iterator>
+Iterator EraseAt(List &l, Iterator it) {
+    return l.erase(it);
+}
+
+struct Result {
+    double bytes_per_element;
+    double push_ms;
+    double scan_ms;
+    double edit_ms;
+    long long checksum;
+};
+
+template <typename List>
+Result Measure(std::size_t count) {
+    Result result{};
+    List l;
+
+    std::size_t bytes_before = allocated_bytes;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        l.push_back(static_cast<int>(i));
+    }
+    result.push_ms = Milliseconds(start);
+    result.bytes_per_element =
+        static_cast<double>(allocated_bytes - bytes_before) /
+        static_cast<double>(count);
+
+    start = Clock::now();
+    for (int pass = 0; pass < 10; ++pass) {
+        for (int value : l) {
+            result.checksum += value;
+        }
+    }
+    result.scan_ms = Milliseconds(start);
+
+    // Каждый третий элемент удаляется, перед каждым пятым вставляется новый
+    start = Clock::now();
+    std::size_t index = 0;
+    for (auto it = l.begin(); it != l.end(); ++index) {
+        if (index % 3 == 0) {
+            it = EraseAt(l, it);
+        } else {
+            if (index % 5 == 0) {
+                it = l.insert(it, -1);
+                ++it;
+            }
+            ++it;
+        }
+    }
+    result.edit_ms = Milliseconds(start);
+    result.checksum += static_cast<long long>(l.size());
+    return result;
+}
+
+void Print(const char *name, const Result &result) {
+    std::printf("%-16s %10.1f %10.1f %10.1f %10.1f   (checksum %lld)\n", name,
+                result.bytes_per_element, result.push_ms, result.scan_ms,
+                result.edit_ms, result.checksum);
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+    allocated_bytes += size;
+    if (void *pointer = std::malloc(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+int main(int argc, char **argv) {
+    std::size_t count =
+        argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::printf("elements: %zu (bytes exclude allocator overhead)\n", count);
+    std::printf("%-16s %10s %10s %10s %10s\n", "container", "bytes/elem",
+                "push ms", "10xscan ms", "edit ms");
+
+    Print("list", Measure<s21::list<int>>(count));
+    Print("unrolled<64>", Measure<s21::unrolled_list<int, 64>>(count));
+    Print("unrolled<256>", Measure<s21::unrolled_list<int, 256>>(count));
+    Print("unrolled<1024>", Measure<s21::unrolled_list<int, 1024>>(count));
+    return 0;
+}
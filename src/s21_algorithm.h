@@ -0,0 +1,215 @@
+/**
+ * @file s21_algorithm.h
+ * @brief Sorting and searching usable in constant expressions under C++17,
+ * where std::sort, std::lower_bound and std::swap are not constexpr yet
+ *
+ * @details Intended for tables built at compile time, e.g.
+ *
+ *     constexpr auto kPorts = s21::sorted(s21::array<int, 3>{443, 22, 80});
+ *     static_assert(s21::binary_search(kPorts.begin(), kPorts.end(), 80));
+ *
+ * They work at run time too, but std::sort is better tuned there.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_ALGORITHM_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_ALGORITHM_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "s21_array.h"
+
+namespace s21 {
+
+namespace algorithm_detail {
+
+template <typename RandomIt>
+constexpr void IterSwap(RandomIt a, RandomIt b) {
+    auto tmp = std::move(*a);
+    *a = std::move(*b);
+    *b = std::move(tmp);
+}
+
+template <typename RandomIt, typename Compare>
+constexpr void InsertionSort(RandomIt first, RandomIt last, Compare &comp) {
+    if (first == last) {
+        return;
+    }
+    for (RandomIt it = first + 1; it != last; ++it) {
+        auto value = std::move(*it);
+        RandomIt hole = it;
+        for (; hole != first && comp(value, *(hole - 1)); --hole) {
+            *hole = std::move(*(hole - 1));
+        }
+        *hole = std::move(value);
+    }
+}
+
+template <typename RandomIt, typename Compare>
+constexpr void SiftDown(RandomIt first, std::ptrdiff_t index,
+                        std::ptrdiff_t size, Compare &comp) {
+    for (;;) {
+        std::ptrdiff_t child = 2 * index + 1;
+        if (child >= size) {
+            return;
+        }
+        if (child + 1 < size && comp(first[child], first[child + 1])) {
+            ++child;
+        }
+        if (!comp(first[index], first[child])) {
+            return;
+        }
+        IterSwap(first + index, first + child);
+        index = child;
+    }
+}
+
+template <typename RandomIt, typename Compare>
+constexpr void HeapSort(RandomIt first, RandomIt last, Compare &comp) {
+    std::ptrdiff_t size = last - first;
+    for (std::ptrdiff_t i = size / 2; i-- > 0;) {
+        SiftDown(first, i, size, comp);
+    }
+    for (std::ptrdiff_t end = size - 1; end > 0; --end) {
+        IterSwap(first, first + end);
+        SiftDown(first, 0, end, comp);
+    }
+}
+
+// Below this size a range is finished by insertion sort
+inline constexpr std::ptrdiff_t kInsertionSortThreshold = 16;
+
+/**
+ * @brief Introsort: quicksort with a median-of-three pivot; a range that
+ * recurses too deep falls back to heapsort, so the worst case is O(n log n)
+ */
+template <typename RandomIt, typename Compare>
+constexpr void IntroSort(RandomIt first, RandomIt last, int depth,
+                         Compare &comp) {
+    while (last - first > kInsertionSortThreshold) {
+        if (depth-- == 0) {
+            HeapSort(first, last, comp);
+            return;
+        }
+        RandomIt middle = first + (last - first) / 2;
+        // Median of first, middle, last - 1 ends up in middle
+        if (comp(*middle, *first)) {
+            IterSwap(middle, first);
+        }
+        if (comp(*(last - 1), *middle)) {
+            IterSwap(last - 1, middle);
+            if (comp(*middle, *first)) {
+                IterSwap(middle, first);
+            }
+        }
+        auto pivot = *middle;
+        RandomIt left = first;
+        RandomIt right = last - 1;
+        // Hoare partition: [first, left) <= pivot, (right, last) >= pivot
+        for (;;) {
+            while (comp(*left, pivot)) {
+                ++left;
+            }
+            while (comp(pivot, *right)) {
+                --right;
+            }
+            if (left >= right) {
+                break;
+            }
+            IterSwap(left, right);
+            ++left;
+            --right;
+        }
+        RandomIt split = right + 1;
+        // Recurse into the smaller part, loop on the larger one
+        if (split - first < last - split) {
+            IntroSort(first, split, depth, comp);
+            first = split;
+        } else {
+            IntroSort(split, last, depth, comp);
+            last = split;
+        }
+    }
+    InsertionSort(first, last, comp);
+}
+
+}  // namespace algorithm_detail
+
+/**
+ * @brief Sorts [first, last) by comp, O(n log n) in the worst case. Not
+ * stable
+ */
+template <typename RandomIt, typename Compare>
+constexpr void sort(RandomIt first, RandomIt last, Compare comp) {
+    int depth = 0;
+    for (auto size = last - first; size > 1; size /= 2) {
+        depth += 2;
+    }
+    algorithm_detail::IntroSort(first, last, depth, comp);
+}
+
+template <typename RandomIt>
+constexpr void sort(RandomIt first, RandomIt last) {
+    s21::sort(first, last, std::less<>());
+}
+
+/**
+ * @brief Returns a sorted copy of items
+ */
+template <typename T, std::size_t S, std::size_t Alignment,
+          typename Compare = std::less<>>
+constexpr array<T, S, Alignment> sorted(array<T, S, Alignment> items,
+                                        Compare comp = Compare()) {
+    s21::sort(items.begin(), items.end(), comp);
+    return items;
+}
+
+/**
+ * @brief First element of the sorted range [first, last) that is not less
+ * than value
+ */
+template <typename ForwardIt, typename T, typename Compare>
+constexpr ForwardIt lower_bound(ForwardIt first, ForwardIt last,
+                                const T &value, Compare comp) {
+    auto count = std::distance(first, last);
+    while (count > 0) {
+        auto step = count / 2;
+        ForwardIt middle = std::next(first, step);
+        if (comp(*middle, value)) {
+            first = ++middle;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+template <typename ForwardIt, typename T>
+constexpr ForwardIt lower_bound(ForwardIt first, ForwardIt last,
+                                const T &value) {
+    return s21::lower_bound(first, last, value, std::less<>());
+}
+
+/**
+ * @brief Checks if the sorted range [first, last) contains an element equal
+ * to value
+ */
+template <typename ForwardIt, typename T, typename Compare>
+constexpr bool binary_search(ForwardIt first, ForwardIt last, const T &value,
+                             Compare comp) {
+    first = s21::lower_bound(first, last, value, comp);
+    return first != last && !comp(value, *first);
+}
+
+template <typename ForwardIt, typename T>
+constexpr bool binary_search(ForwardIt first, ForwardIt last,
+                             const T &value) {
+    return s21::binary_search(first, last, value, std::less<>());
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_ALGORITHM_H_
@@ -1,19 +1,44 @@
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_ARRAY_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_ARRAY_H_
 
-#include <algorithm>
-#include <initializer_list>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
 
 /**
  * @brief s21::array - STL like std::array implementation
  *
+ * @details Like std::array, s21::array is an aggregate: it has no
+ * user-declared constructors, and the elements are its only (public) data
+ * member. It is initialized with braces, e.g. s21::array<int, 3> a{1, 2, 3}.
+ * Missing initializers value-initialize the remaining elements, and too many
+ * initializers are a compile error. Copies and moves are the implicit
+ * member-wise ones, so for a trivially copyable T the array is trivially
+ * copyable too: it can be passed in registers and copied with memcpy.
+ *
+ * Every member function is constexpr: with a literal T the array can be built,
+ * copied, filled and read in constant expressions, e.g. to generate lookup
+ * tables at compile time (see s21_algorithm.h and s21_perfect_hash.h). Out of
+ * range at() throws, which in a constant expression is a compile error.
+ *
+ * Alignment over-aligns the elements' storage, e.g. to 64 for aligned AVX-512
+ * loads; the size of the array is then rounded up to a multiple of it.
+ *
  * @tparam T containers type
  * @tparam S size of the container
+ * @tparam Alignment alignment of the storage, a power of two not below
+ * alignof(T)
  */
-template <typename T, std::size_t S>
+template <typename T, std::size_t S, std::size_t Alignment = alignof(T)>
 class array {
+    static_assert(Alignment >= alignof(T) &&
+                      (Alignment & (Alignment - 1)) == 0,
+                  "s21::array alignment must be a power of two not below "
+                  "alignof(T)");
+
   public:
     using value_type = T;
     using reference = T &;
@@ -22,89 +47,6 @@ class array {
     using const_iterator = const T *;
     using size_type = std::size_t;
 
-    // Member functions
-  public:
-    /**
-     * @brief Default constructor doesn't assign any fields because all the
-     * fields are default initialized
-     */
-    array() noexcept = default;
-
-    /**
-     * @brief initializer_list constructor
-     *
-     * @param init Elements an to initialize the array with
-     */
-    explicit array(std::initializer_list<value_type> const &items) {
-        if (items.size() != S)
-            throw std::runtime_error(
-                "s21::array::array(std::initializer_list<value_type> const "
-                "&items) "
-                "Initializer_list's size is not the same as the array's size");
-
-        for (size_type i = 0; i < S; ++i)
-            data_[i] = items.begin()[i];
-    }
-
-    /**
-     * @brief Copy constructor - copies all values from the rhs
-     *
-     * @param rhs Object to copy from
-     */
-    array(const array &rhs) noexcept {
-        for (size_type i = 0; i < S; ++i)
-            data_[i] = rhs.data_[i];
-    }
-
-    /**
-     * @brief Copy assignment - copies all the elements from the given object
-     *
-     * @param rhs Objects to copy elements from
-     * @return Results of the copy assignment
-     */
-    array &operator=(const array &rhs) noexcept {
-        for (size_type i = 0; i < S; ++i)
-            data_[i] = rhs.data_[i];
-        return *this;
-    }
-
-    /**
-     * @brief Move constructor - steals all the resources from the given object
-     *
-     * @details The default move constructor for a (non-union) class performs a
-     * member-wise move
-     * @param rhs Object to steal resources from
-     */
-    array(array &&rhs) {
-        if (this != &rhs) {
-            for (size_type i = 0; i < S; ++i)
-                data_[i] = std::move(rhs.data_[i]);
-        }
-    }
-
-    /**
-     * @brief Move assignment - steals all the resources from the given object
-     *
-     * @details The default move constructor for a (non-union) class performs a
-     * member-wise move
-     * @param rhs Objects to steal resources from
-     * @return Results of the move assignment
-     */
-    array &operator=(array &&rhs) {
-        if (this != &rhs) {
-            for (size_type i = 0; i < S; ++i)
-                data_[i] = std::move(rhs.data_[i]);
-        }
-        return *this;
-    }
-
-    /**
-     * @brief Empty constructor since the underlying array is formed on the
-     * stack
-     */
-    ~array() noexcept {
-    }
-
     // Element access
   public:
     /**
@@ -113,7 +55,7 @@ class array {
      * @param pos Index of the element to access
      * @return The element of the array at the given index
      */
-    reference at(size_type index) {
+    constexpr reference at(size_type index) {
         if (index >= S)
             throw std::out_of_range("s21::array::at The index is out of range");
 
@@ -313,14 +255,14 @@ class array {
      *
      * @param value Value to assign ot all the elemnts of the container
      */
-    void fill(const_reference value) {
+    constexpr void fill(const_reference value) {
         for (auto *itBegin = begin(), *itEnd = end(); itBegin != itEnd;
              ++itBegin)
             *itBegin = value;
     }
 
-  private:
-    value_type data_[S] = {};
+    // Public only so that the array is an aggregate, use data() instead
+    alignas(Alignment) value_type data_[S] = {};
 };
 
 }  // namespace s21
@@ -0,0 +1,761 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_BITSET_VECTOR_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_BITSET_VECTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @brief s21::bitset_vector - growable sequence of bits packed 64 to a word,
+ * a dynamically sized std::bitset
+ *
+ * @details s21::vector<bool> spends a byte per element; here a presence mask
+ * or a bloom filter takes an eighth of that. count(), find_first(),
+ * find_next() and the &=, |=, ^= operators work a word at a time, with the
+ * popcount and count-trailing-zeros instructions where the compiler exposes
+ * them.
+ *
+ * Like std::vector<bool>, operator[] and the iterators of a non-const
+ * bitset_vector yield a proxy (reference) rather than bool &, and there is no
+ * pointer to a single bit. data() exposes the words read-only: bit i is bit
+ * i % 64 of word i / 64, and the bits past size() in the last word are zero.
+ *
+ * Like s21::vector, growing may reallocate the words and invalidate
+ * references and iterators.
+ */
+class bitset_vector {
+    template <bool IsConst>
+    class BitIterator;
+
+  public:
+    using word_type = std::uint64_t;
+    using value_type = bool;
+    class reference;
+    using const_reference = bool;
+    using iterator = BitIterator<false>;
+    using const_iterator = BitIterator<true>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr size_type kWordBits =
+        std::numeric_limits<word_type>::digits;
+
+    // Returned by find_first() and find_next() when there is no set bit
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    /**
+     * @brief Proxy for one bit of a bitset_vector: converts to bool and
+     * assigns through to the bit
+     */
+    class reference {
+      public:
+        reference(const reference &) noexcept = default;
+
+        reference &operator=(bool value) noexcept {
+            if (value) {
+                *word_ |= mask_;
+            } else {
+                *word_ &= ~mask_;
+            }
+            return *this;
+        }
+
+        reference &operator=(const reference &other) noexcept {
+            return *this = static_cast<bool>(other);
+        }
+
+        operator bool() const noexcept {
+            return (*word_ & mask_) != 0;
+        }
+
+        bool operator~() const noexcept {
+            return (*word_ & mask_) == 0;
+        }
+
+        reference &flip() noexcept {
+            *word_ ^= mask_;
+            return *this;
+        }
+
+      private:
+        friend class bitset_vector;
+
+        reference(word_type *word, word_type mask) noexcept
+            : word_(word), mask_(mask) {
+        }
+
+        word_type *word_;
+        word_type mask_;
+    };
+
+    // Member functions
+  public:
+    bitset_vector() = default;
+
+    /**
+     * @brief Parameterized constructor, creates size bits equal to value
+     *
+     * @param size Number of bits
+     * @param value Value of every bit
+     */
+    explicit bitset_vector(size_type size, bool value = false) {
+        resize(size, value);
+    }
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param init Bits to initialize the bitset_vector with
+     */
+    bitset_vector(std::initializer_list<bool> const &init) {
+        reserve(init.size());
+        for (bool bit : init) {
+            push_back(bit);
+        }
+    }
+
+    // Element access
+  public:
+    /**
+     * @brief Safe access to the bits of the container
+     *
+     * @param pos Index of the bit to access
+     * @return Proxy for the bit at the given index
+     */
+    reference at(size_type pos) {
+        CheckIndex(pos, "s21::bitset_vector::at");
+        return (*this)[pos];
+    }
+
+    bool at(size_type pos) const {
+        CheckIndex(pos, "s21::bitset_vector::at");
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Unchecked access to the bits of the container
+     *
+     * @param pos Index of the bit to access
+     * @return Proxy for the bit at the given index
+     */
+    reference operator[](size_type pos) noexcept {
+        return reference(Words() + pos / kWordBits, Mask(pos));
+    }
+
+    bool operator[](size_type pos) const noexcept {
+        return (Words()[pos / kWordBits] & Mask(pos)) != 0;
+    }
+
+    /**
+     * @brief Value of the bit at pos, like std::bitset::test
+     *
+     * @throw std::out_of_range if pos >= size()
+     */
+    bool test(size_type pos) const {
+        CheckIndex(pos, "s21::bitset_vector::test");
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Access to the first bit. UB on an empty container
+     */
+    reference front() noexcept {
+        return (*this)[0];
+    }
+
+    bool front() const noexcept {
+        return (*this)[0];
+    }
+
+    /**
+     * @brief Access to the last bit. UB on an empty container
+     */
+    reference back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    bool back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    /**
+     * @brief The words holding the bits, word_count() of them
+     */
+    const word_type *data() const noexcept {
+        return Words();
+    }
+
+    [[nodiscard]] size_type word_count() const noexcept {
+        return words_.size();
+    }
+
+    // Iterators
+  public:
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    // Far below words_.max_size() * kWordBits, which may overflow
+    [[nodiscard]] size_type max_size() const noexcept {
+        return words_.max_size();
+    }
+
+    /**
+     * @brief Number of bits the container can hold without reallocating
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return words_.capacity() * kWordBits;
+    }
+
+    /**
+     * @brief Makes room for at least new_capacity bits
+     *
+     * @throw std::length_error if new_capacity exceeds max_size()
+     */
+    void reserve(size_type new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error(
+                "s21::bitset_vector::reserve() exceeds max_size()");
+        }
+        words_.reserve(WordsFor(new_capacity));
+    }
+
+    void shrink_to_fit() {
+        words_.shrink_to_fit();
+    }
+
+    // Modifiers
+  public:
+    /**
+     * @brief Removes all the bits, the words keep their memory
+     */
+    void clear() noexcept {
+        words_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Appends a bit
+     *
+     * @param value the value of the bit to append
+     */
+    void push_back(bool value) {
+        if (size_ % kWordBits == 0) {
+            words_.push_back(0);
+        }
+        if (value) {
+            Words()[size_ / kWordBits] |= Mask(size_);
+        }
+        ++size_;
+    }
+
+    /**
+     * @brief Removes the last bit
+     *
+     * @throw std::length_error on an empty container, like s21::vector
+     */
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::length_error(
+                "s21::bitset_vector::pop_back Calling pop_back on an empty "
+                "container");
+        }
+        --size_;
+        if (size_ % kWordBits == 0) {
+            words_.pop_back();
+        } else {
+            Words()[size_ / kWordBits] &= ~Mask(size_);
+        }
+    }
+
+    /**
+     * @brief Resizes the container to count bits, appending bits equal to
+     * value or removing bits from the back
+     */
+    void resize(size_type count, bool value = false) {
+        if (count <= size_) {
+            words_.pop_back_n(words_.size() - WordsFor(count));
+            size_ = count;
+            ClearTail();
+            return;
+        }
+        reserve(count);
+        if (value && size_ % kWordBits != 0) {
+            Words()[size_ / kWordBits] |= ~word_type(0) << (size_ % kWordBits);
+        }
+        for (size_type words = WordsFor(count); words_.size() < words;) {
+            words_.push_back(value ? ~word_type(0) : 0);
+        }
+        size_ = count;
+        ClearTail();
+    }
+
+    /**
+     * @brief Sets the bit at pos to value
+     *
+     * @throw std::out_of_range if pos >= size()
+     */
+    bitset_vector &set(size_type pos, bool value = true) {
+        CheckIndex(pos, "s21::bitset_vector::set");
+        (*this)[pos] = value;
+        return *this;
+    }
+
+    /**
+     * @brief Clears the bit at pos
+     *
+     * @throw std::out_of_range if pos >= size()
+     */
+    bitset_vector &reset(size_type pos) {
+        return set(pos, false);
+    }
+
+    /**
+     * @brief Inverts the bit at pos
+     *
+     * @throw std::out_of_range if pos >= size()
+     */
+    bitset_vector &flip(size_type pos) {
+        CheckIndex(pos, "s21::bitset_vector::flip");
+        (*this)[pos].flip();
+        return *this;
+    }
+
+    /**
+     * @brief Sets every bit
+     */
+    bitset_vector &set() noexcept {
+        for (size_type i = 0; i < words_.size(); ++i) {
+            Words()[i] = ~word_type(0);
+        }
+        ClearTail();
+        return *this;
+    }
+
+    /**
+     * @brief Clears every bit
+     */
+    bitset_vector &reset() noexcept {
+        for (size_type i = 0; i < words_.size(); ++i) {
+            Words()[i] = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Inverts every bit
+     */
+    bitset_vector &flip() noexcept {
+        for (size_type i = 0; i < words_.size(); ++i) {
+            Words()[i] = ~Words()[i];
+        }
+        ClearTail();
+        return *this;
+    }
+
+    void swap(bitset_vector &other) noexcept {
+        words_.swap(other.words_);
+        std::swap(size_, other.size_);
+    }
+
+    // Word-level operations
+  public:
+    /**
+     * @brief Number of set bits
+     */
+    [[nodiscard]] size_type count() const noexcept {
+        size_type count = 0;
+        for (size_type i = 0; i < words_.size(); ++i) {
+            count += PopCount(Words()[i]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Checks if every bit is set; true for an empty container
+     */
+    [[nodiscard]] bool all() const noexcept {
+        size_type full = size_ / kWordBits;
+        for (size_type i = 0; i < full; ++i) {
+            if (Words()[i] != ~word_type(0)) {
+                return false;
+            }
+        }
+        return size_ % kWordBits == 0 ||
+               Words()[full] == (word_type(1) << (size_ % kWordBits)) - 1;
+    }
+
+    /**
+     * @brief Checks if any bit is set
+     */
+    [[nodiscard]] bool any() const noexcept {
+        for (size_type i = 0; i < words_.size(); ++i) {
+            if (Words()[i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks if no bit is set
+     */
+    [[nodiscard]] bool none() const noexcept {
+        return !any();
+    }
+
+    /**
+     * @brief Index of the first set bit, npos if there is none
+     */
+    [[nodiscard]] size_type find_first() const noexcept {
+        return FindFrom(0);
+    }
+
+    /**
+     * @brief Index of the first set bit after pos, npos if there is none.
+     * With find_first() it walks the set bits:
+     *
+     *     for (auto i = bits.find_first(); i != bits.npos;
+     *          i = bits.find_next(i))
+     */
+    [[nodiscard]] size_type find_next(size_type pos) const noexcept {
+        if (pos >= size_) {
+            return npos;
+        }
+        return FindFrom(pos + 1);
+    }
+
+    /**
+     * @brief Bitwise AND, OR and XOR with a bitset_vector of the same size
+     *
+     * @throw std::invalid_argument if the sizes differ
+     */
+    bitset_vector &operator&=(const bitset_vector &other) {
+        CheckSameSize(other, "s21::bitset_vector::operator&=");
+        for (size_type i = 0; i < words_.size(); ++i) {
+            Words()[i] &= other.Words()[i];
+        }
+        return *this;
+    }
+
+    bitset_vector &operator|=(const bitset_vector &other) {
+        CheckSameSize(other, "s21::bitset_vector::operator|=");
+        for (size_type i = 0; i < words_.size(); ++i) {
+            Words()[i] |= other.Words()[i];
+        }
+        return *this;
+    }
+
+    bitset_vector &operator^=(const bitset_vector &other) {
+        CheckSameSize(other, "s21::bitset_vector::operator^=");
+        for (size_type i = 0; i < words_.size(); ++i) {
+            Words()[i] ^= other.Words()[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Copy with every bit inverted
+     */
+    bitset_vector operator~() const {
+        bitset_vector result(*this);
+        result.flip();
+        return result;
+    }
+
+    friend bool operator==(const bitset_vector &lhs,
+                           const bitset_vector &rhs) noexcept {
+        if (lhs.size_ != rhs.size_) {
+            return false;
+        }
+        // Bits past size() are zero, so whole words can be compared
+        for (size_type i = 0; i < lhs.words_.size(); ++i) {
+            if (lhs.Words()[i] != rhs.Words()[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend bool operator!=(const bitset_vector &lhs,
+                           const bitset_vector &rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+  private:
+    static constexpr size_type WordsFor(size_type bits) noexcept {
+        return (bits + kWordBits - 1) / kWordBits;
+    }
+
+    static constexpr word_type Mask(size_type pos) noexcept {
+        return word_type(1) << (pos % kWordBits);
+    }
+
+    // The loops below stay within words_.size(), so they skip the bounds
+    // check of s21::vector::operator[]
+    word_type *Words() noexcept {
+        return words_.data();
+    }
+
+    const word_type *Words() const noexcept {
+        return words_.data();
+    }
+
+    static size_type PopCount(word_type word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_type>(__builtin_popcountll(word));
+#else
+        size_type count = 0;
+        for (; word != 0; word &= word - 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Index of the lowest set bit of a non-zero word
+     */
+    static size_type CountTrailingZeros(word_type word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_type>(__builtin_ctzll(word));
+#else
+        size_type count = 0;
+        for (; (word & 1) == 0; word >>= 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Index of the first set bit at or after pos, npos if none
+     */
+    size_type FindFrom(size_type pos) const noexcept {
+        if (pos >= size_) {
+            return npos;
+        }
+        size_type i = pos / kWordBits;
+        word_type word = Words()[i] & (~word_type(0) << (pos % kWordBits));
+        while (word == 0) {
+            if (++i == words_.size()) {
+                return npos;
+            }
+            word = Words()[i];
+        }
+        return i * kWordBits + CountTrailingZeros(word);
+    }
+
+    /**
+     * @brief Zeroes the bits of the last word past size()
+     */
+    void ClearTail() noexcept {
+        if (size_ % kWordBits != 0) {
+            Words()[size_ / kWordBits] &= Mask(size_) - 1;
+        }
+    }
+
+    void CheckIndex(size_type pos, const char *where) const {
+        if (pos >= size_) {
+            throw std::out_of_range(std::string(where) +
+                                    " The index is out of range");
+        }
+    }
+
+    void CheckSameSize(const bitset_vector &other, const char *where) const {
+        if (size_ != other.size_) {
+            throw std::invalid_argument(std::string(where) +
+                                        " The sizes differ");
+        }
+    }
+
+    /**
+     * @brief Random access iterator over the bits: the container and an
+     * index. A non-const iterator dereferences to a reference proxy
+     */
+    template <bool IsConst>
+    class BitIterator {
+        using container_pointer =
+            std::conditional_t<IsConst, const bitset_vector *,
+                               bitset_vector *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference =
+            std::conditional_t<IsConst, bool, bitset_vector::reference>;
+
+        BitIterator() noexcept = default;
+
+        BitIterator(container_pointer container, size_type index) noexcept
+            : container_(container), index_(index) {
+        }
+
+        // iterator converts to const_iterator
+        template <bool OtherConst,
+                  typename = std::enable_if_t<IsConst && !OtherConst>>
+        BitIterator(const BitIterator<OtherConst> &other) noexcept
+            : container_(other.container_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*container_)[index_];
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return (*container_)[index_ + n];
+        }
+
+        BitIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BitIterator operator++(int) noexcept {
+            BitIterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        BitIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BitIterator operator--(int) noexcept {
+            BitIterator tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        BitIterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        BitIterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend BitIterator operator+(BitIterator it,
+                                     difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend BitIterator operator+(difference_type n,
+                                     BitIterator it) noexcept {
+            return it += n;
+        }
+
+        friend BitIterator operator-(BitIterator it,
+                                     difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const BitIterator &lhs,
+                                         const BitIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BitIterator &lhs,
+                               const BitIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BitIterator &lhs,
+                               const BitIterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BitIterator &lhs,
+                              const BitIterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BitIterator &lhs,
+                              const BitIterator &rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BitIterator &lhs,
+                               const BitIterator &rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BitIterator &lhs,
+                               const BitIterator &rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+      private:
+        friend class bitset_vector;
+        template <bool>
+        friend class BitIterator;
+
+        container_pointer container_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    s21::vector<word_type> words_;
+    size_type size_ = 0;
+};
+
+/**
+ * @brief Bitwise AND, OR and XOR of two bitset_vectors of the same size
+ *
+ * @throw std::invalid_argument if the sizes differ
+ */
+inline bitset_vector operator&(bitset_vector lhs, const bitset_vector &rhs) {
+    lhs &= rhs;
+    return lhs;
+}
+
+inline bitset_vector operator|(bitset_vector lhs, const bitset_vector &rhs) {
+    lhs |= rhs;
+    return lhs;
+}
+
+inline bitset_vector operator^(bitset_vector lhs, const bitset_vector &rhs) {
+    lhs ^= rhs;
+    return lhs;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_BITSET_VECTOR_H_
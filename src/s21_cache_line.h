@@ -0,0 +1,81 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_CACHE_LINE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_CACHE_LINE_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @brief Размер кэш-линии на поддерживаемых платформах (x86-64, большинство
+ * ARMv8). Данные, с которыми работают разные потоки, разносятся хотя бы на
+ * это расстояние, чтобы избежать ложного разделения (false sharing).
+ *
+ * @details std::hardware_destructive_interference_size не используется: её
+ * значение может меняться между версиями компилятора и флагами, а для
+ * библиотеки из одних заголовков это угроза совместимости ABI.
+ */
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * @brief Значение типа T, занимающее свои кэш-линии целиком: выровнено по
+ * kCacheLineSize и дополнено до кратного ему размера, поэтому соседние
+ * элементы массива никогда не делят линию. Предназначено для счетчиков
+ * потоков и других данных, которые пишут разные потоки, например
+ * s21::array<cache_padded<std::atomic<long>>, 8>.
+ *
+ * @tparam T Тип хранимого значения
+ */
+template <typename T>
+class alignas(kCacheLineSize) cache_padded {
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Создает значение инициализацией по умолчанию (value-initialization)
+     */
+    constexpr cache_padded() : value_() {
+    }
+
+    /**
+     * @brief Создает значение из аргументов arg, args
+     */
+    template <typename Arg, typename... Args,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<Arg>, cache_padded>>>
+    constexpr explicit cache_padded(Arg &&arg, Args &&...args)
+        : value_(std::forward<Arg>(arg), std::forward<Args>(args)...) {
+    }
+
+    constexpr T &get() noexcept {
+        return value_;
+    }
+
+    constexpr const T &get() const noexcept {
+        return value_;
+    }
+
+    constexpr T &operator*() noexcept {
+        return value_;
+    }
+
+    constexpr const T &operator*() const noexcept {
+        return value_;
+    }
+
+    constexpr T *operator->() noexcept {
+        return &value_;
+    }
+
+    constexpr const T *operator->() const noexcept {
+        return &value_;
+    }
+
+  private:
+    T value_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_CACHE_LINE_H_
@@ -0,0 +1,508 @@
+/**
+ * @file s21_concurrent_map.h
+ * @brief s21::concurrent_map - отсортированный ассоциативный контейнер с
+ * уникальными ключами, который можно одновременно читать и изменять из
+ * нескольких потоков.
+ *
+ * @details Контейнер реализован в виде "ленивого" списка с пропусками (lazy
+ * skip list, Herlihy, Lev, Luchangco, Shavit, "A Simple Optimistic Skiplist
+ * Algorithm"):
+ * - поиск (find(), lower_bound(), contains()) не берет блокировок и не пишет в
+ * общую память - читатели не мешают ни друг другу, ни писателям;
+ * - вставка и удаление блокируют только узлы-предшественники изменяемого узла
+ * (по мьютексу на узел), поэтому изменения в разных частях контейнера
+ * выполняются параллельно;
+ * - удаление логическое (узел помечается флагом marked_), затем узел
+ * исключается из всех уровней списка и откладывается в EpochDomain: память
+ * освобождается, когда ни один читатель уже не может на него ссылаться (см.
+ * s21_epoch.h).
+ *
+ * Т.к. элемент может быть удален сразу после того, как его нашли, методы
+ * поиска возвращают копию значения (std::optional), а не итератор или ссылку.
+ * Значения элементов после вставки не меняются.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+template <class Key, class Type, class Compare = std::less<Key>>
+class concurrent_map {
+  private:
+    struct SkipListNode;
+
+  public:
+    // Тип ключа элемента (Key — параметр шаблона)
+    using key_type = Key;
+    // Тип значения элемента (Type — параметр шаблона)
+    using mapped_type = Type;
+    // Тип данных для пары ключ-значение
+    using value_type = std::pair<const key_type, mapped_type>;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+    /**
+     * @brief Конструктор по умолчанию, создает пустой словарь
+     */
+    concurrent_map() : head_(SkipListNode::Create(kMaxLevel)) {
+    }
+
+    /**
+     * @brief Конструктор списка инициализаторов
+     *
+     * @param items Список создаваемых элементов
+     */
+    concurrent_map(std::initializer_list<value_type> const &items)
+        : concurrent_map() {
+        for (const auto &item : items) {
+            insert(item);
+        }
+    }
+
+    concurrent_map(const concurrent_map &) = delete;
+    concurrent_map &operator=(const concurrent_map &) = delete;
+
+    /**
+     * @brief Деструктор. Во время разрушения контейнер не должен
+     * использоваться другими потоками, поэтому узлы удаляются сразу
+     */
+    ~concurrent_map() {
+        SkipListNode *node = head_->next_[0].load(std::memory_order_relaxed);
+        SkipListNode::DestroyHead(head_);
+        while (node != nullptr) {
+            SkipListNode *next = node->next_[0].load(std::memory_order_relaxed);
+            SkipListNode::Destroy(node);
+            node = next;
+        }
+    }
+
+    /**
+     * @brief Ищет элемент с ключом, эквивалентным key
+     *
+     * @param key
+     * @return std::optional<mapped_type> Копия значения или std::nullopt
+     */
+    std::optional<mapped_type> find(const key_type &key) const {
+        EpochDomain::Guard guard;
+        const SkipListNode *node = FindExact(key);
+        if (node == nullptr) {
+            return std::nullopt;
+        }
+        return node->value_.second;
+    }
+
+    /**
+     * @brief Ищет первый элемент с ключом, не меньшим key
+     *
+     * @param key
+     * @return std::optional<value_type> Копия элемента или std::nullopt
+     */
+    std::optional<value_type> lower_bound(const key_type &key) const {
+        EpochDomain::Guard guard;
+        SkipListNode *pred = head_;
+        SkipListNode *curr = nullptr;
+        for (int level = kMaxLevel - 1; level >= 0; --level) {
+            curr = pred->next_[level].load(std::memory_order_acquire);
+            while (curr != nullptr && cmp_(curr->value_.first, key)) {
+                pred = curr;
+                curr = pred->next_[level].load(std::memory_order_acquire);
+            }
+        }
+        // Пропускаем удаленные и ещё не вставленные до конца узлы
+        while (curr != nullptr &&
+               (curr->marked_.load(std::memory_order_acquire) ||
+                !curr->fully_linked_.load(std::memory_order_acquire))) {
+            curr = curr->next_[0].load(std::memory_order_acquire);
+        }
+        if (curr == nullptr) {
+            return std::nullopt;
+        }
+        return curr->value_;
+    }
+
+    /**
+     * @brief Проверяет, есть ли в контейнере элемент с ключом, эквивалентным
+     * key.
+     *
+     * @param key
+     * @return true Есть
+     * @return false Нет
+     */
+    bool contains(const key_type &key) const {
+        EpochDomain::Guard guard;
+        return FindExact(key) != nullptr;
+    }
+
+    /**
+     * @brief Вставляет элемент value, если в контейнере ещё нет элемента с
+     * эквивалентным ключом
+     *
+     * @param value Значение элемента для вставки
+     * @return true вставка произошла
+     * @return false элемент с таким ключом уже есть
+     */
+    bool insert(const value_type &value) {
+        EpochDomain::Guard guard;
+        int top_level = RandomLevel();
+        SkipListNode *preds[kMaxLevel];
+        SkipListNode *succs[kMaxLevel];
+
+        while (true) {
+            int found_level = FindNode(value.first, preds, succs);
+            if (found_level != -1) {
+                SkipListNode *found = succs[found_level];
+                if (!found->marked_.load(std::memory_order_acquire)) {
+                    // Элемент уже есть - дожидаемся окончания его вставки,
+                    // чтобы после возврата false он был виден через find()
+                    while (!found->fully_linked_.load(
+                        std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                    return false;
+                }
+                // Элемент удаляется - повторяем попытку
+                continue;
+            }
+
+            std::unique_lock<std::mutex> locks[kMaxLevel];
+            if (!LockPredecessors(preds, succs, top_level, locks)) {
+                continue;
+            }
+
+            SkipListNode *node = SkipListNode::Create(top_level + 1, value);
+            for (int level = 0; level <= top_level; ++level) {
+                node->next_[level].store(succs[level],
+                                         std::memory_order_relaxed);
+            }
+            for (int level = 0; level <= top_level; ++level) {
+                preds[level]->next_[level].store(node,
+                                                 std::memory_order_release);
+            }
+            node->fully_linked_.store(true, std::memory_order_release);
+            size_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Версия insert() для пары key и obj
+     *
+     * @param key Значение ключа для вставки
+     * @param obj Значение элемента для вставки
+     * @return true вставка произошла
+     * @return false элемент с таким ключом уже есть
+     */
+    bool insert(const key_type &key, const mapped_type &obj) {
+        return insert(value_type{key, obj});
+    }
+
+    /**
+     * @brief Удаляет элемент с ключом, эквивалентным key
+     *
+     * @param key
+     * @return true элемент был удален этим вызовом
+     * @return false элемента нет (или его одновременно удалил другой поток)
+     */
+    bool erase(const key_type &key) {
+        EpochDomain::Guard guard;
+        SkipListNode *preds[kMaxLevel];
+        SkipListNode *succs[kMaxLevel];
+        SkipListNode *victim = nullptr;
+        std::unique_lock<std::mutex> victim_lock;
+        int top_level = -1;
+
+        while (true) {
+            int found_level = FindNode(key, preds, succs);
+            if (victim == nullptr) {
+                if (found_level == -1) {
+                    return false;
+                }
+                SkipListNode *candidate = succs[found_level];
+                // Удалять можно только полностью вставленный узел, найденный
+                // на своем верхнем уровне (иначе это другой, новый узел)
+                if (!candidate->fully_linked_.load(std::memory_order_acquire) ||
+                    candidate->top_level_ != found_level ||
+                    candidate->marked_.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                victim = candidate;
+                top_level = victim->top_level_;
+                victim_lock = std::unique_lock<std::mutex>(victim->mutex_);
+                if (victim->marked_.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+                // Логическое удаление: с этого момента элемента нет
+                victim->marked_.store(true, std::memory_order_release);
+            }
+
+            std::unique_lock<std::mutex> locks[kMaxLevel];
+            if (!LockPredecessors(preds, succs, top_level, locks, victim)) {
+                continue;
+            }
+
+            for (int level = top_level; level >= 0; --level) {
+                preds[level]->next_[level].store(
+                    victim->next_[level].load(std::memory_order_relaxed),
+                    std::memory_order_release);
+            }
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            victim_lock.unlock();
+            EpochDomain::Global().Retire(victim, SkipListNode::Destroy);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Возвращает количество элементов. При одновременных изменениях
+     * значение приблизительное
+     *
+     * @return size_type
+     */
+    size_type size() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Проверяет, пустой ли контейнер
+     *
+     * @return true контейнер пустой
+     * @return false в контейнере есть элементы
+     */
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+  private:
+    // Максимальное количество уровней списка. При вероятности перехода на
+    // следующий уровень 1/2 этого хватает для ~2^24 элементов
+    static constexpr int kMaxLevel = 24;
+
+    /**
+     * @brief Ищет предшественников и последователей key на каждом уровне
+     *
+     * @param key Искомый ключ
+     * @param preds Последний узел с ключом меньше key на каждом уровне
+     * @param succs Следующий за preds узел на каждом уровне
+     * @return int Самый верхний уровень, на котором найден узел с ключом key,
+     * или -1
+     */
+    int FindNode(const key_type &key, SkipListNode **preds,
+                 SkipListNode **succs) const {
+        int found_level = -1;
+        SkipListNode *pred = head_;
+        for (int level = kMaxLevel - 1; level >= 0; --level) {
+            SkipListNode *curr =
+                pred->next_[level].load(std::memory_order_acquire);
+            while (curr != nullptr && cmp_(curr->value_.first, key)) {
+                pred = curr;
+                curr = pred->next_[level].load(std::memory_order_acquire);
+            }
+            if (found_level == -1 && curr != nullptr &&
+                !cmp_(key, curr->value_.first)) {
+                found_level = level;
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return found_level;
+    }
+
+    /**
+     * @brief Поиск без блокировок: узел с ключом key, который полностью
+     * вставлен и не удален, или nullptr
+     */
+    const SkipListNode *FindExact(const key_type &key) const {
+        SkipListNode *pred = head_;
+        for (int level = kMaxLevel - 1; level >= 0; --level) {
+            SkipListNode *curr =
+                pred->next_[level].load(std::memory_order_acquire);
+            while (curr != nullptr && cmp_(curr->value_.first, key)) {
+                pred = curr;
+                curr = pred->next_[level].load(std::memory_order_acquire);
+            }
+            if (curr != nullptr && !cmp_(key, curr->value_.first)) {
+                if (curr->fully_linked_.load(std::memory_order_acquire) &&
+                    !curr->marked_.load(std::memory_order_acquire)) {
+                    return curr;
+                }
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Блокирует предшественников на уровнях 0..top_level (снизу вверх,
+     * каждый узел один раз) и проверяет, что с момента поиска ничего не
+     * изменилось: предшественник не удален и всё ещё указывает на
+     * последователя.
+     *
+     * @param victim Удаляемый узел (при удалении последователь на каждом
+     * уровне - это он сам, и он уже помечен) или nullptr при вставке
+     * @return true блокировки взяты, можно изменять ссылки
+     * @return false проверка не прошла, блокировки сняты
+     */
+    static bool LockPredecessors(SkipListNode **preds, SkipListNode **succs,
+                                 int top_level,
+                                 std::unique_lock<std::mutex> *locks,
+                                 SkipListNode *victim = nullptr) {
+        SkipListNode *previous = nullptr;
+        for (int level = 0; level <= top_level; ++level) {
+            SkipListNode *pred = preds[level];
+            SkipListNode *succ = victim != nullptr ? victim : succs[level];
+            if (pred != previous) {
+                locks[level] = std::unique_lock<std::mutex>(pred->mutex_);
+                previous = pred;
+            }
+            bool valid =
+                !pred->marked_.load(std::memory_order_acquire) &&
+                pred->next_[level].load(std::memory_order_acquire) == succ &&
+                (victim != nullptr || succ == nullptr ||
+                 !succ->marked_.load(std::memory_order_acquire));
+            if (!valid) {
+                for (int i = 0; i <= level; ++i) {
+                    if (locks[i].owns_lock()) {
+                        locks[i].unlock();
+                    }
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Случайный верхний уровень нового узла: уровень i выпадает с
+     * вероятностью 1/2^(i+1)
+     */
+    static int RandomLevel() noexcept {
+        // xorshift64 - быстрый генератор без общих данных между потоками
+        static thread_local std::uint64_t state =
+            0x9E3779B97F4A7C15ULL ^
+            reinterpret_cast<std::uintptr_t>(&state);
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        int level = 0;
+        std::uint64_t bits = state;
+        while ((bits & 1) != 0 && level < kMaxLevel - 1) {
+            ++level;
+            bits >>= 1;
+        }
+        return level;
+    }
+
+    /**
+     * @brief Узел списка с пропусками. Массив ссылок next_ размещается в той
+     * же области памяти сразу за узлом (см. Create()), чтобы при поиске не
+     * было лишнего перехода по указателю. Значение хранится в объединении:
+     * у головы списка оно не создается, поэтому Key и Type не обязаны иметь
+     * конструктор по умолчанию
+     */
+    struct SkipListNode {
+        /**
+         * @brief Создает узел с levels уровнями и значением, созданным из
+         * args. Память выделяется с выравниванием узла: значение может быть
+         * выровнено сильнее, чем гарантирует обычный operator new
+         */
+        template <typename... Args>
+        static SkipListNode *Create(int levels, Args &&...args) {
+            void *memory = ::operator new(
+                sizeof(SkipListNode) +
+                    sizeof(std::atomic<SkipListNode *>) * levels,
+                std::align_val_t(alignof(SkipListNode)));
+            SkipListNode *node;
+            try {
+                node = new (memory)
+                    SkipListNode(levels, std::forward<Args>(args)...);
+            } catch (...) {
+                ::operator delete(memory,
+                                  std::align_val_t(alignof(SkipListNode)));
+                throw;
+            }
+            return node;
+        }
+
+        /**
+         * @brief Удаляет узел с элементом, созданный Create()
+         */
+        static void Destroy(void *pointer) noexcept {
+            SkipListNode *node = static_cast<SkipListNode *>(pointer);
+            std::destroy_at(&node->value_);
+            Free(node);
+        }
+
+        /**
+         * @brief Удаляет голову списка (узел без значения)
+         */
+        static void DestroyHead(SkipListNode *head) noexcept {
+            Free(head);
+        }
+
+        /**
+         * @brief Создает голову списка: значение не создается
+         */
+        explicit SkipListNode(int levels)
+            : next_(reinterpret_cast<std::atomic<SkipListNode *> *>(this + 1)),
+              top_level_(levels - 1) {
+            for (int level = 0; level < levels; ++level) {
+                new (&next_[level]) std::atomic<SkipListNode *>(nullptr);
+            }
+        }
+
+        template <typename Arg, typename... Args>
+        SkipListNode(int levels, Arg &&arg, Args &&...args)
+            : SkipListNode(levels) {
+            ::new (static_cast<void *>(&value_))
+                value_type(std::forward<Arg>(arg), std::forward<Args>(args)...);
+        }
+
+        // Значение уничтожает Destroy(): только он знает, что оно создано
+        ~SkipListNode() {
+        }
+
+        union {
+            value_type value_;
+        };
+        // Следующие узлы на каждом уровне 0..top_level_
+        std::atomic<SkipListNode *> *next_;
+        int top_level_;
+        // Защищает ссылки next_ узла при изменении списка
+        std::mutex mutex_;
+        // Узел логически удален
+        std::atomic<bool> marked_{false};
+        // Узел вставлен на всех своих уровнях
+        std::atomic<bool> fully_linked_{false};
+
+      private:
+        static void Free(SkipListNode *node) noexcept {
+            node->~SkipListNode();
+            ::operator delete(node, std::align_val_t(alignof(SkipListNode)));
+        }
+    };
+
+    // Голова списка (есть на всех уровнях)
+    SkipListNode *head_;
+    // Количество элементов
+    std::atomic<size_type> size_{0};
+    // Компаратор ключей
+    Compare cmp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
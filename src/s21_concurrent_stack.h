@@ -0,0 +1,261 @@
+/**
+ * @file s21_concurrent_stack.h
+ * @brief s21::concurrent_stack - lock-free стек (Treiber) с массивом
+ * исключения (elimination backoff), который можно одновременно изменять из
+ * нескольких потоков.
+ *
+ * @details Стек - односвязный список, вершина меняется одним CAS.
+ *
+ * ABA: поток, прочитавший вершину A и ее next_, может успешно выполнить CAS,
+ * даже если A за это время сняли, освободили и снова положили узел по тому же
+ * адресу, - тогда в вершину попадет устаревший next_. Здесь это исключено
+ * освобождением памяти на основе эпох (см. s21_epoch.h): try_pop() работает
+ * под EpochDomain::Guard, а снятый узел не удаляется сразу, а откладывается.
+ * Пока поток закреплен, память прочитанного им узла не может быть
+ * переиспользована, поэтому адрес не может "вернуться" в вершину.
+ *
+ * Массив исключения: при неудачном CAS (вершину одновременно меняет другой
+ * поток) операция не повторяет CAS сразу, а пытается встретиться со встречной
+ * операцией в случайной ячейке массива. push() выставляет туда свой узел и
+ * недолго ждет, try_pop() забирает выставленный узел. Встретившиеся push и
+ * try_pop взаимно уничтожаются и не трогают вершину стека, поэтому при
+ * высокой конкуренции пропускная способность растет, а не падает.
+ *
+ * Размер стека не хранится: общий счетчик был бы такой же точкой
+ * конкуренции, как и вершина.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_STACK_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_STACK_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+#include "s21_epoch.h"
+#include "s21_wait_strategy.h"
+
+namespace s21 {
+template <typename T>
+class concurrent_stack {
+    static_assert(std::is_nothrow_move_assignable_v<T>,
+                  "s21::concurrent_stack requires a nothrow movable element "
+                  "type: a popped element must not be lost");
+
+  public:
+    // Тип элемента
+    using value_type = T;
+    // Тип ссылки на элемент
+    using reference = T &;
+    // Тип константной ссылки на элемент
+    using const_reference = const T &;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+    /**
+     * @brief Создает пустой стек
+     *
+     * @param elimination_slots Размер массива исключения; 0 отключает
+     * исключение. По умолчанию - половина аппаратных потоков, от 1 до
+     * kMaxEliminationSlots
+     */
+    explicit concurrent_stack(size_type elimination_slots =
+                                  DefaultEliminationSlots())
+        : slots_count_(std::min(elimination_slots, kMaxEliminationSlots)),
+          slots_(slots_count_ == 0 ? nullptr : new Slot[slots_count_]) {
+    }
+
+    concurrent_stack(const concurrent_stack &) = delete;
+    concurrent_stack &operator=(const concurrent_stack &) = delete;
+
+    /**
+     * @brief Деструктор. Во время разрушения стек не должен использоваться
+     * другими потоками, поэтому узлы удаляются сразу
+     */
+    ~concurrent_stack() {
+        StackNode *node = head_.load(std::memory_order_relaxed);
+        while (node != nullptr) {
+            StackNode *next = node->next_;
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @brief Проверяет, пуст ли стек. Результат может устареть сразу после
+     * вызова
+     */
+    bool empty() const noexcept {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /**
+     * @brief Кладет копию value на вершину стека
+     */
+    void push(const_reference value) {
+        emplace(value);
+    }
+
+    void push(value_type &&value) {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Создает элемент из args на вершине стека
+     */
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        StackNode *node = new StackNode(std::forward<Args>(args)...);
+        StackNode *head = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            node->next_ = head;
+            if (head_.compare_exchange_weak(head, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+                return;
+            }
+            if (EliminatePush(node)) {
+                return;
+            }
+            head = head_.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Снимает элемент с вершины стека и переносит его в value
+     *
+     * @return false Стек пуст, value не изменен
+     */
+    bool try_pop(reference value) {
+        EpochDomain::Guard guard;
+        StackNode *head = head_.load(std::memory_order_acquire);
+        for (;;) {
+            if (head == nullptr) {
+                return false;
+            }
+            if (head_.compare_exchange_weak(head, head->next_,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+                value = std::move(head->value_);
+                // Другие потоки могли прочитать head до CAS
+                EpochDomain::Global().Retire(head);
+                return true;
+            }
+            if (StackNode *node = EliminatePop()) {
+                value = std::move(node->value_);
+                // Выставленный узел никогда не был в стеке, и никто, кроме
+                // забравшего его потока, к нему не обращается
+                delete node;
+                return true;
+            }
+            head = head_.load(std::memory_order_acquire);
+        }
+    }
+
+  private:
+    // Максимальный размер массива исключения
+    static constexpr size_type kMaxEliminationSlots = 16;
+    // Сколько итераций push() ждет встречный try_pop() в ячейке
+    static constexpr int kEliminationSpins = 64;
+
+    struct StackNode {
+        template <typename... Args>
+        explicit StackNode(Args &&...args)
+            : value_(std::forward<Args>(args)...) {
+        }
+
+        value_type value_;
+        // Следующий узел. Не меняется после публикации узла в стеке
+        StackNode *next_ = nullptr;
+    };
+
+    // Ячейка массива исключения: узел, выставленный push(), или nullptr
+    struct alignas(kCacheLineSize) Slot {
+        std::atomic<StackNode *> offer_{nullptr};
+    };
+
+    static size_type DefaultEliminationSlots() noexcept {
+        size_type threads = std::thread::hardware_concurrency();
+        return std::clamp<size_type>(threads / 2, 1, kMaxEliminationSlots);
+    }
+
+    /**
+     * @brief Случайная ячейка массива исключения (у каждого потока свой
+     * генератор, чтобы потоки расходились по разным ячейкам)
+     */
+    Slot &RandomSlot() noexcept {
+        // xorshift64 - быстрый генератор без общих данных между потоками
+        static thread_local std::uint64_t state =
+            0x9E3779B97F4A7C15ULL ^
+            reinterpret_cast<std::uintptr_t>(&state);
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return slots_[state % slots_count_];
+    }
+
+    /**
+     * @brief Выставляет node в случайную ячейку и ждет встречный try_pop()
+     *
+     * @return true Узел забран, push() завершен
+     */
+    bool EliminatePush(StackNode *node) noexcept {
+        if (slots_count_ == 0) {
+            return false;
+        }
+        Slot &slot = RandomSlot();
+        StackNode *expected = nullptr;
+        if (!slot.offer_.compare_exchange_strong(expected, node,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+            return false;
+        }
+        for (int i = 0; i < kEliminationSpins; ++i) {
+            if (slot.offer_.load(std::memory_order_relaxed) != node) {
+                return true;
+            }
+            CpuRelax();
+        }
+        // Забираем предложение назад; если не вышло - узел уже забран
+        expected = node;
+        return !slot.offer_.compare_exchange_strong(expected, nullptr,
+                                                    std::memory_order_relaxed,
+                                                    std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Забирает узел, выставленный push() в случайной ячейке
+     *
+     * @return StackNode* Забранный узел или nullptr
+     */
+    StackNode *EliminatePop() noexcept {
+        if (slots_count_ == 0) {
+            return nullptr;
+        }
+        Slot &slot = RandomSlot();
+        StackNode *offer = slot.offer_.load(std::memory_order_relaxed);
+        if (offer != nullptr &&
+            slot.offer_.compare_exchange_strong(offer, nullptr,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+            return offer;
+        }
+        return nullptr;
+    }
+
+    // Вершина стека
+    alignas(kCacheLineSize) std::atomic<StackNode *> head_{nullptr};
+    // Размер массива исключения
+    alignas(kCacheLineSize) const size_type slots_count_;
+    // Массив исключения
+    const std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_STACK_H_
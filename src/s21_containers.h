@@ -1,4 +1,15 @@
 #include "s21_array.h"
+#include "s21_bitset_vector.h"
+#include "s21_deque.h"
+#include "s21_list.h"
+#include "s21_perfect_hash.h"
+#include "s21_priority_queue.h"
 #include "s21_queue.h"
+#include "s21_radix_heap.h"
+#include "s21_soa_vector.h"
+#include "s21_stable_vector.h"
 #include "s21_stack.h"
+#include "s21_unrolled_list.h"
+#include "s21_static_queue.h"
+#include "s21_static_stack.h"
 #include "s21_vector.h"
@@ -0,0 +1,608 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_DEQUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_DEQUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @brief s21::deque - double-ended queue on top of a growable ring buffer
+ *
+ * @details Elements live in a single power-of-two buffer that wraps around,
+ * so push/pop at either end is amortized O(1) and never allocates until the
+ * buffer is full; then it doubles. Random access is an add and a mask.
+ *
+ * Unlike std::deque, growing the buffer moves the elements, so any push may
+ * invalidate references and iterators (like s21::vector). Pops invalidate
+ * only the removed element.
+ *
+ * @tparam T containers type
+ */
+template <typename T>
+class deque {
+    template <bool IsConst>
+    class DequeIterator;
+
+  public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = DequeIterator<false>;
+    using const_iterator = DequeIterator<true>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // Member functions
+  public:
+    /**
+     * @brief Default constructor, doesn't allocate. The other constructors
+     * delegate to it, so if they throw, the destructor destroys the elements
+     * built so far and frees the buffer
+     */
+    deque() noexcept {
+    }
+
+    /**
+     * @brief Parameterized constructor, creates a deque of a given size with
+     * value-initialized elements
+     *
+     * @param size Size of the deque
+     */
+    explicit deque(size_type size) : deque() {
+        reserve(size);
+        while (size_ < size) {
+            ::new (static_cast<void *>(Slot(size_))) value_type();
+            ++size_;
+        }
+    }
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param init Elements to initialize the deque with
+     */
+    deque(std::initializer_list<value_type> const &init) : deque() {
+        reserve(init.size());
+        for (const auto &item : init) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Copy constructor - copies all values from the rhs
+     *
+     * @param rhs Object to copy from
+     */
+    deque(const deque &rhs) : deque() {
+        reserve(rhs.size_);
+        for (const auto &item : rhs) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Move constructor - steals all the resources from the given object
+     *
+     * @param rhs Object to steal resources from
+     */
+    deque(deque &&rhs) noexcept
+        : buffer_(std::exchange(rhs.buffer_, nullptr)),
+          capacity_(std::exchange(rhs.capacity_, 0)),
+          head_(std::exchange(rhs.head_, 0)),
+          size_(std::exchange(rhs.size_, 0)) {
+    }
+
+    /**
+     * @brief Destructor - destroys the elements and frees the buffer
+     */
+    ~deque() {
+        clear();
+        Deallocate(buffer_);
+    }
+
+    /**
+     * @brief Copy assignment - copies all the elements from the given object
+     *
+     * @param rhs Objects to copy elements from
+     * @return Results of the copy assignment
+     */
+    deque &operator=(const deque &rhs) {
+        if (this != &rhs) {
+            deque copy(rhs);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment - steals all the resources from the given object
+     *
+     * @param rhs Objects to steal resources from
+     * @return Results of the move assignment
+     */
+    deque &operator=(deque &&rhs) noexcept {
+        if (this != &rhs) {
+            deque moved(std::move(rhs));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    // Element Access
+  public:
+    /**
+     * @brief Safe access to the elements of the container
+     *
+     * @param pos Index of the element to access
+     * @return The element at the given index
+     */
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Unchecked access to the elements of the container
+     *
+     * @param pos Index of the element to access
+     * @return The element at the given index
+     */
+    reference operator[](size_type pos) noexcept {
+        return *Slot(pos);
+    }
+
+    const_reference operator[](size_type pos) const noexcept {
+        return *Slot(pos);
+    }
+
+    /**
+     * @brief Access to the first element. UB on an empty deque
+     */
+    reference front() noexcept {
+        return *Slot(0);
+    }
+
+    const_reference front() const noexcept {
+        return *Slot(0);
+    }
+
+    /**
+     * @brief Access to the last element. UB on an empty deque
+     */
+    reference back() noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    const_reference back() const noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    // Iterators
+  public:
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() /
+               sizeof(value_type);
+    }
+
+    /**
+     * @brief Number of elements the deque can hold without reallocating
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Grows the buffer to hold at least new_capacity elements. The
+     * capacity is always rounded up to a power of two
+     *
+     * @param new_capacity
+     */
+    void reserve(size_type new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error("deque::reserve() exceeds max_size()");
+        }
+        if (new_capacity > capacity_) {
+            Reallocate(RoundUpToPowerOfTwo(new_capacity));
+        }
+    }
+
+    // Modifiers
+  public:
+    /**
+     * @brief Destroys all elements, keeps the buffer
+     */
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < size_; ++i) {
+                Slot(i)->~value_type();
+            }
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+    void push_back(const_reference value) {
+        EmplaceOne(false, value);
+    }
+
+    void push_back(value_type &&value) {
+        EmplaceOne(false, std::move(value));
+    }
+
+    void push_front(const_reference value) {
+        EmplaceOne(true, value);
+    }
+
+    void push_front(value_type &&value) {
+        EmplaceOne(true, std::move(value));
+    }
+
+    /**
+     * @brief Removes the last element. UB on an empty deque
+     */
+    void pop_back() noexcept {
+        --size_;
+        Slot(size_)->~value_type();
+    }
+
+    /**
+     * @brief Removes the first element. UB on an empty deque
+     */
+    void pop_front() noexcept {
+        Slot(0)->~value_type();
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+
+    /**
+     * @brief Appends an element constructed in place from args
+     *
+     * @param args arguments to forward to the constructor of the element
+     * @return Reference to the new element
+     */
+    template <typename... Args>
+    reference emplace_back(Args &&...args) {
+        EmplaceOne(false, std::forward<Args>(args)...);
+        return *Slot(size_ - 1);
+    }
+
+    /**
+     * @brief Prepends an element constructed in place from args
+     *
+     * @param args arguments to forward to the constructor of the element
+     * @return Reference to the new element
+     */
+    template <typename... Args>
+    reference emplace_front(Args &&...args) {
+        EmplaceOne(true, std::forward<Args>(args)...);
+        return *Slot(0);
+    }
+
+    /**
+     * @brief Appends the elements of [first, last). With forward iterators
+     * the buffer grows at most once
+     *
+     * @param first, last Range of elements to append
+     */
+    template <typename InputIt>
+    void append_range(InputIt first, InputIt last) {
+        using category =
+            typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        category>) {
+            auto count = static_cast<size_type>(std::distance(first, last));
+            reserve(size_ + count);
+            // No capacity check per element: the room is already there
+            for (; first != last; ++first) {
+                ::new (static_cast<void *>(Slot(size_))) value_type(*first);
+                ++size_;
+            }
+        } else {
+            for (; first != last; ++first) {
+                EmplaceOne(false, *first);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the first count elements at once. UB if count > size()
+     */
+    void pop_front_n(size_type count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < count; ++i) {
+                Slot(i)->~value_type();
+            }
+        }
+        if (count != 0) {
+            head_ = (head_ + count) & (capacity_ - 1);
+            size_ -= count;
+        }
+    }
+
+    /**
+     * @brief Removes the last count elements at once. UB if count > size()
+     */
+    void pop_back_n(size_type count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = size_ - count; i < size_; ++i) {
+                Slot(i)->~value_type();
+            }
+        }
+        size_ -= count;
+    }
+
+    /**
+     * @brief Swaps the contents of two deques
+     *
+     * @param other
+     */
+    void swap(deque &other) noexcept {
+        std::swap(buffer_, other.buffer_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+  private:
+    static constexpr size_type kMinCapacity = 8;
+
+    static size_type RoundUpToPowerOfTwo(size_type value) noexcept {
+        size_type result = kMinCapacity;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    value_type *Slot(size_type pos) const noexcept {
+        return buffer_ + ((head_ + pos) & (capacity_ - 1));
+    }
+
+    /**
+     * @brief Constructs one element from args at the front or at the back,
+     * doubling the buffer when it is full. The value is built before
+     * reallocating, since args may refer to an element of this deque
+     */
+    template <typename... Args>
+    void EmplaceOne(bool at_front, Args &&...args) {
+        if (size_ == capacity_) {
+            value_type value(std::forward<Args>(args)...);
+            Reallocate(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
+            EmplaceOne(at_front, std::move(value));
+            return;
+        }
+        if (at_front) {
+            size_type slot = (head_ + capacity_ - 1) & (capacity_ - 1);
+            ::new (static_cast<void *>(buffer_ + slot))
+                value_type(std::forward<Args>(args)...);
+            head_ = slot;
+        } else {
+            ::new (static_cast<void *>(Slot(size_)))
+                value_type(std::forward<Args>(args)...);
+        }
+        ++size_;
+    }
+
+    /**
+     * @brief Frees a buffer allocated by Reallocate(), which honours
+     * alignof(value_type)
+     */
+    static void Deallocate(value_type *buffer) noexcept {
+        ::operator delete(buffer, std::align_val_t(alignof(value_type)));
+    }
+
+    /**
+     * @brief Moves the elements into a new buffer of new_capacity elements,
+     * unwrapping them to start at index 0. Strong guarantee if the move
+     * constructor doesn't throw or the type is copyable
+     */
+    void Reallocate(size_type new_capacity) {
+        value_type *buffer = static_cast<value_type *>(
+            ::operator new(new_capacity * sizeof(value_type),
+                           std::align_val_t(alignof(value_type))));
+        size_type moved = 0;
+        try {
+            for (; moved < size_; ++moved) {
+                ::new (static_cast<void *>(buffer + moved))
+                    value_type(std::move_if_noexcept(*Slot(moved)));
+            }
+        } catch (...) {
+            for (size_type i = 0; i < moved; ++i) {
+                buffer[i].~value_type();
+            }
+            Deallocate(buffer);
+            throw;
+        }
+
+        size_type size = size_;
+        clear();
+        Deallocate(buffer_);
+        buffer_ = buffer;
+        capacity_ = new_capacity;
+        size_ = size;
+    }
+
+    /**
+     * @brief Random access iterator: the deque and a logical index
+     */
+    template <bool IsConst>
+    class DequeIterator {
+        using container_pointer =
+            std::conditional_t<IsConst, const deque *, deque *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        DequeIterator() noexcept = default;
+
+        DequeIterator(container_pointer container, size_type index) noexcept
+            : container_(container), index_(index) {
+        }
+
+        // iterator converts to const_iterator
+        template <bool OtherConst,
+                  typename = std::enable_if_t<IsConst && !OtherConst>>
+        DequeIterator(const DequeIterator<OtherConst> &other) noexcept
+            : container_(other.container_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return *container_->Slot(index_);
+        }
+
+        pointer operator->() const noexcept {
+            return container_->Slot(index_);
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *container_->Slot(index_ + n);
+        }
+
+        DequeIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        DequeIterator operator++(int) noexcept {
+            DequeIterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        DequeIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        DequeIterator operator--(int) noexcept {
+            DequeIterator tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        DequeIterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        DequeIterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend DequeIterator operator+(DequeIterator it,
+                                       difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend DequeIterator operator+(difference_type n,
+                                       DequeIterator it) noexcept {
+            return it += n;
+        }
+
+        friend DequeIterator operator-(DequeIterator it,
+                                       difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const DequeIterator &lhs,
+                                         const DequeIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const DequeIterator &lhs,
+                               const DequeIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const DequeIterator &lhs,
+                               const DequeIterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const DequeIterator &lhs,
+                              const DequeIterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const DequeIterator &lhs,
+                              const DequeIterator &rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const DequeIterator &lhs,
+                               const DequeIterator &rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const DequeIterator &lhs,
+                               const DequeIterator &rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+      private:
+        friend class deque;
+        template <bool>
+        friend class DequeIterator;
+
+        container_pointer container_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    value_type *buffer_ = nullptr;
+    size_type capacity_ = 0;
+    size_type head_ = 0;
+    size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_DEQUE_H_
@@ -0,0 +1,310 @@
+/**
+ * @file s21_epoch.h
+ * @brief Освобождение памяти на основе эпох (epoch-based reclamation) для
+ * конкурентных контейнеров библиотеки.
+ *
+ * @details Конкурентный контейнер не может сразу удалить узел, исключенный из
+ * структуры: другие потоки могли прочитать указатель на него до исключения и
+ * всё ещё его читать. Поэтому узел "откладывается" (Retire()) и удаляется
+ * позже, когда ни один поток гарантированно не может на него ссылаться.
+ *
+ * Схема работы:
+ * - есть глобальный счетчик эпох;
+ * - перед обращением к структуре поток "закрепляется" (Guard) в текущей
+ * глобальной эпохе и открепляется после окончания операции;
+ * - глобальная эпоха увеличивается с e на e + 1, только если все
+ * закрепленные потоки находятся в эпохе e;
+ * - отложенный в эпохе e объект удаляется, когда глобальная эпоха становится
+ * не меньше e + 2: к этому моменту все потоки, которые могли видеть объект,
+ * уже открепились.
+ *
+ * У каждого потока есть своя запись (ThreadRecord) с тремя "корзинами"
+ * отложенных объектов - по одной на эпохи e, e + 1 и e + 2 (по модулю 3).
+ * Корзины завершившихся потоков переходят в общий список "сирот" и удаляются
+ * любым потоком, вызвавшим Collect().
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_EPOCH_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+class EpochDomain {
+  public:
+    // Тип номера эпохи
+    using epoch_type = std::uint64_t;
+    // Функция удаления отложенного объекта
+    using deleter_type = void (*)(void *);
+
+    /**
+     * @brief Глобальный домен эпох, общий для всех контейнеров.
+     * @details Домен намеренно не удаляется: потоки могут завершаться и
+     * откладывать объекты в любой момент, в том числе во время разрушения
+     * статических объектов.
+     *
+     * @return EpochDomain&
+     */
+    static EpochDomain &Global() {
+        static EpochDomain *domain = new EpochDomain;
+        return *domain;
+    }
+
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain &operator=(const EpochDomain &) = delete;
+
+    /**
+     * @brief RAII-закрепление текущего потока в глобальном домене. Пока
+     * объект Guard жив, ни один объект, доступный потоку на момент
+     * закрепления, не будет удален. Закрепления могут быть вложенными.
+     */
+    class Guard {
+      public:
+        Guard() : domain_(Global()), record_(domain_.Pin()) {
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+        ~Guard() {
+            domain_.Unpin(record_);
+        }
+
+      private:
+        EpochDomain &domain_;
+        void *record_;
+    };
+
+    /**
+     * @brief Откладывает удаление объекта, созданного через new
+     *
+     * @tparam T Тип объекта
+     * @param object Объект, уже исключенный из конкурентной структуры
+     */
+    template <typename T>
+    void Retire(T *object) {
+        Retire(object, [](void *pointer) { delete static_cast<T *>(pointer); });
+    }
+
+    /**
+     * @brief Откладывает вызов deleter(object) до момента, когда object
+     * гарантированно не используется другими потоками.
+     * @details Раз в kCollectThreshold вызовов автоматически выполняется
+     * Collect()
+     *
+     * @param object Объект, уже исключенный из конкурентной структуры
+     * @param deleter Функция удаления
+     */
+    void Retire(void *object, deleter_type deleter) {
+        ThreadRecord *record = LocalRecord();
+        epoch_type epoch = global_epoch_.load(std::memory_order_seq_cst);
+        Bag &bag = record->bags_[epoch % 3];
+        if (bag.epoch_ != epoch) {
+            // В корзине объекты эпохи не позже epoch - 3, их уже можно удалить
+            FreeObjects(bag.objects_);
+            bag.epoch_ = epoch;
+        }
+        bag.objects_.push_back({object, deleter});
+
+        if (++record->retired_since_collect_ >= kCollectThreshold) {
+            Collect();
+        }
+    }
+
+    /**
+     * @brief Пытается увеличить глобальную эпоху и удаляет все отложенные
+     * объекты текущего потока и завершившихся потоков, которые уже можно
+     * удалить.
+     */
+    void Collect() {
+        TryAdvance();
+        epoch_type epoch = global_epoch_.load(std::memory_order_seq_cst);
+
+        ThreadRecord *record = LocalRecord();
+        record->retired_since_collect_ = 0;
+        for (Bag &bag : record->bags_) {
+            if (bag.epoch_ + 2 <= epoch) {
+                FreeObjects(bag.objects_);
+            }
+        }
+
+        std::vector<Bag> ready;
+        {
+            std::lock_guard<std::mutex> lock(orphans_mutex_);
+            for (std::size_t i = 0; i < orphans_.size();) {
+                if (orphans_[i].epoch_ + 2 <= epoch) {
+                    ready.push_back(std::move(orphans_[i]));
+                    orphans_[i] = std::move(orphans_.back());
+                    orphans_.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+        }
+        // Удаляем без блокировки - деструкторы объектов могут быть долгими
+        for (Bag &bag : ready) {
+            FreeObjects(bag.objects_);
+        }
+    }
+
+  private:
+    // Каждые kCollectThreshold отложенных объектов поток вызывает Collect()
+    static constexpr std::size_t kCollectThreshold = 128;
+
+    // Отложенный объект
+    struct Retired {
+        void *object_;
+        deleter_type deleter_;
+    };
+
+    // Объекты, отложенные потоком в эпохе epoch_
+    struct Bag {
+        epoch_type epoch_ = 0;
+        std::vector<Retired> objects_;
+    };
+
+    // Запись потока. Выравнивается по кэш-линии, т.к. state_ часто пишется
+    // своим потоком и читается остальными в TryAdvance()
+    struct alignas(kCacheLineSize) ThreadRecord {
+        // (эпоха << 1) | 1, если поток закреплен, иначе 0
+        std::atomic<epoch_type> state_{0};
+        // Запись принадлежит живому потоку
+        std::atomic<bool> in_use_{true};
+        // Глубина вложенных закреплений
+        std::size_t nesting_ = 0;
+        std::size_t retired_since_collect_ = 0;
+        Bag bags_[3];
+        // Следующая запись в списке домена (не меняется после публикации)
+        ThreadRecord *next_ = nullptr;
+    };
+
+    // Возвращает запись завершившегося потока в домен
+    struct RecordHolder {
+        ~RecordHolder() {
+            if (record_ != nullptr) {
+                Global().Release(record_);
+            }
+        }
+
+        ThreadRecord *record_ = nullptr;
+    };
+
+    EpochDomain() = default;
+
+    /**
+     * @brief Запись текущего потока. Создается (или берется освободившаяся)
+     * при первом обращении потока к домену
+     */
+    ThreadRecord *LocalRecord() {
+        static thread_local RecordHolder holder;
+        if (holder.record_ == nullptr) {
+            holder.record_ = Acquire();
+        }
+        return holder.record_;
+    }
+
+    ThreadRecord *Acquire() {
+        for (ThreadRecord *record = records_.load(std::memory_order_acquire);
+             record != nullptr; record = record->next_) {
+            bool expected = false;
+            if (record->in_use_.compare_exchange_strong(
+                    expected, true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+
+        ThreadRecord *record = new ThreadRecord;
+        record->next_ = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(record->next_, record,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+        return record;
+    }
+
+    /**
+     * @brief Отдает непустые корзины потока в список сирот и освобождает
+     * запись для повторного использования
+     */
+    void Release(ThreadRecord *record) {
+        {
+            std::lock_guard<std::mutex> lock(orphans_mutex_);
+            for (Bag &bag : record->bags_) {
+                if (!bag.objects_.empty()) {
+                    orphans_.push_back(std::move(bag));
+                    bag = Bag{};
+                }
+            }
+        }
+        record->nesting_ = 0;
+        record->retired_since_collect_ = 0;
+        record->state_.store(0, std::memory_order_release);
+        record->in_use_.store(false, std::memory_order_release);
+    }
+
+    void *Pin() {
+        ThreadRecord *record = LocalRecord();
+        if (record->nesting_++ == 0) {
+            epoch_type epoch = global_epoch_.load(std::memory_order_seq_cst);
+            // Закрепление должно стать видимым до любых чтений структуры.
+            // Используется RMW-операция, а не store + fence: TryAdvance()
+            // тоже читает state_ RMW-операцией, так что они упорядочены через
+            // порядок модификаций state_ (и это понимает ThreadSanitizer)
+            record->state_.exchange((epoch << 1) | 1,
+                                    std::memory_order_seq_cst);
+        }
+        return record;
+    }
+
+    void Unpin(void *pointer) noexcept {
+        ThreadRecord *record = static_cast<ThreadRecord *>(pointer);
+        if (--record->nesting_ == 0) {
+            record->state_.store(0, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Увеличивает глобальную эпоху, если все закрепленные потоки
+     * находятся в текущей эпохе
+     */
+    void TryAdvance() {
+        epoch_type epoch = global_epoch_.load(std::memory_order_seq_cst);
+        for (ThreadRecord *record = records_.load(std::memory_order_acquire);
+             record != nullptr; record = record->next_) {
+            // fetch_add(0) вместо load - см. комментарий в Pin()
+            epoch_type state =
+                record->state_.fetch_add(0, std::memory_order_seq_cst);
+            if ((state & 1) != 0 && (state >> 1) != epoch) {
+                return;
+            }
+        }
+        global_epoch_.compare_exchange_strong(epoch, epoch + 1,
+                                              std::memory_order_seq_cst);
+    }
+
+    static void FreeObjects(std::vector<Retired> &objects) {
+        for (const Retired &retired : objects) {
+            retired.deleter_(retired.object_);
+        }
+        objects.clear();
+    }
+
+    // Глобальная эпоха. Начинается с 2, чтобы пустые корзины (эпоха 0)
+    // всегда считались готовыми к удалению
+    alignas(kCacheLineSize) std::atomic<epoch_type> global_epoch_{2};
+    // Список записей потоков (только добавление)
+    alignas(kCacheLineSize) std::atomic<ThreadRecord *> records_{nullptr};
+    // Корзины завершившихся потоков
+    std::mutex orphans_mutex_;
+    std::vector<Bag> orphans_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_EPOCH_H_
@@ -0,0 +1,99 @@
+/**
+ * @file s21_intrusive_hook.h
+ * @brief Способы встраивания хука интрузивного контейнера в объект
+ * пользователя.
+ *
+ * @details Интрузивный контейнер (s21::intrusive_list, s21::intrusive_set,
+ * s21::intrusive_multiset) не создает узлов и не копирует значения: ссылки на
+ * соседей хранятся в хуке - поле или базовом классе самого объекта. Контейнер
+ * работает с хуками, а к объекту переходит через "стратегию хука":
+ * - intrusive_base_hook - объект наследуется от хука;
+ * - intrusive_member_hook - хук является полем объекта. Так один объект может
+ * одновременно состоять в нескольких контейнерах одного вида.
+ *
+ * Стратегия предоставляет типы hook_type и value_type и статические методы
+ * ToHook() и ToValue().
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_HOOK_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_HOOK_H_
+
+#include <cstddef>
+#include <cstring>
+
+namespace s21 {
+/**
+ * @brief Хук - базовый класс объекта
+ *
+ * @tparam Value Тип объекта (наследник Hook)
+ * @tparam Hook Тип хука
+ */
+template <typename Value, typename Hook>
+struct intrusive_base_hook {
+    using value_type = Value;
+    using hook_type = Hook;
+
+    static hook_type *ToHook(value_type &value) noexcept {
+        return &static_cast<hook_type &>(value);
+    }
+
+    static value_type *ToValue(hook_type *hook) noexcept {
+        return static_cast<value_type *>(hook);
+    }
+
+    static const value_type *ToValue(const hook_type *hook) noexcept {
+        return static_cast<const value_type *>(hook);
+    }
+};
+
+/**
+ * @brief Хук - поле Member объекта
+ *
+ * @tparam Value Тип объекта
+ * @tparam Hook Тип хука
+ * @tparam Member Указатель на поле-хук
+ */
+template <typename Value, typename Hook, Hook Value::*Member>
+struct intrusive_member_hook {
+    using value_type = Value;
+    using hook_type = Hook;
+
+    static hook_type *ToHook(value_type &value) noexcept {
+        return &(value.*Member);
+    }
+
+    static value_type *ToValue(hook_type *hook) noexcept {
+        return reinterpret_cast<value_type *>(
+            reinterpret_cast<unsigned char *>(hook) - Offset());
+    }
+
+    static const value_type *ToValue(const hook_type *hook) noexcept {
+        return reinterpret_cast<const value_type *>(
+            reinterpret_cast<const unsigned char *>(hook) - Offset());
+    }
+
+  private:
+    using member_pointer = Hook Value::*;
+
+    // Указатель на поле класса без виртуальных баз хранится как смещение поля
+    // от начала объекта (Itanium C++ ABI - GCC, Clang)
+    static_assert(sizeof(member_pointer) == sizeof(std::ptrdiff_t),
+                  "s21::intrusive_member_hook expects a pointer to data member "
+                  "to be stored as an offset");
+
+    /**
+     * @brief Смещение поля-хука от начала объекта. offsetof не работает с
+     * указателем на член, поэтому смещение читается из представления самого
+     * указателя на член - без обращения к какому-либо объекту
+     */
+    static std::ptrdiff_t Offset() noexcept {
+        member_pointer member = Member;
+        std::ptrdiff_t offset;
+        std::memcpy(&offset, &member, sizeof(offset));
+        return offset;
+    }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_HOOK_H_
@@ -0,0 +1,416 @@
+/**
+ * @file s21_intrusive_list.h
+ * @brief s21::intrusive_list - двусвязный список объектов, которые сами
+ * содержат ссылки на соседей (хук intrusive_list_hook).
+ *
+ * @details В отличие от s21::list, список не владеет элементами и не выделяет
+ * память: вставка только связывает хук объекта, удаление только отвязывает.
+ * Время жизни объектов (например, в арене) контролирует пользователь: объект
+ * нельзя уничтожать, пока он состоит в списке. Перепривязка узлов общая с
+ * s21::list (ListAlgorithms).
+ *
+ * Объект может находиться не более чем в одном списке на каждый свой хук.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "s21_intrusive_hook.h"
+#include "s21_list.h"
+
+namespace s21 {
+/**
+ * @brief Хук интрузивного списка. Не связанный ни с каким списком хук
+ * ссылается сам на себя. Копирование объекта не копирует связи хука
+ */
+struct intrusive_list_hook {
+    intrusive_list_hook() noexcept : next_(this), prev_(this) {
+    }
+
+    intrusive_list_hook(const intrusive_list_hook &) noexcept
+        : intrusive_list_hook() {
+    }
+
+    intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+        return *this;
+    }
+
+    /**
+     * @brief Проверяет, состоит ли объект в списке
+     */
+    bool is_linked() const noexcept {
+        return next_ != this;
+    }
+
+    // Указатель на следующий хук списка
+    intrusive_list_hook *next_;
+    // Указатель на предыдущий хук списка
+    intrusive_list_hook *prev_;
+};
+
+/**
+ * @brief Интрузивный список
+ *
+ * @tparam Value Тип объекта
+ * @tparam HookTraits Стратегия хука (см. s21_intrusive_hook.h), по умолчанию
+ * Value наследуется от intrusive_list_hook
+ */
+template <typename Value,
+          typename HookTraits = intrusive_base_hook<Value, intrusive_list_hook>>
+class intrusive_list {
+  private:
+    struct IntrusiveListIterator;
+    struct IntrusiveListIteratorConst;
+
+    using hook_type = intrusive_list_hook;
+    using algorithms = ListAlgorithms<hook_type>;
+
+  public:
+    // Тип элемента
+    using value_type = Value;
+    // Тип ссылки на элемент
+    using reference = Value &;
+    // Тип константной ссылки на элемент
+    using const_reference = const Value &;
+    // Внутренний класс для итератора
+    using iterator = IntrusiveListIterator;
+    // Внутренний класс для константного итератора
+    using const_iterator = IntrusiveListIteratorConst;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+    intrusive_list() noexcept : size_(0U) {
+    }
+
+    intrusive_list(const intrusive_list &) = delete;
+    intrusive_list &operator=(const intrusive_list &) = delete;
+
+    /**
+     * @brief Конструктор переноса: объекты перепривязываются к новому списку,
+     * other становится пустым
+     *
+     * @param other
+     */
+    intrusive_list(intrusive_list &&other) noexcept : intrusive_list() {
+        splice(end(), other);
+    }
+
+    intrusive_list &operator=(intrusive_list &&other) noexcept {
+        if (this != &other) {
+            clear();
+            splice(end(), other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Деструктор отвязывает все объекты, сами объекты не удаляются
+     */
+    ~intrusive_list() {
+        clear();
+    }
+
+    reference front() noexcept {
+        return *begin();
+    }
+
+    const_reference front() const noexcept {
+        return *begin();
+    }
+
+    reference back() noexcept {
+        return *std::prev(end());
+    }
+
+    const_reference back() const noexcept {
+        return *std::prev(end());
+    }
+
+    iterator begin() noexcept {
+        return iterator(head_.next_);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(head_.next_);
+    }
+
+    iterator end() noexcept {
+        return iterator(&head_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(&head_);
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Отвязывает все объекты от списка
+     */
+    void clear() noexcept {
+        hook_type *hook = head_.next_;
+        while (hook != &head_) {
+            hook_type *next = hook->next_;
+            hook->next_ = hook;
+            hook->prev_ = hook;
+            hook = next;
+        }
+        head_.next_ = &head_;
+        head_.prev_ = &head_;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Итератор на объект value, который состоит в этом списке. O(1)
+     *
+     * @param value
+     * @return iterator
+     */
+    iterator iterator_to(reference value) noexcept {
+        return iterator(HookTraits::ToHook(value));
+    }
+
+    /**
+     * @brief Связывает объект value перед pos. Объект не должен состоять в
+     * другом списке по этому хуку
+     *
+     * @param pos
+     * @param value
+     * @return iterator Итератор на value
+     */
+    iterator insert(const_iterator pos, reference value) noexcept {
+        hook_type *hook = HookTraits::ToHook(value);
+        algorithms::LinkBefore(const_cast<hook_type *>(pos.hook_), hook);
+        ++size_;
+        return iterator(hook);
+    }
+
+    /**
+     * @brief Отвязывает объект в позиции pos (не end())
+     *
+     * @param pos
+     * @return iterator Итератор на следующий объект
+     */
+    iterator erase(const_iterator pos) noexcept {
+        hook_type *hook = const_cast<hook_type *>(pos.hook_);
+        iterator next(hook->next_);
+        algorithms::Unlink(hook);
+        --size_;
+        return next;
+    }
+
+    /**
+     * @brief Отвязывает объект value, который состоит в этом списке
+     *
+     * @param value
+     */
+    void erase(reference value) noexcept {
+        erase(iterator_to(value));
+    }
+
+    void push_back(reference value) noexcept {
+        insert(end(), value);
+    }
+
+    void push_front(reference value) noexcept {
+        insert(begin(), value);
+    }
+
+    void pop_back() noexcept {
+        erase(std::prev(end()));
+    }
+
+    void pop_front() noexcept {
+        erase(begin());
+    }
+
+    /**
+     * @brief Переносит все объекты other перед pos. O(1)
+     *
+     * @param pos
+     * @param other
+     */
+    void splice(const_iterator pos, intrusive_list &other) noexcept {
+        if (this != &other && !other.empty()) {
+            algorithms::Transfer(const_cast<hook_type *>(pos.hook_),
+                                 other.head_.next_, &other.head_);
+            size_ += std::exchange(other.size_, 0);
+        }
+    }
+
+    /**
+     * @brief Переносит объект it из other (или из этого же списка) перед pos.
+     * O(1)
+     *
+     * @param pos
+     * @param other
+     * @param it
+     */
+    void splice(const_iterator pos, intrusive_list &other,
+                const_iterator it) noexcept {
+        hook_type *position = const_cast<hook_type *>(pos.hook_);
+        hook_type *hook = const_cast<hook_type *>(it.hook_);
+        // Объект уже стоит перед pos, иначе он был бы связан сам с собой
+        if (position == hook || position == hook->next_) {
+            return;
+        }
+        algorithms::Transfer(position, hook, hook->next_);
+        if (this != &other) {
+            --other.size_;
+            ++size_;
+        }
+    }
+
+    /**
+     * @brief Обменивает содержимое списков
+     *
+     * @param other
+     */
+    void swap(intrusive_list &other) noexcept {
+        intrusive_list tmp(std::move(other));
+        other.splice(other.end(), *this);
+        splice(end(), tmp);
+    }
+
+  private:
+    /**
+     * @brief Итератор интрузивного списка - указатель на хук объекта
+     */
+    struct IntrusiveListIterator {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = intrusive_list::value_type;
+        using pointer = value_type *;
+        using reference = value_type &;
+
+        IntrusiveListIterator() = delete;
+
+        explicit IntrusiveListIterator(hook_type *hook) noexcept
+            : hook_(hook) {
+        }
+
+        reference operator*() const noexcept {
+            return *HookTraits::ToValue(hook_);
+        }
+
+        pointer operator->() const noexcept {
+            return HookTraits::ToValue(hook_);
+        }
+
+        iterator &operator++() noexcept {
+            hook_ = hook_->next_;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept {
+            iterator tmp{hook_};
+            ++(*this);
+            return tmp;
+        }
+
+        iterator &operator--() noexcept {
+            hook_ = hook_->prev_;
+            return *this;
+        }
+
+        iterator operator--(int) noexcept {
+            iterator tmp{hook_};
+            --(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const iterator &it1,
+                               const iterator &it2) noexcept {
+            return it1.hook_ == it2.hook_;
+        }
+
+        friend bool operator!=(const iterator &it1,
+                               const iterator &it2) noexcept {
+            return it1.hook_ != it2.hook_;
+        }
+
+        hook_type *hook_;
+    };
+
+    /**
+     * @brief Константный итератор интрузивного списка
+     */
+    struct IntrusiveListIteratorConst {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = intrusive_list::value_type;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        IntrusiveListIteratorConst() = delete;
+
+        explicit IntrusiveListIteratorConst(const hook_type *hook) noexcept
+            : hook_(hook) {
+        }
+
+        IntrusiveListIteratorConst(const iterator &it) noexcept
+            : hook_(it.hook_) {
+        }
+
+        reference operator*() const noexcept {
+            return *HookTraits::ToValue(hook_);
+        }
+
+        pointer operator->() const noexcept {
+            return HookTraits::ToValue(hook_);
+        }
+
+        const_iterator &operator++() noexcept {
+            hook_ = hook_->next_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp{hook_};
+            ++(*this);
+            return tmp;
+        }
+
+        const_iterator &operator--() noexcept {
+            hook_ = hook_->prev_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp{hook_};
+            --(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return it1.hook_ == it2.hook_;
+        }
+
+        friend bool operator!=(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return it1.hook_ != it2.hook_;
+        }
+
+        const hook_type *hook_;
+    };
+
+    // Служебный хук: next_ - первый объект, prev_ - последний
+    hook_type head_;
+    // Количество объектов в списке
+    size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
@@ -0,0 +1,614 @@
+/**
+ * @file s21_intrusive_tree.h
+ * @brief s21::intrusive_set и s21::intrusive_multiset - упорядоченные
+ * контейнеры на красно-черном дереве, узлами которого являются хуки
+ * (intrusive_set_hook), встроенные в объекты пользователя.
+ *
+ * @details Контейнеры не владеют объектами и не выделяют память: вставка
+ * только встраивает хук объекта в дерево, удаление только изымает его.
+ * Балансировка и обход общие с RedBlackTree (RedBlackTreeAlgorithms).
+ * Объект нельзя уничтожать или менять его ключ, пока он состоит в контейнере.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_TREE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_TREE_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "s21_intrusive_hook.h"
+#include "s21_tree.h"
+
+namespace s21 {
+/**
+ * @brief Хук интрузивного дерева. Не встроенный в дерево хук не имеет
+ * родителя. Копирование объекта не копирует связи хука
+ */
+struct intrusive_set_hook {
+    intrusive_set_hook() noexcept = default;
+
+    intrusive_set_hook(const intrusive_set_hook &) noexcept
+        : intrusive_set_hook() {
+    }
+
+    intrusive_set_hook &operator=(const intrusive_set_hook &) noexcept {
+        return *this;
+    }
+
+    /**
+     * @brief Проверяет, встроен ли объект в дерево
+     */
+    bool is_linked() const noexcept {
+        return parent_ != nullptr;
+    }
+
+    // Указатель на родителя
+    intrusive_set_hook *parent_ = nullptr;
+    // Указатель на левого потомка
+    intrusive_set_hook *left_ = nullptr;
+    // Указатель на правого потомка
+    intrusive_set_hook *right_ = nullptr;
+    // Цвет узла
+    RedBlackTreeColor color_ = kRed;
+};
+
+/**
+ * @brief Общая часть интрузивных множеств: дерево хуков со служебным хуком
+ * head_, поиск и удаление
+ *
+ * @tparam Value Тип объекта
+ * @tparam Compare Компаратор объектов
+ * @tparam HookTraits Стратегия хука (см. s21_intrusive_hook.h)
+ */
+template <typename Value, typename Compare, typename HookTraits>
+class IntrusiveRedBlackTree {
+  private:
+    struct IntrusiveTreeIterator;
+    struct IntrusiveTreeIteratorConst;
+
+  protected:
+    using hook_type = intrusive_set_hook;
+    using algorithms = RedBlackTreeAlgorithms<hook_type>;
+
+  public:
+    // Тип элемента
+    using value_type = Value;
+    // Тип ссылки на элемент
+    using reference = Value &;
+    // Тип константной ссылки на элемент
+    using const_reference = const Value &;
+    // Внутренний класс для итератора
+    using iterator = IntrusiveTreeIterator;
+    // Внутренний класс для константного итератора
+    using const_iterator = IntrusiveTreeIteratorConst;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+    // Тип компаратора
+    using value_compare = Compare;
+
+    IntrusiveRedBlackTree(const IntrusiveRedBlackTree &) = delete;
+    IntrusiveRedBlackTree &operator=(const IntrusiveRedBlackTree &) = delete;
+
+    /**
+     * @brief Деструктор изымает все объекты, сами объекты не удаляются
+     */
+    ~IntrusiveRedBlackTree() {
+        clear();
+    }
+
+    iterator begin() noexcept {
+        return iterator(head_.left_);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(head_.left_);
+    }
+
+    iterator end() noexcept {
+        return iterator(&head_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(&head_);
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Изымает все объекты из дерева
+     */
+    void clear() noexcept {
+        Unlink(head_.parent_);
+        algorithms::InitializeHead(&head_);
+        size_ = 0;
+    }
+
+    /**
+     * @brief Итератор на объект value, который встроен в это дерево. O(1)
+     *
+     * @param value
+     * @return iterator
+     */
+    iterator iterator_to(reference value) noexcept {
+        return iterator(HookTraits::ToHook(value));
+    }
+
+    /**
+     * @brief Изымает объект в позиции pos (не end()) из дерева
+     *
+     * @param pos
+     * @return iterator Итератор на следующий объект
+     */
+    iterator erase(const_iterator pos) noexcept {
+        hook_type *hook = const_cast<hook_type *>(pos.hook_);
+        iterator next(algorithms::NextNode(hook));
+        algorithms::Extract(&head_, hook);
+        ResetHook(hook);
+        --size_;
+        return next;
+    }
+
+    /**
+     * @brief Изымает объект value, который встроен в это дерево
+     *
+     * @param value
+     */
+    void erase(reference value) noexcept {
+        erase(iterator_to(value));
+    }
+
+    /**
+     * @brief Ищет объект, эквивалентный key
+     *
+     * @param key
+     * @return iterator Найденный объект или end()
+     */
+    iterator find(const_reference key) {
+        return find(key, comp_);
+    }
+
+    const_iterator find(const_reference key) const {
+        return find(key, comp_);
+    }
+
+    /**
+     * @brief Версия find() для поиска по ключу другого типа, без создания
+     * объекта
+     *
+     * @tparam Key Тип ключа
+     * @tparam KeyCompare Компаратор с перегрузками (const Value &, Key) и
+     * (Key, const Value &), согласованный с компаратором дерева
+     * @param key Искомый ключ
+     * @param comp Компаратор
+     * @return iterator Найденный объект или end()
+     */
+    template <typename Key, typename KeyCompare>
+    iterator find(const Key &key, const KeyCompare &comp) {
+        return iterator(const_cast<hook_type *>(FindHook(key, comp)));
+    }
+
+    template <typename Key, typename KeyCompare>
+    const_iterator find(const Key &key, const KeyCompare &comp) const {
+        return const_iterator(FindHook(key, comp));
+    }
+
+    bool contains(const_reference key) const {
+        return contains(key, comp_);
+    }
+
+    template <typename Key, typename KeyCompare>
+    bool contains(const Key &key, const KeyCompare &comp) const {
+        return FindHook(key, comp) != &head_;
+    }
+
+    /**
+     * @brief Первый объект, не меньший key
+     *
+     * @param key
+     * @return iterator
+     */
+    iterator lower_bound(const_reference key) {
+        return lower_bound(key, comp_);
+    }
+
+    const_iterator lower_bound(const_reference key) const {
+        return lower_bound(key, comp_);
+    }
+
+    /**
+     * @brief Версия lower_bound() для ключа другого типа (см. find(key,
+     * comp))
+     */
+    template <typename Key, typename KeyCompare>
+    iterator lower_bound(const Key &key, const KeyCompare &comp) {
+        return iterator(const_cast<hook_type *>(LowerBoundHook(key, comp)));
+    }
+
+    template <typename Key, typename KeyCompare>
+    const_iterator lower_bound(const Key &key, const KeyCompare &comp) const {
+        return const_iterator(LowerBoundHook(key, comp));
+    }
+
+    /**
+     * @brief Первый объект, больший key
+     *
+     * @param key
+     * @return iterator
+     */
+    iterator upper_bound(const_reference key) {
+        return upper_bound(key, comp_);
+    }
+
+    const_iterator upper_bound(const_reference key) const {
+        return upper_bound(key, comp_);
+    }
+
+    /**
+     * @brief Версия upper_bound() для ключа другого типа (см. find(key,
+     * comp))
+     */
+    template <typename Key, typename KeyCompare>
+    iterator upper_bound(const Key &key, const KeyCompare &comp) {
+        return iterator(const_cast<hook_type *>(UpperBoundHook(key, comp)));
+    }
+
+    template <typename Key, typename KeyCompare>
+    const_iterator upper_bound(const Key &key, const KeyCompare &comp) const {
+        return const_iterator(UpperBoundHook(key, comp));
+    }
+
+  protected:
+    explicit IntrusiveRedBlackTree(const Compare &comp) : comp_(comp) {
+        algorithms::InitializeHead(&head_);
+    }
+
+    IntrusiveRedBlackTree(IntrusiveRedBlackTree &&other) noexcept
+        : comp_(other.comp_) {
+        algorithms::InitializeHead(&head_);
+        Swap(other);
+    }
+
+    IntrusiveRedBlackTree &operator=(IntrusiveRedBlackTree &&other) noexcept {
+        if (this != &other) {
+            clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Встраивает объект value в дерево
+     *
+     * @param value
+     * @param unique_only Не встраивать, если эквивалентный объект уже есть
+     * @return std::pair<iterator, bool> Встроенный объект (или объект, который
+     * помешал вставке) и признак вставки
+     */
+    std::pair<iterator, bool> Insert(reference value, bool unique_only) {
+        hook_type *parent = nullptr;
+        hook_type *node = head_.parent_;
+        bool to_left = false;
+        while (node != nullptr) {
+            parent = node;
+            to_left = comp_(value, *HookTraits::ToValue(node));
+            if (!to_left && unique_only &&
+                !comp_(*HookTraits::ToValue(node), value)) {
+                return {iterator(node), false};
+            }
+            node = to_left ? node->left_ : node->right_;
+        }
+
+        hook_type *hook = HookTraits::ToHook(value);
+        ResetHook(hook);
+        algorithms::Link(&head_, parent, to_left, hook);
+        ++size_;
+        return {iterator(hook), true};
+    }
+
+    /**
+     * @brief Обменивает содержимое деревьев. Корни перепривязываются к
+     * служебным хукам нового владельца
+     */
+    void Swap(IntrusiveRedBlackTree &other) noexcept {
+        std::swap(head_.parent_, other.head_.parent_);
+        std::swap(head_.left_, other.head_.left_);
+        std::swap(head_.right_, other.head_.right_);
+        std::swap(size_, other.size_);
+        std::swap(comp_, other.comp_);
+        FixHead();
+        other.FixHead();
+    }
+
+  private:
+    template <typename Key, typename KeyCompare>
+    const hook_type *FindHook(const Key &key, const KeyCompare &comp) const {
+        const hook_type *result = LowerBoundHook(key, comp);
+        if (result != &head_ && comp(key, *HookTraits::ToValue(result))) {
+            return &head_;
+        }
+        return result;
+    }
+
+    template <typename Key, typename KeyCompare>
+    const hook_type *LowerBoundHook(const Key &key,
+                                    const KeyCompare &comp) const {
+        const hook_type *result = &head_;
+        const hook_type *node = head_.parent_;
+        while (node != nullptr) {
+            if (comp(*HookTraits::ToValue(node), key)) {
+                node = node->right_;
+            } else {
+                result = node;
+                node = node->left_;
+            }
+        }
+        return result;
+    }
+
+    template <typename Key, typename KeyCompare>
+    const hook_type *UpperBoundHook(const Key &key,
+                                    const KeyCompare &comp) const {
+        const hook_type *result = &head_;
+        const hook_type *node = head_.parent_;
+        while (node != nullptr) {
+            if (comp(key, *HookTraits::ToValue(node))) {
+                result = node;
+                node = node->left_;
+            } else {
+                node = node->right_;
+            }
+        }
+        return result;
+    }
+
+    static void ResetHook(hook_type *hook) noexcept {
+        hook->parent_ = nullptr;
+        hook->left_ = nullptr;
+        hook->right_ = nullptr;
+        hook->color_ = kRed;
+    }
+
+    /**
+     * @brief Рекурсивно сбрасывает хуки поддерева node
+     */
+    static void Unlink(hook_type *node) noexcept {
+        if (node == nullptr) {
+            return;
+        }
+        Unlink(node->left_);
+        Unlink(node->right_);
+        ResetHook(node);
+    }
+
+    void FixHead() noexcept {
+        if (head_.parent_ == nullptr) {
+            algorithms::InitializeHead(&head_);
+        } else {
+            head_.parent_->parent_ = &head_;
+        }
+    }
+
+    /**
+     * @brief Итератор интрузивного дерева - указатель на хук объекта
+     */
+    struct IntrusiveTreeIterator {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = IntrusiveRedBlackTree::value_type;
+        using pointer = value_type *;
+        using reference = value_type &;
+
+        IntrusiveTreeIterator() = delete;
+
+        explicit IntrusiveTreeIterator(hook_type *hook) noexcept
+            : hook_(hook) {
+        }
+
+        reference operator*() const noexcept {
+            return *HookTraits::ToValue(hook_);
+        }
+
+        pointer operator->() const noexcept {
+            return HookTraits::ToValue(hook_);
+        }
+
+        iterator &operator++() noexcept {
+            hook_ = algorithms::NextNode(hook_);
+            return *this;
+        }
+
+        iterator operator++(int) noexcept {
+            iterator tmp{hook_};
+            ++(*this);
+            return tmp;
+        }
+
+        iterator &operator--() noexcept {
+            hook_ = algorithms::PrevNode(hook_);
+            return *this;
+        }
+
+        iterator operator--(int) noexcept {
+            iterator tmp{hook_};
+            --(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const iterator &it1,
+                               const iterator &it2) noexcept {
+            return it1.hook_ == it2.hook_;
+        }
+
+        friend bool operator!=(const iterator &it1,
+                               const iterator &it2) noexcept {
+            return it1.hook_ != it2.hook_;
+        }
+
+        hook_type *hook_;
+    };
+
+    /**
+     * @brief Константный итератор интрузивного дерева
+     */
+    struct IntrusiveTreeIteratorConst {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = IntrusiveRedBlackTree::value_type;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        IntrusiveTreeIteratorConst() = delete;
+
+        explicit IntrusiveTreeIteratorConst(const hook_type *hook) noexcept
+            : hook_(hook) {
+        }
+
+        IntrusiveTreeIteratorConst(const iterator &it) noexcept
+            : hook_(it.hook_) {
+        }
+
+        reference operator*() const noexcept {
+            return *HookTraits::ToValue(hook_);
+        }
+
+        pointer operator->() const noexcept {
+            return HookTraits::ToValue(hook_);
+        }
+
+        const_iterator &operator++() noexcept {
+            hook_ = algorithms::NextNode(hook_);
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp{hook_};
+            ++(*this);
+            return tmp;
+        }
+
+        const_iterator &operator--() noexcept {
+            hook_ = algorithms::PrevNode(hook_);
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp{hook_};
+            --(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return it1.hook_ == it2.hook_;
+        }
+
+        friend bool operator!=(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return it1.hook_ != it2.hook_;
+        }
+
+        const hook_type *hook_;
+    };
+
+    // Служебный хук: parent_ - корень, left_ - минимум, right_ - максимум
+    hook_type head_;
+    // Количество объектов в дереве
+    size_type size_ = 0;
+    // Компаратор объектов
+    Compare comp_;
+};
+
+/**
+ * @brief Интрузивное множество: объекты с уникальными ключами
+ *
+ * @tparam Value Тип объекта
+ * @tparam Compare Компаратор объектов
+ * @tparam HookTraits Стратегия хука, по умолчанию Value наследуется от
+ * intrusive_set_hook
+ */
+template <typename Value, typename Compare = std::less<Value>,
+          typename HookTraits = intrusive_base_hook<Value, intrusive_set_hook>>
+class intrusive_set
+    : public IntrusiveRedBlackTree<Value, Compare, HookTraits> {
+    using base = IntrusiveRedBlackTree<Value, Compare, HookTraits>;
+
+  public:
+    using typename base::iterator;
+    using typename base::reference;
+
+    explicit intrusive_set(const Compare &comp = Compare()) : base(comp) {
+    }
+
+    intrusive_set(intrusive_set &&other) noexcept = default;
+    intrusive_set &operator=(intrusive_set &&other) noexcept = default;
+
+    /**
+     * @brief Встраивает объект value, если эквивалентного объекта ещё нет.
+     * Память не выделяется
+     *
+     * @param value Объект, не встроенный ни в одно дерево по этому хуку
+     * @return std::pair<iterator, bool> Встроенный объект (или объект, который
+     * помешал вставке) и признак вставки
+     */
+    std::pair<iterator, bool> insert(reference value) {
+        return base::Insert(value, true);
+    }
+
+    void swap(intrusive_set &other) noexcept {
+        base::Swap(other);
+    }
+};
+
+/**
+ * @brief Интрузивное мультимножество: допускает эквивалентные объекты,
+ * эквивалентные объекты идут в порядке вставки
+ *
+ * @tparam Value Тип объекта
+ * @tparam Compare Компаратор объектов
+ * @tparam HookTraits Стратегия хука, по умолчанию Value наследуется от
+ * intrusive_set_hook
+ */
+template <typename Value, typename Compare = std::less<Value>,
+          typename HookTraits = intrusive_base_hook<Value, intrusive_set_hook>>
+class intrusive_multiset
+    : public IntrusiveRedBlackTree<Value, Compare, HookTraits> {
+    using base = IntrusiveRedBlackTree<Value, Compare, HookTraits>;
+
+  public:
+    using typename base::iterator;
+    using typename base::reference;
+
+    explicit intrusive_multiset(const Compare &comp = Compare()) : base(comp) {
+    }
+
+    intrusive_multiset(intrusive_multiset &&other) noexcept = default;
+    intrusive_multiset &operator=(intrusive_multiset &&other) noexcept =
+        default;
+
+    /**
+     * @brief Встраивает объект value после всех эквивалентных ему. Память не
+     * выделяется
+     *
+     * @param value Объект, не встроенный ни в одно дерево по этому хуку
+     * @return iterator Встроенный объект
+     */
+    iterator insert(reference value) {
+        return base::Insert(value, false).first;
+    }
+
+    void swap(intrusive_multiset &other) noexcept {
+        base::Swap(other);
+    }
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_TREE_H_
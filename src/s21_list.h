@@ -36,11 +36,71 @@
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_LIST_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_LIST_H_
 
+#include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <utility>
+
+#include "s21_node_handle.h"
 
 namespace s21 {
+/**
+ * @brief Операции перепривязки узлов кольцевого двусвязного списка, не
+ * зависящие от значений узлов.
+ * @details Используются обычным списком list и интрузивным списком
+ * (s21_intrusive_list.h), где узлом служит хук, встроенный в объект
+ * пользователя. Узел Node должен содержать поля next_ и prev_ (Node *).
+ *
+ * @tparam Node Тип узла
+ */
+template <typename Node>
+struct ListAlgorithms {
+    /**
+     * @brief Встраивает узел node перед узлом position
+     *
+     * @param position
+     * @param node Встраиваемый узел
+     */
+    static void LinkBefore(Node *position, Node *node) noexcept {
+        node->next_ = position;
+        node->prev_ = position->prev_;
+        position->prev_->next_ = node;
+        position->prev_ = node;
+    }
+
+    /**
+     * @brief Изымает узел из списка, после чего узел ссылается сам на себя
+     *
+     * @param node
+     */
+    static void Unlink(Node *node) noexcept {
+        node->prev_->next_ = node->next_;
+        node->next_->prev_ = node->prev_;
+        node->next_ = node;
+        node->prev_ = node;
+    }
+
+    /**
+     * @brief Переносит узлы [first, last) (из этого или другого списка) перед
+     * position. position не должна лежать в [first, last)
+     */
+    static void Transfer(Node *position, Node *first, Node *last) noexcept {
+        if (position == last) {
+            return;
+        }
+        Node *tail = last->prev_;
+        first->prev_->next_ = last;
+        last->prev_ = first->prev_;
+
+        first->prev_ = position->prev_;
+        tail->next_ = position;
+        position->prev_->next_ = first;
+        position->prev_ = tail;
+    }
+};
+
 template <typename Type>
 class list {
   private:
@@ -64,6 +124,8 @@ class list {
 
     // Внутренний класс узла списка
     using node_type = ListNode;
+    // Дескриптор извлеченного узла (см. s21_node_handle.h)
+    using node_handle = NodeHandle<node_type, value_type>;
 
     /**
      * @brief Конструктор по умолчанию, создает пустой список
@@ -363,12 +425,19 @@ class list {
      * @return iterator
      */
     iterator insert(iterator pos, const_reference value) {
-        node_type *new_node = new node_type(value);
-
-        pos.node_->AttachPrev(new_node);
-        ++size_;
+        return emplace(pos, value);
+    }
 
-        return iterator(new_node);
+    /**
+     * @brief Вставляет элемент перед pos, перемещая в него value
+     * @details Strong exception guarantee
+     *
+     * @param pos
+     * @param value
+     * @return iterator
+     */
+    iterator insert(iterator pos, value_type &&value) {
+        return emplace(pos, std::move(value));
     }
 
     /**
@@ -386,6 +455,44 @@ class list {
         }
     }
 
+    /**
+     * @brief Извлекает элемент на позиции pos из списка вместе с узлом, не
+     * удаляя его. Узел можно вставить в любой список того же типа методом
+     * insert(pos, node_handle &&) без выделения памяти.
+     *
+     * @param pos
+     * @return node_handle Дескриптор узла (пустой для pos == end())
+     */
+    node_handle extract(const_iterator pos) noexcept {
+        if (pos == end()) {
+            return node_handle{};
+        }
+        node_type *node = const_cast<node_type *>(pos.node_);
+        node->UnAttach();
+        --size_;
+        return node_handle(node);
+    }
+
+    /**
+     * @brief Вставляет узел из дескриптора node перед pos. Память не
+     * выделяется.
+     *
+     * @param pos
+     * @param node Дескриптор узла, полученный из extract()
+     * @return iterator Итератор на вставленный элемент (pos для пустого
+     * дескриптора)
+     */
+    iterator insert(const_iterator pos, node_handle &&node) noexcept {
+        node_type *position = const_cast<node_type *>(pos.node_);
+        if (node.empty()) {
+            return iterator(position);
+        }
+        node_type *new_node = node.Release();
+        position->AttachPrev(new_node);
+        ++size_;
+        return iterator(new_node);
+    }
+
     /**
      * @brief Добавляет элемент в конце списка
      * @details Strong exception guarantee
@@ -393,7 +500,11 @@ class list {
      * @param value
      */
     void push_back(const_reference value) {
-        insert(end(), value);
+        emplace(end(), value);
+    }
+
+    void push_back(value_type &&value) {
+        emplace(end(), std::move(value));
     }
 
     /**
@@ -412,7 +523,11 @@ class list {
      * @param value
      */
     void push_front(const_reference value) {
-        insert(begin(), value);
+        emplace(begin(), value);
+    }
+
+    void push_front(value_type &&value) {
+        emplace(begin(), std::move(value));
     }
 
     /**
@@ -424,6 +539,61 @@ class list {
         erase(begin());
     }
 
+    /**
+     * @brief Добавляет элементы [first, last) в конец списка
+     * @details Strong exception guarantee: если создание элемента бросило
+     * исключение, уже добавленные элементы удаляются
+     *
+     * @param first, last Диапазон добавляемых элементов
+     */
+    template <typename InputIt>
+    void append_range(InputIt first, InputIt last) {
+        size_type added = 0;
+        try {
+            for (; first != last; ++first, ++added) {
+                emplace(end(), *first);
+            }
+        } catch (...) {
+            for (; added > 0; --added) {
+                pop_back();
+            }
+            throw;
+        }
+    }
+
+    /**
+     * @brief Удаляет count первых элементов списка
+     * @details count > size() - UB. Узлы отцепляются от списка одной
+     * перепривязкой (см. UnlinkRun()), затем удаляются
+     */
+    void pop_front_n(size_type count) noexcept {
+        if (count == 0) {
+            return;
+        }
+        node_type *last = head_->next_;
+        for (size_type i = 1; i < count; ++i) {
+            last = last->next_;
+        }
+        RemovedNodes removed;
+        UnlinkRun(head_->next_, last, count, removed);
+    }
+
+    /**
+     * @brief Удаляет count последних элементов списка
+     * @details count > size() - UB
+     */
+    void pop_back_n(size_type count) noexcept {
+        if (count == 0) {
+            return;
+        }
+        node_type *first = head_->prev_;
+        for (size_type i = 1; i < count; ++i) {
+            first = first->prev_;
+        }
+        RemovedNodes removed;
+        UnlinkRun(first, head_->prev_, count, removed);
+    }
+
     /**
      * @brief Обменивает содержимое двух списков
      * @details Не производится никаких операций копирования, перемещения или
@@ -441,16 +611,34 @@ class list {
 
     /**
      * @brief Объединяет два отсортированных списка в один.
-     * @details Strong exception guarantee
-     * Контейнер other всегда становится пустым после операции. Если списки не
+     * @details Контейнер other становится пустым после операции. Если списки не
      * отсортированы, то объединение все равно происходит, просто алгоритм
      * рассчитан на то, что списки уже отсортированы, поэтому мы экономим время
      * на сортировке результата и результат не будет отсортированным, если
      * списки на входе не отсортированы
      *
+     * Если сравнение элементов бросает исключение, оба списка остаются
+     * корректными и ни один элемент не теряется, но часть элементов other уже
+     * перенесена в *this (базовая гарантия)
+     *
      * @param other
      */
     void merge(list &other) {
+        merge(other, std::less<value_type>{});
+    }
+
+    /**
+     * @brief Объединяет два списка, отсортированных компаратором comp, в один.
+     * @details То же, что merge(other), но порядок задается comp. Слияние
+     * устойчивое: при равенстве элементы *this идут раньше элементов other.
+     * Если comp бросает исключение - базовая гарантия, как у merge(other)
+     *
+     * @tparam Compare Тип компаратора
+     * @param other
+     * @param comp Компаратор, задающий строгий слабый порядок
+     */
+    template <typename Compare>
+    void merge(list &other, Compare comp) {
         if (this != &other) {
             iterator this_begin = begin();
             iterator this_end = end();
@@ -459,7 +647,7 @@ class list {
 
             // Идем по this и other, пока не дойдем до конца одного из списков
             while (this_begin != this_end && other_begin != other_end) {
-                if (*other_begin < *this_begin) {
+                if (comp(*other_begin, *this_begin)) {
                     // Если элемент в other меньше текущего в this, от отцепляем
                     // его от other и прицепляем в текущую позицию this
                     node_type *tmp = other_begin.node_;
@@ -513,6 +701,83 @@ class list {
         }
     }
 
+    /**
+     * @brief Перемещает элемент it из other в *this перед позицией pos за
+     * O(1).
+     * @details Узел только перепривязывается, итераторы и ссылки на него
+     * остаются валидными, но указывают теперь на *this. other может быть
+     * самим *this - тогда элемент просто переставляется (например, в начало
+     * или конец очереди LRU).
+     *
+     * @param pos
+     * @param other Список, содержащий it
+     * @param it Перемещаемый элемент (не end())
+     */
+    void splice(const_iterator pos, list &other, const_iterator it) noexcept {
+        node_type *position = const_cast<node_type *>(pos.node_);
+        node_type *node = const_cast<node_type *>(it.node_);
+        if (position == node || position == node->next_) {
+            return;
+        }
+        ListAlgorithms<node_type>::Transfer(position, node, node->next_);
+        if (this != &other) {
+            --other.size_;
+            ++size_;
+        }
+    }
+
+    /**
+     * @brief Перемещает элементы [first, last) из other в *this перед
+     * позицией pos.
+     * @details Перепривязка узлов выполняется за O(1), но для списков-разных
+     * объектов нужно посчитать количество элементов диапазона - это O(n).
+     * Если количество уже известно, лучше передать его в
+     * splice(pos, other, first, last, count). Если other - это *this, то pos
+     * не должна лежать в [first, last).
+     *
+     * @param pos
+     * @param other Список, содержащий [first, last)
+     * @param first
+     * @param last
+     */
+    void splice(const_iterator pos, list &other, const_iterator first,
+                const_iterator last) noexcept {
+        size_type count = 0;
+        if (this != &other) {
+            count = static_cast<size_type>(std::distance(first, last));
+        }
+        splice(pos, other, first, last, count);
+    }
+
+    /**
+     * @brief Перемещает count элементов [first, last) из other в *this перед
+     * позицией pos за O(1).
+     * @details count должно быть равно std::distance(first, last), иначе
+     * размеры списков станут неверными (для other == *this значение
+     * игнорируется). Итераторы и ссылки на перемещенные элементы остаются
+     * валидными.
+     *
+     * @param pos
+     * @param other Список, содержащий [first, last)
+     * @param first
+     * @param last
+     * @param count Количество элементов в [first, last)
+     */
+    void splice(const_iterator pos, list &other, const_iterator first,
+                const_iterator last, size_type count) noexcept {
+        if (first == last) {
+            return;
+        }
+        ListAlgorithms<node_type>::Transfer(
+            const_cast<node_type *>(pos.node_),
+            const_cast<node_type *>(first.node_),
+            const_cast<node_type *>(last.node_));
+        if (this != &other) {
+            other.size_ -= count;
+            size_ += count;
+        }
+    }
+
     /**
      * @brief Переворачивает порядок элементов в списке
      * @details Методы свапа ноды в std скомпилированы в отдельную библиотеку с
@@ -535,45 +800,192 @@ class list {
      * @details Речь про повторяющиеся подряд элементы, т.е. из списка
      * {1,1,2,2,1,2} получится {1,2,1,2}
      *
+     * @return size_type Количество удаленных элементов
      */
-    void unique() {
-        iterator begin_iterator = begin();
-        iterator end_iterator = end();
-        iterator prev_iterator = begin_iterator;
+    size_type unique() {
+        return unique(std::equal_to<value_type>{});
+    }
 
-        ++begin_iterator;
-        while (begin_iterator != end_iterator) {
-            if (*begin_iterator == *prev_iterator) {
-                erase(begin_iterator);
-                begin_iterator = prev_iterator;
-            } else {
-                ++prev_iterator;
+    /**
+     * @brief Удаляет подряд идущие элементы, эквивалентные (по предикату p)
+     * предыдущему оставленному элементу.
+     * @details Каждая серия повторов отцепляется от списка целиком, за одну
+     * перепривязку указателей, а удаленные узлы освобождаются все вместе
+     * после прохода по списку. Итераторы и ссылки на оставшиеся элементы
+     * остаются действительными.
+     *
+     * @tparam BinaryPredicate Тип предиката
+     * @param p Предикат p(оставленный, текущий), true - текущий удаляется
+     * @return size_type Количество удаленных элементов
+     */
+    template <typename BinaryPredicate>
+    size_type unique(BinaryPredicate p) {
+        RemovedNodes removed;
+        size_type count = 0;
+        if (size_ < 2) {
+            return count;
+        }
+
+        node_type *kept = head_->next_;
+        while (kept->next_ != head_) {
+            node_type *first = kept->next_;
+            if (!p(kept->value_, first->value_)) {
+                kept = first;
+                continue;
+            }
+            node_type *last = first;
+            size_type run = 1;
+            while (last->next_ != head_ &&
+                   p(kept->value_, last->next_->value_)) {
+                last = last->next_;
+                ++run;
+            }
+            UnlinkRun(first, last, run, removed);
+            count += run;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Удаляет все элементы, равные value
+     * @details value может ссылаться на элемент самого списка: узлы
+     * освобождаются только после окончания прохода
+     *
+     * @param value
+     * @return size_type Количество удаленных элементов
+     */
+    size_type remove(const_reference value) {
+        return remove_if(
+            [&value](const_reference element) { return element == value; });
+    }
+
+    /**
+     * @brief Удаляет все элементы, для которых предикат pred возвращает true.
+     * @details Подряд идущие удаляемые элементы отцепляются от списка одной
+     * серией, а не по одному узлу, и освобождаются все вместе в конце (в том
+     * числе если pred выбросит исключение - тогда список содержит все
+     * элементы, кроме уже удаленных). Итераторы и ссылки на оставшиеся
+     * элементы остаются действительными.
+     *
+     * @tparam UnaryPredicate Тип предиката
+     * @param pred Предикат
+     * @return size_type Количество удаленных элементов
+     */
+    template <typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate pred) {
+        RemovedNodes removed;
+        size_type count = 0;
+
+        node_type *node = head_->next_;
+        while (node != head_) {
+            if (!pred(node->value_)) {
+                node = node->next_;
+                continue;
+            }
+            node_type *first = node;
+            size_type run = 1;
+            while (node->next_ != head_ && pred(node->next_->value_)) {
+                node = node->next_;
+                ++run;
             }
-            ++begin_iterator;
+            node = node->next_;
+            UnlinkRun(first, node->prev_, run, removed);
+            count += run;
         }
+        return count;
     }
+
     /**
-     * @brief Сортирует элементы списка в порядке возрастания. Метод вызывает
-     * быструю сортировку
+     * @brief Сортирует элементы списка в порядке возрастания (operator<).
+     * Сортировка устойчивая, подробности - в sort(Compare)
      */
     void sort() {
-        quick_sort(begin(), --end(), size_);
+        sort(std::less<value_type>{});
+    }
+
+    /**
+     * @brief Устойчиво сортирует элементы списка с помощью компаратора comp.
+     *
+     * @details Восходящая сортировка слиянием (bottom-up merge sort) за
+     * O(n log n) в худшем случае, без рекурсии и без выделения памяти.
+     * Значения элементов не копируются и не перемещаются - только
+     * перепривязываются узлы, поэтому все итераторы и ссылки остаются
+     * действительными.
+     *
+     * Узлы по одному снимаются со списка и попадают в "двоичный счетчик"
+     * bins: в bins[i] лежит отсортированная цепочка из 2^i узлов (или
+     * ничего). Новый узел сливается с bins[0], результат - с bins[1] и т.д.,
+     * пока не найдется пустая ячейка - как перенос единицы при сложении.
+     * В конце все ячейки сливаются в одну цепочку. Во время сортировки
+     * цепочки односвязные (по next_), ссылки prev_ восстанавливаются одним
+     * проходом в конце.
+     *
+     * Устойчивость: в ячейках с большим номером всегда лежат более ранние
+     * элементы, а при слиянии равных элементов первым берется элемент из
+     * более ранней цепочки.
+     *
+     * Если компаратор бросает исключение, все элементы остаются в списке
+     * (в неопределенном порядке), размер не меняется, исключение
+     * пробрасывается дальше.
+     *
+     * @tparam Compare Тип компаратора
+     * @param comp Компаратор, задающий строгий слабый порядок
+     */
+    template <typename Compare>
+    void sort(Compare comp) {
+        if (size_ < 2) {
+            return;
+        }
+
+        // 64 ячеек хватит для любого размера списка
+        node_type *bins[64] = {};
+        size_type used_bins = 0;
+
+        node_type *rest = head_->next_;
+        head_->prev_->next_ = nullptr;
+        node_type *carry = nullptr;
+        node_type *sorted = nullptr;
+        try {
+            while (rest != nullptr) {
+                carry = rest;
+                rest = rest->next_;
+                carry->next_ = nullptr;
+
+                size_type bin = 0;
+                while (bins[bin] != nullptr) {
+                    carry = MergeChains(bins[bin], carry, comp);
+                    bins[bin] = nullptr;
+                    ++bin;
+                }
+                bins[bin] = carry;
+                carry = nullptr;
+                used_bins = std::max(used_bins, bin + 1);
+            }
+
+            for (size_type bin = 0; bin < used_bins; ++bin) {
+                if (bins[bin] != nullptr) {
+                    sorted = MergeChains(bins[bin], sorted, comp);
+                    bins[bin] = nullptr;
+                }
+            }
+        } catch (...) {
+            // Компаратор бросил исключение: все цепочки собираются обратно в
+            // список (в неопределенном порядке), ни один узел не теряется
+            node_type *chain = ConcatChains(sorted, carry);
+            for (size_type bin = 0; bin < used_bins; ++bin) {
+                chain = ConcatChains(chain, bins[bin]);
+            }
+            RelinkChain(ConcatChains(chain, rest));
+            throw;
+        }
+        RelinkChain(sorted);
     }
 
-    // Эта версия emplace() соответствует реализации в std::list
-    // Оставлена справочно и для разрешения спорных вопросов при проверках (если
-    // проверяющий склоняется к версии, что именно так надо было делать)
     /**
      * @brief Размещает новый элемент в контейнер непосредственно перед pos.
      * @details Аргументы args... пересылаются конструктору элемента как
-     * std::forward<Args>(args)...
-     * Основное отличие от insert - избежать ненужных копирований объекта,
-     * единожды созданный временный объект будет передаваться по функциям без
-     * копирования и встроится в список.
-     *
-     * Это полезно, потому что независимо от того, насколько умны RVO и
-     * семантика перемещения, все еще есть сложные случаи, когда insert,
-     * push_back и т.д., вероятно, сделают ненужные копии.
+     * std::forward<Args>(args)..., элемент создается прямо в узле списка, без
+     * временного объекта и копирований.
      *
      * Никакие итераторы или ссылки не становятся недействительными.
      *
@@ -584,32 +996,12 @@ class list {
      * @param args Аргументы для передачи конструктору элемента.
      * @return iterator Итератор, указывающий на размещенный элемент.
      */
-
-    /**
-     * @brief Размещает новые элементы args в контейнер непосредственно перед
-     * pos.
-     * @details Модифицированная версия метода emplace, в целом идейно повторяет
-     * emplace() из std (см. описание предыдущей функции), но получает в
-     * качестве аргументов args уже созданные объекты для размещения в
-     * контейнере (а не параметры для конструирования объектов)
-     *
-     * @tparam Args Args Пакет параметров шаблона (Parameter pack)
-     * @param pos Итератор, перед которым будет размещён новый элемент.
-     * @param args Уже созданные элементы, которые необходимо вставить в
-     * соответствующий контейнер.
-     * @return iterator Итератор, указывающий на последний размещенный элемент.
-     */
     template <typename... Args>
     iterator emplace(const_iterator pos, Args &&...args) {
-        iterator it_current{const_cast<node_type *>(pos.node_)};
-        node_type *new_node;
-
-        for (auto item : {std::forward<Args>(args)...}) {
-            new_node = new node_type(std::move(item));
-            it_current.node_->AttachPrev(new_node);
-            ++size_;
-        }
-
+        node_type *new_node =
+            new node_type(std::in_place, std::forward<Args>(args)...);
+        const_cast<node_type *>(pos.node_)->AttachPrev(new_node);
+        ++size_;
         return iterator(new_node);
     }
 
@@ -619,10 +1011,11 @@ class list {
      *
      * @tparam Args Пакет параметров шаблона (Parameter pack)
      * @param args Аргументы для передачи конструктору элемента.
+     * @return reference Ссылка на размещенный элемент
      */
     template <typename... Args>
-    void emplace_back(Args &&...args) {
-        emplace(end(), std::forward<Args>(args)...);
+    reference emplace_back(Args &&...args) {
+        return *emplace(end(), std::forward<Args>(args)...);
     }
 
     /**
@@ -631,268 +1024,134 @@ class list {
      *
      * @tparam Args Пакет параметров шаблона (Parameter pack)
      * @param args Аргументы для передачи конструктору элемента.
+     * @return reference Ссылка на размещенный элемент
      */
     template <typename... Args>
-    void emplace_front(Args &&...args) {
-        emplace(begin(), std::forward<Args>(args)...);
+    reference emplace_front(Args &&...args) {
+        return *emplace(begin(), std::forward<Args>(args)...);
     }
 
   private:
     /**
-     * @brief Приватная функция, реализующая алгоритм быстрой сортировки.
-     * (см. https://w.wiki/5r2i)
-     *
-     * @details Один из самых быстродействующих (на практике) из алгоритмов
-     * внутренней сортировки общего назначения. Работает на связных списках и
-     * других структурах с последовательным доступом, допускающих эффективный
-     * проход как от начала к концу, так и от конца к началу.
-     *
-     * У алгоритма есть проблемы, которые будут разобраны ниже, после примера.
-     *
-     * В самом простом варианте алгоритм выглядит так:
-     * 1) Выбрать элемент из массива (Опорный элемент).
-     * 2) Перераспределить элементы в массиве таким образом, что элементы,
-     * меньшие опорного, помещаются перед ним, а большие или равные - после.
-     * 3) Рекурсивно применить первые два шага к двум подмассивам слева и справа
-     * от опорного элемента. Рекурсия не применяется к массиву, в котором только
-     * один элемент или отсутствуют элементы.
-     *
-     * В самой простой (и тупой) реализации это будет выглядеть так:
-     * Возьмем для примера {6,6,9,7,2,4}
-     * 1) Опорным всегда выбираем последний элемент, т.е. 4
-     * 2) Проходим по порядку элементы:
-     * 6 > 4 - не трогаем
-     * 6 > 4 - не трогаем
-     * 9 > 4 - не трогаем
-     * 7 > 4 - не трогаем
-     * 2 < 4 - свапаем 6 и 2, итератор места для свапа сдвигаем на +1
-     * Список кончился, свапаем опорный элемент и место для свапа, т.е. 6 и 4
-     * Итого: {2,4,9,7,6,6}
-     * 3) Делим список на 2 подсписка (слева и справа от опорного элемента):
-     * {2}
-     * {9,7,6,6}
-     *
-     * 4) Повторяем весь алгоритм для каждого подсписка (рекурсивно)
-     * {2}:
-     * 1) Ничего не делаем, т.к. один элемент
-     * {9,7,6,6}
-     * 1) Опорный - 6
-     * 2) Проходим по порядку элементы:
-     * 9 > 6 - не трогаем
-     * 7 > 6 - не трогаем
-     * 6 = 6 - свапаем 9 и 6, итератор места для свапа сдвигаем на +1
-     * Список кончился, свапаем опорный элемент и место для свапа, т.е. 7 и 6
-     * Итого: {6,6,9,7}
-     * 3) Делим список на 2 подсписка (слева и справа от опорного элемента):
-     * {6}
-     * {9,7}
-     *
-     * 4) Повторяем весь алгоритм для каждого подсписка (рекурсивно)
-     * {6}:
-     * 1) Ничего не делаем, т.к. один элемент
-     * {9,7}
-     * 1) Опорный - 7
-     * 2) Проходим по порядку элементы:
-     * 9 > 7 - не трогаем
-     * Список кончился, свапаем опорный элемент и место для свапа, т.е. 9 и 7
-     * Итого:
-     * {7,9}
-     * 3) Делим список на 2 подсписка (слева и справа от опорного элемента):
-     * {}
-     * {9}
-     *
-     * Оба списка далее не обрабатываются, т.к. размер не более 1.
-     * Итого у нас отсортированный список: {2,4,6,6,7,9}
-     *
-     *
-     * ПРОБЛЕМЫ И УЛУЧШЕНИЯ
-     * ВАЖНО: Часть пунктов приведены справочно, но реализовано не всё, а только
-     * пункты, которые дают заметный прирост скорости (ведь у нас нет задачи
-     * реализовать идеальную сортировку - тем более часто наш алгоритм и так
-     * быстрее, чем std - см. тесты)
-     *
-     * 1) Сильно деградирует по скорости (до O(n^2)) в худшем или близком к нему
-     * случае, что может случиться при неудачных входных данных. Для
-     * двусвязного списка самый простой и очевидный выбор опорного элемента -
-     * первый или последний.
-     *
-     * 1.1) Неудачные входные данные - уже отсортированный массив. Для
-     * двусвязного списка самый простой и очевидный выбор опорного элемента -
-     * первый или последний. Но если опорный элемент каждый раз оказывается
-     * минимумом или максимумом (что как раз и происходит в отсортированном
-     * массиве), то сортировка максимально деградирует по скорости.
-     * РЕШЕНИЕ: Выбирать в качестве опорного элемента всегда средний элемент
-     * диапазона.
-     *
-     * Данное решение мы РЕАЛИЗУЕМ (см. комментарии по коду).
-     *
-     * 1.2) Неудачные входные данные - специально подобранные плохие данные.
-     * Например, для алгоритма 1.1, их специально подбирают, чтобы средний
-     * элемент оказывался каждый раз минимумом. РЕШЕНИЕ: Случайный выбор
-     * опорного элемента (но желательно в районе центра). Вероятность случайного
-     * возникновения худшего случая становится исчезающе малой, а намеренный
-     * подбор — практически неосуществимым.
-     *
-     * Данное решение мы не РЕАЛИЗУЕМ, т.к. вероятность такого случайного набора
-     * очень мала, а против специальных саботажей в нашем случае бороться
-     * нецелесообразно на мой взгляд.
-     *
-     * 1.3) Вообще чем на более равные части будет делиться массив - тем лучше.
-     * Потому в качестве опорного наиболее эффективно брать медианное значение.
-     * Кроме того это снижает вероятность возникновения худшего случая, по
-     * сравнению с выбором среднего элемента (но не защищает от специально
-     * подобранных данных)
-     *
-     * Данное решение мы не РЕАЛИЗУЕМ, т.к. выигрыш не такой огромный, а
-     * реализация сложнее, чем 1.1.
-     *
-     * ВАЖНО: Недостаток всех усложнённых методов выбора опорного элемента —
-     * дополнительные накладные расходы. НО в целом они не так велики и дают в
-     * среднем прирост скорости.
-     *
-     * 1.4) Неудачные входные данные - в исходном массиве много одинаковых
-     * элементов. Это сильно замедляет алгоритм, ведь равные опорному элементы
-     * также, как и опорный, уже попали на свое место в отсортированном списке,
-     * но мы все равно их передаем на следующие уровни рекурсии.
-     *
-     * РЕШЕНИЕ: Разделять список не на две, а на три части (меньше опорного,
-     * равные опорному, больше опорного). На следующий уровень мы передаём
-     * только списки меньше опорного и больше опорного.
-     *
-     * Данное решение мы РЕАЛИЗУЕМ (см. комментарии по коду).
-     *
-     * 1.5) Касательно выбора опорного элемента - можно реализовать выбор
-     * лучшего значения опорного элемента при обнаружении "плохого" выбора
-     * (если, например, разделение очень неравномерное). Кроме выбора медианного
-     * значения можно использовать медиану медиан ещё.
-     *
-     * Это мы тоже НЕ РЕАЛИЗУЕМ по очевидным причинам
-     *
-     * 2) Прямая реализация в виде функции с двумя рекурсивными вызовами может
-     * привести к ошибке переполнения стека, так как в худшем случае ей может
-     * потребоваться сделать O(n) вложенных рекурсивных вызовов (которые будут
-     * хранить в т.ч. локальные переменные).
-     *
-     * РЕШЕНИЕ: вообще решений существует несколько (в т.ч. довольно сложных,
-     * например, эмулировать стек программно), но мы рассмотрим только вариант
-     * "Разделять список не на две, а на три части". Это сокращает глубину
-     * рекурсии и увеличивает скорость (как описано в 1.4)
-     *
-     * Данное решение мы уже РЕАЛИЗОВАЛИ в 1.4.
-     *
-     * 3) Из-за рекурсии и других "накладных расходов" алгоритм может оказаться
-     * не столь уж быстрым для коротких массивов. Поэтому, если в массиве меньше
-     * N элементов (зависит от реализации, обычно от 3 до 40), вызывается
-     * сортировка вставками. Увеличение скорости может составлять до 15%.
-     *
-     * Данное решение мы не РЕАЛИЗУЕМ, т.к. выигрыш не такой огромный.
-     *
-     * 4) Неустойчивость алгоритма - сортировка меняет относительный порядок
-     * сортируемых элементов, имеющих одинаковое значение.
-     *
-     * РЕШЕНИЕ: Расширение ключа исходным индексом элемента в списке.
-     *
-     * Данное решение мы не РЕАЛИЗУЕМ, т.к. оно только замедлит скорость, а
-     * скорость нам важнее, чем устойчивость (в большинстве задач это не важно).
-     *
-     * @param left Итератор, указывающий на первый элемент сортируемого
-     * диапазона.
-     * @param right Итератор, указывающий на последний элемент сортируемого
-     * диапазона.
-     * @param list_size Количество элементов в сортируемом диапазоне.
+     * @brief Односвязная (по next_) цепочка отцепленных от списка узлов,
+     * которые удаляются все вместе при разрушении объекта
      */
-    void quick_sort(iterator left, iterator right, size_type list_size) {
-        // Выполняем сортировку, если есть что сортировать (в т.ч. это является
-        // условием выхода из рекурсии)
-        if (left != right && list_size > 1) {
-            // Итератор элемента, в который будут свапаться элементы меньше
-            // опорного
-            iterator swap_iterator = left;
-            // Итератор на элемент, являющийся опорным
-            iterator pivot_iterator = left;
-            // Внутренний экземляр итератора, указывающий на начало
-            // обрабатываемого диапазона
-            iterator tmp_left = left;
-            // Внутренний экземляр итератора, указывающий на конец
-            // обрабатываемого диапазона
-            iterator tmp_right = right;
-            // Сдвигаем итераторы на -1, т.к. это законно всегда (у нас
-            // зацикленные итераторы) и этого требует логика нашего алгоритма
-            --swap_iterator;
-            --pivot_iterator;
-            // Целочисленный счетчик, чтобы в процессе считать сдвиги и итоговый
-            // размер
-            size_type ishift = 0;
-            // Выбор опорного элемента (Реализуем выбор среднего элемента)
-            while (ishift < list_size / 2) {
-                ++pivot_iterator;
-                ++ishift;
+    struct RemovedNodes {
+        RemovedNodes() noexcept = default;
+        RemovedNodes(const RemovedNodes &) = delete;
+        RemovedNodes &operator=(const RemovedNodes &) = delete;
+
+        ~RemovedNodes() {
+            while (first_ != nullptr) {
+                delete std::exchange(first_, first_->next_);
             }
-            // Сохраняем полученное значение опорного элемента
-            value_type pivot = *pivot_iterator;
-            // Обнуляем наш счетчик, он нам еще пригодится
-            ishift = 0;
-
-            // Меняем опорный элемент с самым правым в списке, чтобы он не
-            // участвовал в промежуточных перестановках (обход всего списка
-            // никогда не включает в себя самый правый элемент)
-            pivot_iterator.node_->SwapValues(right.node_);
-
-            // Начинаем обход нашего списка, все перемещения элементов делаем
-            // обменом
-            while (tmp_left != tmp_right) {
-                if (*tmp_left < pivot) {
-                    // Все элементы, меньше опорного, закидываем по порядку в
-                    // начало списка
-                    ++swap_iterator;
-                    ++ishift;
-                    tmp_left.node_->SwapValues(swap_iterator.node_);
-                    ++tmp_left;
-                } else if (*tmp_left == pivot) {
-                    // все элементы, равные опорному, закидываем в конец списка,
-                    // начиная с предпоследнего и движемся влево (последнее
-                    // место у нас занимает опорный элемент и он в обходе не
-                    // участвует)
-                    --tmp_right;
-                    tmp_left.node_->SwapValues(tmp_right.node_);
+        }
+
+        node_type *first_ = nullptr;
+    };
+
+    /**
+     * @brief Отцепляет от списка серию из count подряд идущих узлов
+     * [first, last] за одну перепривязку и добавляет её в цепочку removed
+     *
+     * @param first Первый узел серии
+     * @param last Последний узел серии
+     * @param count Количество узлов в серии
+     * @param removed Цепочка удаляемых узлов
+     */
+    void UnlinkRun(node_type *first, node_type *last, size_type count,
+                   RemovedNodes &removed) noexcept {
+        first->prev_->next_ = last->next_;
+        last->next_->prev_ = first->prev_;
+        last->next_ = removed.first_;
+        removed.first_ = first;
+        size_ -= count;
+    }
+
+    /**
+     * @brief Сливает две отсортированные односвязные (по next_) цепочки узлов
+     * first и second, заканчивающиеся nullptr. При равенстве элементов первым
+     * идет элемент из first - это обеспечивает устойчивость sort().
+     *
+     * Если компаратор бросает исключение, все узлы обеих цепочек оказываются
+     * одной цепочкой в first (second становится nullptr).
+     *
+     * @param first Цепочка более ранних элементов
+     * @param second Цепочка более поздних элементов
+     * @param comp Компаратор
+     * @return node_type* Начало объединенной цепочки
+     */
+    template <typename Compare>
+    static node_type *MergeChains(node_type *&first, node_type *&second,
+                                  Compare &comp) {
+        node_type *result = nullptr;
+        node_type **tail = &result;
+        try {
+            // Ссылка next_ переписывается только при переключении между
+            // цепочками: подряд идущие узлы одной цепочки уже связаны
+            while (first != nullptr && second != nullptr) {
+                if (comp(second->value_, first->value_)) {
+                    *tail = second;
+                    do {
+                        tail = &second->next_;
+                        second = second->next_;
+                    } while (second != nullptr &&
+                             comp(second->value_, first->value_));
                 } else {
-                    // В остальных случаях движемся дальше по списку
-                    ++tmp_left;
+                    *tail = first;
+                    do {
+                        tail = &first->next_;
+                        first = first->next_;
+                    } while (first != nullptr &&
+                             !comp(second->value_, first->value_));
                 }
             }
+        } catch (...) {
+            // Уже слитые узлы отрезаются от остатка своей цепочки, и все
+            // узлы отдаются вызывающему одной цепочкой в first
+            *tail = nullptr;
+            first = ConcatChains(result, ConcatChains(first, second));
+            second = nullptr;
+            throw;
+        }
+        *tail = first != nullptr ? first : second;
+        return result;
+    }
 
-            // Далее мы разбиваем наш список на два подсписка.
-            // Итератор на последний элемент первого списка
-            iterator next_step_left = swap_iterator;
-            // Количество элементов в 1м списке
-            size_type next_step_left_size = ishift;
-            // Количество элементов во 2м списке
-            size_type next_step_right_size = list_size - ishift - 1;
-
-            // Переносим все элементы из конца списка, равные опорному, после
-            // последнего элемента, меньше опорного
-            ++swap_iterator;
-            while (tmp_right != right) {
-                swap_iterator.node_->SwapValues(tmp_right.node_);
-                ++swap_iterator;
-                ++tmp_right;
-                --next_step_right_size;
-            }
-
-            // Переносим наш опорный элемент из конца списка к другим элементам,
-            // равным ему
-            swap_iterator.node_->SwapValues(right.node_);
-            ++swap_iterator;
-
-            // Итератор на первый элемент второго списка
-            iterator next_step_right = swap_iterator;
+    /**
+     * @brief Приписывает цепочку second (заканчивается nullptr) в конец
+     * цепочки first
+     *
+     * @return node_type* Начало общей цепочки
+     */
+    static node_type *ConcatChains(node_type *first,
+                                   node_type *second) noexcept {
+        if (first == nullptr) {
+            return second;
+        }
+        node_type *last = first;
+        while (last->next_ != nullptr) {
+            last = last->next_;
+        }
+        last->next_ = second;
+        return first;
+    }
 
-            // Вызываем рекурсивно эту же функцию для обоих полученных
-            // подсписков Если подсписки пустые - ничего страшного, внутри есть
-            // проверка на это
-            quick_sort(left, next_step_left, next_step_left_size);
-            quick_sort(next_step_right, right, next_step_right_size);
+    /**
+     * @brief Делает цепочку узлов chain (заканчивается nullptr) содержимым
+     * кольцевого списка, восстанавливая ссылки prev_
+     *
+     * @param chain Все узлы списка
+     */
+    void RelinkChain(node_type *chain) noexcept {
+        node_type *prev = head_;
+        for (node_type *node = chain; node != nullptr; node = node->next_) {
+            prev->next_ = node;
+            node->prev_ = prev;
+            prev = node;
         }
+        prev->next_ = head_;
+        head_->prev_ = prev;
     }
 
     /**
@@ -906,24 +1165,25 @@ class list {
         ListNode() noexcept : next_(this), prev_(this), value_(value_type{}) {
         }
         /**
-         * @brief Конструктор, создающий узел списка, инициализированный
-         * значением value
+         * @brief Конструктор, создающий значение узла прямо на месте из args
+         * (см. emplace()). Тег std::in_place не дает спутать его с
+         * копирующим конструктором узла
          *
-         * @param value значение для инициализации узла
+         * @param args аргументы для конструктора значения
          */
-        explicit ListNode(const_reference value) noexcept
-            : next_(nullptr), prev_(nullptr), value_(value) {
+        template <typename... Args>
+        explicit ListNode(std::in_place_t, Args &&...args)
+            : next_(nullptr), prev_(nullptr),
+              value_(std::forward<Args>(args)...) {
         }
+
         /**
-         * @brief Конструктор, создающий узел списка, инициализированный
-         * значением value, используя move-семантику. Очень актуально для тех
-         * случаев, когда для создания узла используется временный уже
-         * сконструированный объект, например, в emplace()
+         * @brief Значение узла (используется дескриптором узла)
          *
-         * @param value значение для инициализации узла
+         * @return value_type&
          */
-        explicit ListNode(value_type &&value) noexcept
-            : next_(nullptr), prev_(nullptr), value_(std::move(value)) {
+        value_type &Value() noexcept {
+            return value_;
         }
 
         /**
@@ -932,29 +1192,14 @@ class list {
          * @param new_node Встраиваемый узел
          */
         void AttachPrev(node_type *new_node) noexcept {
-            new_node->next_ = this;
-            new_node->prev_ = prev_;
-            prev_->next_ = new_node;
-            prev_ = new_node;
+            ListAlgorithms<node_type>::LinkBefore(this, new_node);
         }
 
         /**
          * @brief Изымает узел из списка
          */
         void UnAttach() noexcept {
-            prev_->next_ = next_;
-            next_->prev_ = prev_;
-            next_ = this;
-            prev_ = this;
-        }
-
-        /**
-         * @brief Меняет значения текущего узла и узла other_node
-         *
-         * @param other_node
-         */
-        void SwapValues(node_type *other_node) noexcept {
-            std::swap(value_, other_node->value_);
+            ListAlgorithms<node_type>::Unlink(this);
         }
 
         /**
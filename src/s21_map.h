@@ -34,7 +34,10 @@
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_MAP_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_MAP_H_
 
+#include <iterator>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 
 #include "s21_tree.h"
 
@@ -63,6 +66,20 @@ class map {
         }
     };
 
+    // Компаратор для поиска по ключу без создания пары ключ-значение
+    // (см. методы дерева Find(key, less) и FindOrEmplace())
+    struct MapKeyComparator {
+        bool operator()(const_reference value,
+                        const key_type &key) const noexcept {
+            return value.first < key;
+        }
+
+        bool operator()(const key_type &key,
+                        const_reference value) const noexcept {
+            return key < value.first;
+        }
+    };
+
     // Внутренний класс для дерева
     using tree_type = RedBlackTree<value_type, MapValueComparator>;
     // Внутренний класс для итератора
@@ -71,6 +88,10 @@ class map {
     using const_iterator = typename tree_type::const_iterator;
     // Тип для размера контейнера
     using size_type = std::size_t;
+    // Дескриптор извлеченного узла (см. s21_node_handle.h)
+    using node_handle = typename tree_type::node_handle;
+    // Результат вставки дескриптора узла
+    using insert_return_type = typename tree_type::insert_return_type;
 
     /**
      * @brief Конструктор по умолчанию, создает пустой словарь
@@ -90,6 +111,37 @@ class map {
         }
     }
 
+    /**
+     * @brief Конструктор из диапазона, создает словарь из пар ключ-значение
+     * [first, last).
+     * @details Вместо поэлементной вставки дерево строится сразу
+     * сбалансированным из отсортированных элементов (см. метод Build()
+     * реализации дерева). Из нескольких элементов с эквивалентными ключами
+     * остается первый.
+     *
+     * @param first Начало диапазона
+     * @param last Конец диапазона
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<
+                                    InputIt>::iterator_category>
+    map(InputIt first, InputIt last) : map() {
+        tree_->Build(first, last, true);
+    }
+
+    /**
+     * @brief Параллельная версия конструктора из диапазона: сортировка,
+     * создание узлов и построение дерева выполняются на потоках пула.
+     *
+     * @param first Начало диапазона
+     * @param last Конец диапазона
+     * @param policy Политика параллельного выполнения
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<
+                                    InputIt>::iterator_category>
+    map(InputIt first, InputIt last, parallel_policy policy) : map() {
+        tree_->Build(first, last, true, policy.pool_);
+    }
+
     /**
      * @brief Конструктор копирования (Copy Constructor). Создает словарь путем
      * копирования данных из объекта other.
@@ -150,8 +202,7 @@ class map {
      * @return mapped_type&
      */
     mapped_type &at(const key_type &key) {
-        value_type search_pair(key, mapped_type{});
-        iterator it_search = tree_->Find(search_pair);
+        iterator it_search = tree_->Find(key, MapKeyComparator{});
 
         if (it_search == end()) {
             throw std::out_of_range(
@@ -176,8 +227,9 @@ class map {
      * такого элемента нет, то выполняется вставка нового элемента
      * value_type(key, mapped_type{}).
      *
-     * @details If an exception is thrown by any operation, the insertion has no
-     * effect
+     * @details Выполняется один спуск по дереву (см. try_emplace()).
+     * Значение по умолчанию создается только при вставке. If an exception is
+     * thrown by any operation, the insertion has no effect
      *
      * @param key
      * @return mapped_type& Ссылка на значение нового элемента, если не
@@ -186,15 +238,18 @@ class map {
      * эквивалентен ключу.
      */
     mapped_type &operator[](const key_type &key) {
-        value_type search_pair(key, mapped_type{});
-        iterator it_search = tree_->Find(search_pair);
+        return (*try_emplace(key).first).second;
+    }
 
-        if (it_search == end()) {
-            std::pair<iterator, bool> result = tree_->InsertUnique(search_pair);
-            return (*result.first).second;
-        } else {
-            return (*it_search).second;
-        }
+    /**
+     * @brief Версия operator[]() для временного ключа: при вставке ключ
+     * перемещается в новый элемент
+     *
+     * @param key
+     * @return mapped_type&
+     */
+    mapped_type &operator[](key_type &&key) {
+        return (*try_emplace(std::move(key)).first).second;
     }
 
     /**
@@ -317,26 +372,62 @@ class map {
      * присваивает obj элементу, соответствующему ключу key. Если ключ не
      * существует, вставляет новое значение value_type(key, obj)
      *
-     * @todo Работает медленнее оригинала с -O3 для 200000 элементов:
-     * std: 31.847 ms
-     * s21: 48.19 ms
-     * Вероятно, необходимо избавится от лишнего прохода по дереву (Find -
-     * первый проход, InsertUnique - второй)
+     * @details Выполняется один спуск по дереву (см. try_emplace()), при
+     * промахе элемент создается сразу в узле дерева.
+     *
      * @param key
      * @param obj
-     * @return std::pair<iterator, bool>
+     * @return std::pair<iterator, bool> Итератор на элемент и true, если
+     * произошла вставка (false, если было присваивание)
      */
     std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                                const mapped_type &obj) {
-        iterator result = tree_->Find(value_type{key, obj});
-
-        if (result == end()) {
-            return tree_->InsertUnique(value_type{key, obj});
+        std::pair<iterator, bool> result = try_emplace(key, obj);
+        if (!result.second) {
+            (*result.first).second = obj;
         }
+        return result;
+    }
 
-        (*result).second = obj;
+    /**
+     * @brief Если в контейнере нет элемента с ключом key, то вставляет
+     * элемент, значение которого конструируется на месте из args. Иначе
+     * ничего не делает - args не используются (в т.ч. не перемещаются).
+     *
+     * @details Поиск и вставка выполняются за один спуск по дереву (см. метод
+     * FindOrEmplace() реализации дерева): при промахе место вставки уже
+     * известно, а пара ключ-значение конструируется прямо в новом узле.
+     *
+     * @tparam Args Типы аргументов конструктора mapped_type
+     * @param key Ключ
+     * @param args Аргументы конструктора значения
+     * @return std::pair<iterator, bool> Итератор на элемент с ключом key и
+     * true, если элемент был вставлен
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key,
+                                          Args &&...args) {
+        return tree_->FindOrEmplace(
+            key, MapKeyComparator{}, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+    }
 
-        return {result, false};
+    /**
+     * @brief Версия try_emplace() для временного ключа: при вставке ключ
+     * перемещается в новый элемент
+     *
+     * @tparam Args Типы аргументов конструктора mapped_type
+     * @param key Ключ
+     * @param args Аргументы конструктора значения
+     * @return std::pair<iterator, bool>
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+        return tree_->FindOrEmplace(
+            key, MapKeyComparator{}, std::piecewise_construct,
+            std::forward_as_tuple(std::move(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
     }
 
     /**
@@ -350,6 +441,42 @@ class map {
         tree_->Erase(pos);
     }
 
+    /**
+     * @brief Извлекает элемент на позиции pos из контейнера вместе с узлом,
+     * не удаляя его. Узел можно вставить в другой контейнер того же типа
+     * методом insert(node_handle &&) без выделения памяти.
+     *
+     * @param pos
+     * @return node_handle Дескриптор узла
+     */
+    node_handle extract(iterator pos) noexcept {
+        return tree_->Extract(pos);
+    }
+
+    /**
+     * @brief Извлекает элемент с ключом, эквивалентным key (см. extract()).
+     * Ключ извлеченного элемента можно изменить через node_handle::key() и
+     * вставить узел обратно - без удаления и создания элемента.
+     *
+     * @param key
+     * @return node_handle Дескриптор узла (пустой, если элемента нет)
+     */
+    node_handle extract(const key_type &key) {
+        return tree_->Extract(tree_->Find(key, MapKeyComparator{}));
+    }
+
+    /**
+     * @brief Вставляет узел из дескриптора node, если контейнер ещё не
+     * содержит элемент с эквивалентным ключом. Память не выделяется.
+     *
+     * @param node Дескриптор узла, полученный из extract()
+     * @return insert_return_type Позиция, признак вставки и (если вставка не
+     * произошла) сам узел
+     */
+    insert_return_type insert(node_handle &&node) {
+        return tree_->InsertUnique(std::move(node));
+    }
+
     /**
      * @brief Обменяет содержимое контейнера на содержимое other
      *
@@ -372,6 +499,83 @@ class map {
         tree_->MergeUnique(*other.tree_);
     }
 
+    /**
+     * @brief Параллельная версия merge().
+     * @details Детали реализации описаны в методе MergeUnique() реализации
+     * дерева.
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     */
+    void merge(map &other, parallel_policy policy) {
+        tree_->MergeUnique(*other.tree_, *policy.pool_);
+    }
+
+    /**
+     * @brief Возвращает словарь, содержащий элементы this и элементы other,
+     * ключей которых нет в this (при совпадении ключей значение берется из
+     * this).
+     *
+     * @param other
+     * @return map
+     */
+    map set_union(const map &other) const {
+        return map(tree_->Union(*other.tree_));
+    }
+
+    /**
+     * @brief Параллельная версия set_union()
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     * @return map
+     */
+    map set_union(const map &other, parallel_policy policy) const {
+        return map(tree_->Union(*other.tree_, policy.pool_));
+    }
+
+    /**
+     * @brief Возвращает словарь из элементов this, ключи которых есть в other.
+     *
+     * @param other
+     * @return map
+     */
+    map set_intersection(const map &other) const {
+        return map(tree_->Intersection(*other.tree_));
+    }
+
+    /**
+     * @brief Параллельная версия set_intersection()
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     * @return map
+     */
+    map set_intersection(const map &other, parallel_policy policy) const {
+        return map(tree_->Intersection(*other.tree_, policy.pool_));
+    }
+
+    /**
+     * @brief Возвращает словарь из элементов this, ключей которых нет в other.
+     *
+     * @param other
+     * @return map
+     */
+    map set_difference(const map &other) const {
+        return map(tree_->Difference(*other.tree_));
+    }
+
+    /**
+     * @brief Параллельная версия set_difference()
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     * @return map
+     */
+    map set_difference(const map &other, parallel_policy policy) const {
+        return map(tree_->Difference(*other.tree_, policy.pool_));
+    }
+
     /**
      * @brief Проверяет, есть ли в контейнере элемент с ключом, эквивалентным
      * key.
@@ -381,9 +585,7 @@ class map {
      * @return false Нет
      */
     bool contains(const key_type &key) const noexcept {
-        value_type search_pair(key, mapped_type{});
-        iterator it_search = tree_->Find(search_pair);
-        return !(it_search == end());
+        return tree_->Find(key, MapKeyComparator{}) != tree_->End();
     }
 
     /**
@@ -407,6 +609,14 @@ class map {
     }
 
   private:
+    /**
+     * @brief Создает словарь, забирая содержимое готового дерева tree
+     *
+     * @param tree
+     */
+    explicit map(tree_type &&tree) : tree_(new tree_type(std::move(tree))) {
+    }
+
     // Указатель на объект созданного дерева, используемого в контейнере
     tree_type *tree_;
 };
@@ -0,0 +1,332 @@
+/**
+ * @file s21_mpmc_queue.h
+ * @brief s21::mpmc_queue - ограниченная lock-free очередь для нескольких
+ * производителей и нескольких потребителей (схема Д. Вьюкова).
+ *
+ * @details Кольцевой буфер из степени двойки ячеек, у каждой ячейки свой
+ * номер последовательности sequence_:
+ * - sequence_ == pos - ячейка свободна и ждет записи с позицией pos;
+ * - sequence_ == pos + 1 - в ячейке лежит элемент с позицией pos;
+ * - после чтения sequence_ = pos + capacity, ячейка ждет запись следующего
+ * круга.
+ *
+ * Производители соревнуются за enqueue_pos_ (CAS), потребители - за
+ * dequeue_pos_; победитель работает со своей ячейкой без блокировок и
+ * публикует результат записью sequence_. Производители и потребители не
+ * трогают счетчики друг друга, поэтому при наличии и элементов, и места обе
+ * стороны работают параллельно.
+ *
+ * Элемент должен перемещаться без исключений: ячейка, занятая CAS, обязана
+ * быть заполнена (освобождена), иначе очередь остановится на ней. Если
+ * конструктор из аргументов emplace может бросить исключение, элемент
+ * сначала создается вне очереди.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_MPMC_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_MPMC_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+#include "s21_wait_strategy.h"
+
+namespace s21 {
+/**
+ * @brief Очередь нескольких производителей и потребителей
+ *
+ * @tparam T Тип элемента
+ * @tparam Wait Стратегия ожидания блокирующих push()/pop() (см.
+ * s21_wait_strategy.h)
+ */
+template <typename T, typename Wait = yield_wait>
+class mpmc_queue {
+    static_assert(std::is_nothrow_move_constructible_v<T> &&
+                      std::is_nothrow_move_assignable_v<T>,
+                  "s21::mpmc_queue requires a nothrow movable element type");
+
+  public:
+    // Тип элемента
+    using value_type = T;
+    // Тип ссылки на элемент
+    using reference = T &;
+    // Тип константной ссылки на элемент
+    using const_reference = const T &;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+    // Стратегия ожидания
+    using wait_strategy = Wait;
+
+    /**
+     * @brief Создает очередь
+     *
+     * @param capacity Минимальная емкость, округляется вверх до степени двойки
+     * (не меньше 2)
+     */
+    explicit mpmc_queue(size_type capacity = 1024)
+        : capacity_(RoundUpToPowerOfTwo(capacity)),
+          mask_(capacity_ - 1),
+          cells_(new Cell[capacity_]) {
+        for (size_type i = 0; i < capacity_; ++i) {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_queue(const mpmc_queue &) = delete;
+    mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+    /**
+     * @brief Деструктор удаляет оставшиеся элементы. Все потоки к этому
+     * моменту должны закончить работу с очередью
+     */
+    ~mpmc_queue() {
+        size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+        for (size_type pos = dequeue_pos_.load(std::memory_order_acquire);
+             pos != tail; ++pos) {
+            cells_[pos & mask_].Value()->~value_type();
+        }
+        delete[] cells_;
+    }
+
+    /**
+     * @brief Емкость очереди (степень двойки)
+     */
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Приблизительное количество элементов: счетчики читаются не
+     * одновременно, а элемент, место под который уже занято, еще может
+     * записываться
+     */
+    size_type size_approx() const noexcept {
+        size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+        size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+        std::ptrdiff_t size = static_cast<std::ptrdiff_t>(tail - head);
+        if (size <= 0) {
+            return 0;
+        }
+        return std::min(static_cast<size_type>(size), capacity_);
+    }
+
+    bool empty() const noexcept {
+        return size_approx() == 0;
+    }
+
+    /**
+     * @brief Создает элемент в конце очереди из args, если есть место
+     *
+     * @return false Очередь полна, ничего не создано
+     */
+    template <typename... Args>
+    bool try_emplace(Args &&...args) {
+        if constexpr (std::is_nothrow_constructible_v<value_type, Args...>) {
+            Cell *cell = ClaimForWrite();
+            if (cell == nullptr) {
+                return false;
+            }
+            Fill(cell, std::forward<Args>(args)...);
+            return true;
+        } else {
+            value_type value(std::forward<Args>(args)...);
+            return try_emplace(std::move(value));
+        }
+    }
+
+    bool try_push(const_reference value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(value_type &&value) noexcept {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief Создает элемент в конце очереди из args, при необходимости
+     * дожидаясь места
+     */
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        if constexpr (std::is_nothrow_constructible_v<value_type, Args...>) {
+            Cell *cell = ClaimForWrite();
+            if (cell == nullptr) {
+                not_full_.Wait([this, &cell] {
+                    cell = ClaimForWrite();
+                    return cell != nullptr;
+                });
+            }
+            Fill(cell, std::forward<Args>(args)...);
+        } else {
+            value_type value(std::forward<Args>(args)...);
+            emplace(std::move(value));
+        }
+    }
+
+    void push(const_reference value) {
+        emplace(value);
+    }
+
+    void push(value_type &&value) noexcept {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Переносит первый элемент в value и удаляет его, если очередь не
+     * пуста
+     *
+     * @return false Очередь пуста, value не изменен
+     */
+    bool try_pop(reference value) noexcept {
+        Cell *cell = ClaimForRead();
+        if (cell == nullptr) {
+            return false;
+        }
+        Take(cell, value);
+        return true;
+    }
+
+    /**
+     * @brief Переносит первый элемент в value и удаляет его, при
+     * необходимости дожидаясь элемента. В отличие от s21::queue, front() и
+     * pop() без аргументов нет: между ними элемент мог бы забрать другой поток
+     */
+    void pop(reference value) noexcept {
+        Cell *cell = ClaimForRead();
+        if (cell == nullptr) {
+            not_empty_.Wait([this, &cell] {
+                cell = ClaimForRead();
+                return cell != nullptr;
+            });
+        }
+        Take(cell, value);
+    }
+
+  private:
+    struct Cell {
+        value_type *Value() noexcept {
+            return std::launder(reinterpret_cast<value_type *>(storage_));
+        }
+
+        // Номер последовательности, см. описание файла
+        std::atomic<size_type> sequence_;
+        // Память под элемент
+        alignas(value_type) unsigned char storage_[sizeof(value_type)];
+    };
+
+    static size_type RoundUpToPowerOfTwo(size_type value) {
+        if (value > (static_cast<size_type>(-1) >> 1) / sizeof(Cell)) {
+            throw std::length_error("s21::mpmc_queue Capacity is too large");
+        }
+        size_type result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Занимает ячейку для записи
+     *
+     * @return Cell* Занятая ячейка или nullptr, если очередь полна
+     */
+    Cell *ClaimForWrite() noexcept {
+        size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell *cell = &cells_[pos & mask_];
+            size_type sequence =
+                cell->sequence_.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    return cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Занимает ячейку с первым элементом для чтения
+     *
+     * @return Cell* Занятая ячейка или nullptr, если очередь пуста
+     */
+    Cell *ClaimForRead() noexcept {
+        size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell *cell = &cells_[pos & mask_];
+            size_type sequence =
+                cell->sequence_.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    return cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Создает элемент в занятой ячейке и публикует его
+     */
+    template <typename... Args>
+    void Fill(Cell *cell, Args &&...args) noexcept {
+        ::new (static_cast<void *>(cell->storage_))
+            value_type(std::forward<Args>(args)...);
+        // Ячейка занята позицией pos == sequence_
+        cell->sequence_.store(
+            cell->sequence_.load(std::memory_order_relaxed) + 1,
+            std::memory_order_release);
+        not_empty_.Notify();
+    }
+
+    /**
+     * @brief Забирает элемент из занятой ячейки и освобождает ее для
+     * следующего круга
+     */
+    void Take(Cell *cell, reference value) noexcept {
+        value_type *item = cell->Value();
+        value = std::move(*item);
+        item->~value_type();
+        // sequence_ == pos + 1, следующая запись в ячейку - pos + capacity
+        cell->sequence_.store(
+            cell->sequence_.load(std::memory_order_relaxed) + mask_,
+            std::memory_order_release);
+        not_full_.Notify();
+    }
+
+    // Неизменяемые после создания поля, которые читают все потоки
+    const size_type capacity_;
+    const size_type mask_;
+    Cell *const cells_;
+
+    // Позиция следующей записи
+    alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_{0};
+    // Позиция следующего чтения
+    alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_{0};
+    // Ожидание элементов (ждут потребители, уведомляют производители)
+    alignas(kCacheLineSize) Wait not_empty_;
+    // Ожидание места (ждут производители, уведомляют потребители)
+    alignas(kCacheLineSize) Wait not_full_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_MPMC_QUEUE_H_
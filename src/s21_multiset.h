@@ -53,6 +53,8 @@ class multiset {
     using const_iterator = typename tree_type::const_iterator;
     // Тип для размера контейнера
     using size_type = std::size_t;
+    // Дескриптор извлеченного узла (см. s21_node_handle.h)
+    using node_handle = typename tree_type::node_handle;
 
     /**
      * @brief Конструктор по умолчанию, создает пустое мультимножество
@@ -231,6 +233,41 @@ class multiset {
         tree_->Erase(pos);
     }
 
+    /**
+     * @brief Извлекает элемент на позиции pos из контейнера вместе с узлом,
+     * не удаляя его. Узел можно вставить в другой контейнер того же типа
+     * методом insert(node_handle &&) без выделения памяти.
+     *
+     * @param pos
+     * @return node_handle Дескриптор узла
+     */
+    node_handle extract(iterator pos) noexcept {
+        return tree_->Extract(pos);
+    }
+
+    /**
+     * @brief Извлекает элемент с ключом, эквивалентным key (см. extract())
+     *
+     * @param key
+     * @return node_handle Дескриптор узла (пустой, если элемента нет)
+     */
+    node_handle extract(const key_type &key) {
+        return tree_->Extract(key);
+    }
+
+    /**
+     * @brief Вставляет узел из дескриптора node. Если в контейнере есть
+     * элементы с эквивалентным ключом, вставка выполняется по верхней границе
+     * этого диапазона. Память не выделяется.
+     *
+     * @param node Дескриптор узла, полученный из extract()
+     * @return iterator Итератор на вставленный элемент (end() для пустого
+     * дескриптора)
+     */
+    iterator insert(node_handle &&node) {
+        return tree_->Insert(std::move(node));
+    }
+
     /**
      * @brief Обменяет содержимое контейнера на содержимое other
      *
@@ -0,0 +1,186 @@
+/**
+ * @file s21_node_handle.h
+ * @brief Дескриптор узла (node handle) - владеющий указатель на узел,
+ * извлеченный из контейнера методом extract().
+ *
+ * @details Дескриптор позволяет перенести элемент из одного контейнера в
+ * другой (того же типа) без копирования значения и без повторного выделения
+ * памяти: extract() отцепляет узел от контейнера, insert() встраивает этот же
+ * узел в другой (или тот же) контейнер. Пока узел находится в дескрипторе, его
+ * значение можно изменить, в т.ч. ключ элемента словаря - это позволяет
+ * поменять ключ элемента без удаления и создания узла.
+ *
+ * Если дескриптор уничтожается непустым, то узел удаляется вместе с ним.
+ *
+ * В отличие от std, тип дескриптора называется node_handle, т.к. имя
+ * node_type в s21::list уже занято внутренним классом узла.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_NODE_HANDLE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_NODE_HANDLE_H_
+
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+template <typename Key, typename Comparator>
+class RedBlackTree;
+template <typename Type>
+class list;
+
+/**
+ * @brief Дескриптор узла
+ *
+ * @tparam Node Тип узла контейнера. Узел должен предоставлять метод Value(),
+ * возвращающий ссылку на хранимое значение
+ * @tparam Value Тип значения узла
+ */
+template <typename Node, typename Value>
+class NodeHandle {
+  public:
+    // Тип значения узла
+    using value_type = Value;
+
+    /**
+     * @brief Конструктор по умолчанию, создает пустой дескриптор
+     */
+    NodeHandle() noexcept : node_(nullptr) {
+    }
+
+    NodeHandle(const NodeHandle &) = delete;
+    NodeHandle &operator=(const NodeHandle &) = delete;
+
+    /**
+     * @brief Конструктор переноса: забирает узел у other, other становится
+     * пустым
+     *
+     * @param other
+     */
+    NodeHandle(NodeHandle &&other) noexcept
+        : node_(std::exchange(other.node_, nullptr)) {
+    }
+
+    /**
+     * @brief Присваивание переносом: удаляет свой узел (если есть) и забирает
+     * узел у other
+     *
+     * @param other
+     * @return NodeHandle&
+     */
+    NodeHandle &operator=(NodeHandle &&other) noexcept {
+        if (this != &other) {
+            delete node_;
+            node_ = std::exchange(other.node_, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Деструктор удаляет узел, если он так и не был вставлен в
+     * контейнер
+     */
+    ~NodeHandle() {
+        delete node_;
+    }
+
+    /**
+     * @brief Проверяет, пустой ли дескриптор
+     *
+     * @return true узла нет
+     * @return false дескриптор владеет узлом
+     */
+    bool empty() const noexcept {
+        return node_ == nullptr;
+    }
+
+    explicit operator bool() const noexcept {
+        return node_ != nullptr;
+    }
+
+    /**
+     * @brief Значение узла (для set, multiset и list). Поведение не определено
+     * для пустого дескриптора
+     *
+     * @return value_type&
+     */
+    value_type &value() const noexcept {
+        return node_->Value();
+    }
+
+    /**
+     * @brief Ключ элемента словаря. В отличие от ссылки на элемент словаря в
+     * контейнере, ключ можно изменить - узел сейчас не принадлежит ни одному
+     * дереву, а при вставке он будет размещен уже по новому ключу.
+     *
+     * @return Неконстантная ссылка на ключ
+     */
+    template <typename V = Value>
+    std::remove_const_t<typename V::first_type> &key() const noexcept {
+        // Ключ в паре объявлен константным, чтобы его нельзя было изменить,
+        // пока узел находится в дереве. Здесь узел отцеплен, поэтому снимаем
+        // константность так же, как это делают реализации std
+        return const_cast<std::remove_const_t<typename V::first_type> &>(
+            node_->Value().first);
+    }
+
+    /**
+     * @brief Сопоставленное значение элемента словаря
+     *
+     * @return Ссылка на значение
+     */
+    template <typename V = Value>
+    typename V::second_type &mapped() const noexcept {
+        return node_->Value().second;
+    }
+
+    /**
+     * @brief Обменивает узлы дескрипторов
+     *
+     * @param other
+     */
+    void swap(NodeHandle &other) noexcept {
+        std::swap(node_, other.node_);
+    }
+
+  private:
+    template <typename Key, typename Comparator>
+    friend class RedBlackTree;
+    template <typename Type>
+    friend class list;
+
+    explicit NodeHandle(Node *node) noexcept : node_(node) {
+    }
+
+    /**
+     * @brief Отдает узел контейнеру, дескриптор становится пустым
+     *
+     * @return Node*
+     */
+    Node *Release() noexcept {
+        return std::exchange(node_, nullptr);
+    }
+
+    // Узел, которым владеет дескриптор
+    Node *node_;
+};
+
+/**
+ * @brief Результат вставки дескриптора в контейнер с уникальными ключами
+ *
+ * @details Если вставка не произошла (элемент с эквивалентным ключом уже
+ * есть), то узел возвращается обратно в поле node, а position указывает на
+ * элемент, который помешал вставке.
+ */
+template <typename Iterator, typename Handle>
+struct InsertReturnType {
+    // Вставленный элемент или элемент, который помешал вставке
+    Iterator position;
+    // true, если вставка произошла
+    bool inserted;
+    // Невставленный узел (пустой, если вставка произошла)
+    Handle node;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_NODE_HANDLE_H_
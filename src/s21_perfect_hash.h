@@ -0,0 +1,271 @@
+/**
+ * @file s21_perfect_hash.h
+ * @brief s21::perfect_hash_map - read-only map from a fixed set of keys,
+ * built in a constant expression, with a collision-free O(1) lookup
+ *
+ * @details The table is found with "hash, displace and compress": keys are
+ * split into buckets by a first hash, then, biggest bucket first, every bucket
+ * gets the smallest seed that sends all its keys to still free slots of the
+ * table. A lookup is two hashes, one slot and one key comparison:
+ *
+ *     constexpr std::pair<std::string_view, int> kRoutes[] = {
+ *         {"/users", 1}, {"/orders", 2}, {"/health", 3}};
+ *     constexpr auto kTable = s21::make_perfect_hash_map(kRoutes);
+ *     static_assert(*kTable.find("/orders") == 2);
+ *
+ * Built in a constexpr variable, the table costs nothing at start-up (with
+ * C++20 the variable can also be constinit). Duplicate keys, or a key set no
+ * seed can separate, throw - at compile time that is a compile error.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_PERFECT_HASH_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_PERFECT_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "s21_algorithm.h"
+#include "s21_array.h"
+
+namespace s21 {
+
+/**
+ * @brief Seeded hash usable in constant expressions, for integers, enums and
+ * std::string_view. Specialize it for other key types
+ */
+template <typename Key, typename = void>
+struct constexpr_hash;
+
+template <typename Key>
+struct constexpr_hash<Key, std::enable_if_t<std::is_integral_v<Key> ||
+                                            std::is_enum_v<Key>>> {
+    constexpr std::uint64_t operator()(Key key,
+                                       std::uint64_t seed) const noexcept {
+        // splitmix64 finalizer
+        std::uint64_t x = static_cast<std::uint64_t>(key) +
+                          (seed + 1) * 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+};
+
+template <>
+struct constexpr_hash<std::string_view> {
+    constexpr std::uint64_t operator()(std::string_view key,
+                                       std::uint64_t seed) const noexcept {
+        // FNV-1a, seeded through the offset basis
+        std::uint64_t x =
+            0xCBF29CE484222325ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+        for (char c : key) {
+            x = (x ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+        }
+        return constexpr_hash<std::uint64_t>()(x, seed);
+    }
+};
+
+/**
+ * @tparam Key literal key type comparable with ==
+ * @tparam Value literal value type, default constructible
+ * @tparam N number of keys
+ * @tparam Hash seeded hash, see constexpr_hash
+ */
+template <typename Key, typename Value, std::size_t N,
+          typename Hash = constexpr_hash<Key>>
+class perfect_hash_map {
+  public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+
+  private:
+    // Slots: a power of two with at least 20% free, so a seed is quick to find
+    static constexpr size_type TableSize() noexcept {
+        size_type size = 1;
+        while (size < N + N / 4 + 1) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    static constexpr size_type kSlots = TableSize();
+    static constexpr size_type kBuckets = N / 2 + 1;
+    // Seeds tried per bucket before giving up
+    static constexpr std::uint32_t kMaxSeed = 1U << 16;
+
+  public:
+    /**
+     * @brief Builds the table from the (key, value) pairs in items
+     *
+     * @throw std::invalid_argument two items have the same key
+     * @throw std::logic_error no seed separates the keys of some bucket
+     */
+    constexpr explicit perfect_hash_map(
+        const array<std::pair<Key, Value>, N> &items) {
+        Build(items.data());
+    }
+
+    constexpr explicit perfect_hash_map(
+        const std::pair<Key, Value> (&items)[N]) {
+        Build(items);
+    }
+
+    /**
+     * @brief Pointer to the value of key, nullptr if the key is not in the
+     * table
+     */
+    constexpr const Value *find(const Key &key) const noexcept {
+        size_type slot = SlotOf(key, seeds_.data()[BucketOf(key)]);
+        if (used_.data()[slot] && keys_.data()[slot] == key) {
+            return values_.data() + slot;
+        }
+        return nullptr;
+    }
+
+    constexpr bool contains(const Key &key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Value of key
+     *
+     * @throw std::out_of_range if the key is not in the table
+     */
+    constexpr const Value &at(const Key &key) const {
+        const Value *value = find(key);
+        if (value == nullptr) {
+            throw std::out_of_range(
+                "s21::perfect_hash_map::at The key is not in the table");
+        }
+        return *value;
+    }
+
+    [[nodiscard]] static constexpr size_type size() noexcept {
+        return N;
+    }
+
+    [[nodiscard]] static constexpr bool empty() noexcept {
+        return N == 0;
+    }
+
+  private:
+    // std::pair assignment isn't constexpr before C++20, so the items are
+    // only read through a pointer and never copied as pairs
+    using item_type = std::pair<Key, Value>;
+
+    constexpr void Build(const item_type *items) {
+        // Items of each bucket, bucket by bucket
+        array<size_type, N> order{};
+        array<size_type, kBuckets + 1> bucket_start{};
+        for (size_type i = 0; i < N; ++i) {
+            ++bucket_start.data()[BucketOf(items[i].first) + 1];
+        }
+        for (size_type b = 0; b < kBuckets; ++b) {
+            bucket_start.data()[b + 1] += bucket_start.data()[b];
+        }
+        array<size_type, kBuckets + 1> fill = bucket_start;
+        for (size_type i = 0; i < N; ++i) {
+            order.data()[fill.data()[BucketOf(items[i].first)]++] = i;
+        }
+
+        // Biggest buckets first: they are the hardest to place
+        array<size_type, kBuckets> buckets{};
+        for (size_type b = 0; b < kBuckets; ++b) {
+            buckets.data()[b] = b;
+        }
+        const size_type *start = bucket_start.data();
+        s21::sort(buckets.begin(), buckets.end(),
+                  [start](size_type lhs, size_type rhs) {
+                      return start[lhs + 1] - start[lhs] >
+                             start[rhs + 1] - start[rhs];
+                  });
+
+        for (size_type b : buckets) {
+            const size_type *first = order.data() + start[b];
+            const size_type *last = order.data() + start[b + 1];
+            PlaceBucket(items, b, first, last);
+        }
+    }
+
+    static constexpr size_type BucketOf(const Key &key) noexcept {
+        return static_cast<size_type>(Hash()(key, 0) % kBuckets);
+    }
+
+    static constexpr size_type SlotOf(const Key &key,
+                                      std::uint32_t seed) noexcept {
+        return static_cast<size_type>(Hash()(key, seed) & (kSlots - 1));
+    }
+
+    /**
+     * @brief Finds a seed that sends the items [first, last) of bucket b to
+     * distinct free slots and stores them there
+     */
+    constexpr void PlaceBucket(const item_type *items, size_type b,
+                               const size_type *first, const size_type *last) {
+        for (const size_type *i = first; i != last; ++i) {
+            for (const size_type *j = first; j != i; ++j) {
+                if (items[*i].first == items[*j].first) {
+                    throw std::invalid_argument(
+                        "s21::perfect_hash_map Duplicate key");
+                }
+            }
+        }
+        // Seed 0 is the bucket hash itself, so the search starts at 1
+        for (std::uint32_t seed = 1; seed < kMaxSeed; ++seed) {
+            if (Fits(items, first, last, seed)) {
+                seeds_.data()[b] = seed;
+                for (const size_type *i = first; i != last; ++i) {
+                    const auto &item = items[*i];
+                    size_type slot = SlotOf(item.first, seed);
+                    used_.data()[slot] = true;
+                    keys_.data()[slot] = item.first;
+                    values_.data()[slot] = item.second;
+                }
+                return;
+            }
+        }
+        throw std::logic_error(
+            "s21::perfect_hash_map No seed separates the keys, check the "
+            "hash function");
+    }
+
+    constexpr bool Fits(const item_type *items, const size_type *first,
+                        const size_type *last,
+                        std::uint32_t seed) const noexcept {
+        for (const size_type *i = first; i != last; ++i) {
+            size_type slot = SlotOf(items[*i].first, seed);
+            if (used_.data()[slot]) {
+                return false;
+            }
+            for (const size_type *j = first; j != i; ++j) {
+                if (SlotOf(items[*j].first, seed) == slot) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    array<Key, kSlots> keys_{};
+    array<Value, kSlots> values_{};
+    array<bool, kSlots> used_{};
+    array<std::uint32_t, kBuckets> seeds_{};
+};
+
+/**
+ * @brief Builds an s21::perfect_hash_map from a built-in array of pairs,
+ * deducing the key and value types and the number of keys
+ */
+template <typename Key, typename Value, std::size_t N>
+constexpr perfect_hash_map<Key, Value, N> make_perfect_hash_map(
+    const std::pair<Key, Value> (&items)[N]) {
+    return perfect_hash_map<Key, Value, N>(items);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_PERFECT_HASH_H_
@@ -0,0 +1,252 @@
+/**
+ * @file s21_persistent_map.h
+ * @brief s21::persistent_map (персистентный словарь) - неизменяемый
+ * отсортированный ассоциативный контейнер пар ключ-значение с уникальными
+ * ключами.
+ *
+ * @details В отличие от s21::map, методы insert(), insert_or_assign() и
+ * erase() не меняют словарь, а возвращают его новую версию. Новая версия
+ * разделяет со старой все узлы, кроме O(log n) узлов на пути к изменённому
+ * элементу (см. s21_persistent_tree.h). Поэтому снимок состояния (копия
+ * словаря) создается за O(1), а читатели в других потоках могут без
+ * блокировок пользоваться своими копиями старых версий, пока писатель
+ * создает новые.
+ *
+ * Ключи сравниваются так же, как в s21::map - по полю first пары.
+ */
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_MAP_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+template <class Key, class Type>
+class persistent_map {
+  public:
+    // Тип ключа элемента (Key — параметр шаблона)
+    using key_type = Key;
+    // Тип значения элемента (Type — параметр шаблона)
+    using mapped_type = Type;
+    // Тип данных для пары ключ-значение
+    using value_type = std::pair<const key_type, mapped_type>;
+    // Тип константной ссылки на элемент. Элементы общие для нескольких версий
+    // словаря, поэтому менять их через ссылку нельзя
+    using const_reference = const value_type &;
+
+    // Компаратор: элементы равны, если у них равны ключи
+    struct MapValueComparator {
+        bool operator()(const_reference value1,
+                        const_reference value2) const noexcept {
+            return value1.first < value2.first;
+        }
+    };
+
+    // Компаратор для поиска по ключу без создания пары ключ-значение (см.
+    // методы дерева Find(key, less), Contains(key, less), Erase(key, less))
+    struct MapKeyComparator {
+        bool operator()(const_reference value,
+                        const key_type &key) const noexcept {
+            return value.first < key;
+        }
+
+        bool operator()(const key_type &key,
+                        const_reference value) const noexcept {
+            return key < value.first;
+        }
+    };
+
+    // Внутренний класс для дерева
+    using tree_type = PersistentRedBlackTree<value_type, MapValueComparator>;
+    // Внутренний класс для константного итератора
+    using const_iterator = typename tree_type::const_iterator;
+    // Итератор совпадает с константным - элементы изменять нельзя
+    using iterator = const_iterator;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+    /**
+     * @brief Конструктор по умолчанию, создает пустой словарь
+     */
+    persistent_map() = default;
+
+    /**
+     * @brief Конструктор списка инициализаторов. Из нескольких элементов с
+     * эквивалентными ключами остается первый.
+     *
+     * @param items Список создаваемых элементов
+     */
+    persistent_map(std::initializer_list<value_type> const &items) {
+        for (const auto &item : items) {
+            tree_ = tree_.Insert(item);
+        }
+    }
+
+    /**
+     * @brief Копирование словаря - это создание снимка: копируется только
+     * указатель на корень дерева, сложность O(1)
+     */
+    persistent_map(const persistent_map &other) = default;
+    persistent_map(persistent_map &&other) noexcept = default;
+    persistent_map &operator=(const persistent_map &other) = default;
+    persistent_map &operator=(persistent_map &&other) noexcept = default;
+    ~persistent_map() = default;
+
+    /**
+     * @brief Доступ к значению по ключу с проверкой. Если элемента с ключом
+     * key нет, выбрасывается исключение std::out_of_range.
+     *
+     * @param key
+     * @return const mapped_type&
+     */
+    const mapped_type &at(const key_type &key) const {
+        const_iterator it_search = tree_.Find(key, MapKeyComparator{});
+
+        if (it_search == end()) {
+            throw std::out_of_range(
+                "s21::persistent_map::at: No element exists with key "
+                "equivalent to key");
+        }
+        return it_search->second;
+    }
+
+    /**
+     * @brief Возвращает итератор на начало контейнера
+     *
+     * @return const_iterator
+     */
+    const_iterator begin() const {
+        return tree_.Begin();
+    }
+
+    /**
+     * @brief Возвращает итератор на элемент, следующий за последним
+     *
+     * @return const_iterator
+     */
+    const_iterator end() const noexcept {
+        return tree_.End();
+    }
+
+    /**
+     * @brief Ищет элемент с ключом, эквивалентным key
+     *
+     * @param key
+     * @return const_iterator Итератор на элемент или end()
+     */
+    const_iterator find(const key_type &key) const {
+        return tree_.Find(key, MapKeyComparator{});
+    }
+
+    /**
+     * @brief Проверяет, пустой ли контейнер
+     *
+     * @return true контейнер пустой
+     * @return false в контейнере есть элементы
+     */
+    bool empty() const noexcept {
+        return tree_.Empty();
+    }
+
+    /**
+     * @brief Возвращает количество элементов в контейнере
+     *
+     * @return size_type
+     */
+    size_type size() const noexcept {
+        return tree_.Size();
+    }
+
+    /**
+     * @brief Возвращает максимально возможное количество элементов
+     *
+     * @return size_type
+     */
+    size_type max_size() const noexcept {
+        return tree_.MaxSize();
+    }
+
+    /**
+     * @brief Возвращает версию словаря с добавленным элементом value, если в
+     * словаре ещё нет элемента с эквивалентным ключом. Иначе возвращается
+     * копия этой версии.
+     *
+     * @param value Значение элемента для вставки
+     * @return persistent_map Новая версия
+     */
+    [[nodiscard]] persistent_map insert(const value_type &value) const {
+        return persistent_map(tree_.Insert(value));
+    }
+
+    /**
+     * @brief Версия insert() для пары key и obj
+     *
+     * @param key Значение ключа для вставки
+     * @param obj Значение элемента для вставки
+     * @return persistent_map Новая версия
+     */
+    [[nodiscard]] persistent_map insert(const key_type &key,
+                                        const mapped_type &obj) const {
+        return insert(value_type{key, obj});
+    }
+
+    /**
+     * @brief Возвращает версию словаря, в которой ключу key сопоставлено
+     * значение obj: элемент добавляется или заменяется за один проход по
+     * дереву.
+     *
+     * @param key
+     * @param obj
+     * @return persistent_map Новая версия
+     */
+    [[nodiscard]] persistent_map insert_or_assign(
+        const key_type &key, const mapped_type &obj) const {
+        return persistent_map(tree_.Insert(value_type{key, obj}, true));
+    }
+
+    /**
+     * @brief Возвращает версию словаря без элемента с ключом key. Если такого
+     * элемента нет, возвращается копия этой версии.
+     *
+     * @param key
+     * @return persistent_map Новая версия
+     */
+    [[nodiscard]] persistent_map erase(const key_type &key) const {
+        return persistent_map(tree_.Erase(key, MapKeyComparator{}));
+    }
+
+    /**
+     * @brief Обменивает содержимое контейнера на содержимое other
+     *
+     * @param other
+     */
+    void swap(persistent_map &other) noexcept {
+        std::swap(tree_, other.tree_);
+    }
+
+    /**
+     * @brief Проверяет, есть ли в контейнере элемент с ключом, эквивалентным
+     * key.
+     *
+     * @param key
+     * @return true Есть
+     * @return false Нет
+     */
+    bool contains(const key_type &key) const {
+        return tree_.Contains(key, MapKeyComparator{});
+    }
+
+  private:
+    explicit persistent_map(tree_type &&tree) : tree_(std::move(tree)) {
+    }
+
+    // Текущая версия дерева
+    tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_MAP_H_
@@ -0,0 +1,628 @@
+/**
+ * @file s21_persistent_tree.h
+ * @brief Персистентное (неизменяемое) красно-черное дерево с копированием
+ * пути (path copying).
+ *
+ * @details Узлы дерева никогда не изменяются после создания и разделяются
+ * между версиями через счетчик ссылок (std::shared_ptr). Вставка и удаление не
+ * меняют дерево, а возвращают новую версию: заново создаются только узлы на
+ * пути от корня до изменяемого узла (O(log n) узлов), все остальные поддеревья
+ * общие со старой версией. Копирование дерева (снимок состояния) - это
+ * копирование одного указателя на корень, т.е. O(1).
+ *
+ * Т.к. узлы неизменяемы, а счетчик ссылок std::shared_ptr атомарный, разные
+ * потоки могут без блокировок читать свои копии версий, пока другие потоки
+ * создают новые версии. Один и тот же объект дерева, как и std::shared_ptr,
+ * нельзя одновременно менять (присваивать) и читать из разных потоков.
+ *
+ * Вставка реализована по Окасаки (C. Okasaki, "Red-black trees in a
+ * functional setting"), удаление - по Карсу (S. Kahrs, "Red-black trees with
+ * types"). Свойства красно-черного дерева те же, что и у RedBlackTree (см.
+ * s21_tree.h), но служебного узла (головы) нет - он не может быть общим для
+ * разных версий.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_TREE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_TREE_H_
+
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "s21_tree.h"
+
+namespace s21 {
+template <typename Key, typename Comparator = std::less<Key>>
+class PersistentRedBlackTree {
+  private:
+    struct PersistentTreeNode;
+    struct PersistentTreeIterator;
+
+  public:
+    // Тип элемента (Key — параметр шаблона)
+    using key_type = Key;
+    // Тип константной ссылки на элемент. Неконстантных ссылок нет - элементы
+    // могут принадлежать сразу нескольким версиям дерева
+    using const_reference = const key_type &;
+    // Внутренний класс для константного итератора
+    using const_iterator = PersistentTreeIterator;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+    // Внутренний класс для дерева
+    using tree_type = PersistentRedBlackTree;
+    // Внутренний класс узла дерева
+    using tree_node = PersistentTreeNode;
+    // Указатель на неизменяемый узел, общий для нескольких версий
+    using node_pointer = std::shared_ptr<const tree_node>;
+
+    /**
+     * @brief Конструктор по умолчанию, создает пустое дерево
+     */
+    PersistentRedBlackTree() : root_(nullptr), size_(0U) {
+    }
+
+    /**
+     * @brief Возвращает количество элементов в дереве
+     *
+     * @return size_type
+     */
+    size_type Size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Проверяет, пустое ли дерево
+     *
+     * @return true дерево пустое
+     * @return false в дереве есть элементы
+     */
+    bool Empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Возвращает максимально возможное количество элементов дерева
+     *
+     * @return size_type
+     */
+    size_type MaxSize() const noexcept {
+        return ((std::numeric_limits<size_type>::max() / 2) -
+                sizeof(node_pointer)) /
+               sizeof(tree_node);
+    }
+
+    /**
+     * @brief Итератор на первый (наименьший) элемент дерева
+     *
+     * @return const_iterator
+     */
+    const_iterator Begin() const {
+        const_iterator it;
+        it.PushLeftPath(root_.get());
+        return it;
+    }
+
+    /**
+     * @brief Итератор на элемент, следующий за последним элементом дерева
+     *
+     * @return const_iterator
+     */
+    const_iterator End() const noexcept {
+        return const_iterator{};
+    }
+
+    /**
+     * @brief Ищет элемент, эквивалентный key
+     *
+     * @param key Искомое значение
+     * @return const_iterator Итератор на найденный элемент или End()
+     */
+    const_iterator Find(const_reference key) const {
+        return Find(key, cmp_);
+    }
+
+    /**
+     * @brief Версия Find() для поиска по значению другого типа (например,
+     * по ключу словаря без создания пары ключ-значение).
+     *
+     * @tparam SearchKey Тип искомого значения
+     * @tparam KeyLess Компаратор с перегрузками (key_type, SearchKey) и
+     * (SearchKey, key_type), согласованный с компаратором дерева
+     * @param key Искомое значение
+     * @param less Компаратор
+     * @return const_iterator Итератор на найденный элемент или End()
+     */
+    template <typename SearchKey, typename KeyLess>
+    const_iterator Find(const SearchKey &key, const KeyLess &less) const {
+        const_iterator it = LowerBound(key, less);
+        if (it == End() || less(key, *it)) {
+            return End();
+        }
+        return it;
+    }
+
+    /**
+     * @brief Ищет первый элемент, не меньший key
+     * @details Во время спуска в стек итератора складываются узлы, в которых
+     * мы свернули налево - это ровно те узлы, которые итератор должен обойти
+     * после найденного
+     *
+     * @param key Искомое значение
+     * @return const_iterator
+     */
+    const_iterator LowerBound(const_reference key) const {
+        return LowerBound(key, cmp_);
+    }
+
+    /**
+     * @brief Версия LowerBound() для значения другого типа (см. Find(key,
+     * less))
+     */
+    template <typename SearchKey, typename KeyLess>
+    const_iterator LowerBound(const SearchKey &key,
+                              const KeyLess &less) const {
+        const_iterator it;
+        const tree_node *node = root_.get();
+        while (node != nullptr) {
+            if (less(node->key_, key)) {
+                node = node->right_.get();
+            } else {
+                it.stack_.push_back(node);
+                node = node->left_.get();
+            }
+        }
+        return it;
+    }
+
+    /**
+     * @brief Проверяет, есть ли в дереве элемент, эквивалентный key
+     *
+     * @param key
+     * @return true Есть
+     * @return false Нет
+     */
+    bool Contains(const_reference key) const {
+        return Contains(key, cmp_);
+    }
+
+    /**
+     * @brief Версия Contains() для значения другого типа (см. Find(key,
+     * less))
+     */
+    template <typename SearchKey, typename KeyLess>
+    bool Contains(const SearchKey &key, const KeyLess &less) const {
+        const tree_node *node = root_.get();
+        while (node != nullptr) {
+            if (less(key, node->key_)) {
+                node = node->left_.get();
+            } else if (less(node->key_, key)) {
+                node = node->right_.get();
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Возвращает новую версию дерева, в которую добавлен элемент key.
+     * Текущая версия не меняется.
+     *
+     * @details Если эквивалентный элемент уже есть, то при replace == false
+     * возвращается копия текущей версии (все узлы общие), а при replace ==
+     * true в новой версии этот элемент заменяется на key.
+     *
+     * @param key Вставляемое значение
+     * @param replace Заменять ли существующий эквивалентный элемент
+     * @return tree_type Новая версия дерева
+     */
+    [[nodiscard]] tree_type Insert(const_reference key,
+                                   bool replace = false) const {
+        bool found = false;
+        node_pointer root = InsertNode(root_, key, replace, found);
+        if (found && !replace) {
+            return *this;
+        }
+        return tree_type(Blacken(root), found ? size_ : size_ + 1, cmp_);
+    }
+
+    /**
+     * @brief Возвращает новую версию дерева без элемента, эквивалентного key.
+     * Текущая версия не меняется. Если такого элемента нет, возвращается
+     * копия текущей версии.
+     *
+     * @param key Удаляемое значение
+     * @return tree_type Новая версия дерева
+     */
+    [[nodiscard]] tree_type Erase(const_reference key) const {
+        return Erase(key, cmp_);
+    }
+
+    /**
+     * @brief Версия Erase() для значения другого типа (см. Find(key, less))
+     */
+    template <typename SearchKey, typename KeyLess>
+    [[nodiscard]] tree_type Erase(const SearchKey &key,
+                                  const KeyLess &less) const {
+        // Удаление по Карсу предполагает, что элемент есть в дереве: иначе
+        // балансировка посчитает, что черная высота поддерева уменьшилась
+        if (!Contains(key, less)) {
+            return *this;
+        }
+        return tree_type(Blacken(EraseNode(root_, key, less)), size_ - 1,
+                         cmp_);
+    }
+
+    /**
+     * @brief Проверка свойств красно-черного дерева (для тестов)
+     *
+     * @return true дерево корректно
+     * @return false свойства нарушены
+     */
+    bool CheckTree() const noexcept {
+        if (IsRed(root_)) {
+            return false;
+        }
+        size_type count = 0;
+        return ComputeBlackHeight(root_.get(), count) >= 0 && count == size_;
+    }
+
+  private:
+    /**
+     * @brief Создает версию дерева с готовым корнем
+     */
+    PersistentRedBlackTree(node_pointer root, size_type size,
+                           const Comparator &cmp)
+        : root_(std::move(root)), size_(size), cmp_(cmp) {
+    }
+
+    static bool IsRed(const node_pointer &node) noexcept {
+        return node != nullptr && node->color_ == kRed;
+    }
+
+    static bool IsBlack(const node_pointer &node) noexcept {
+        return node != nullptr && node->color_ == kBlack;
+    }
+
+    static node_pointer MakeNode(RedBlackTreeColor color, node_pointer left,
+                                 const key_type &key, node_pointer right) {
+        return std::make_shared<const tree_node>(color, std::move(left), key,
+                                                 std::move(right));
+    }
+
+    /**
+     * @brief Копия узла node с другим цветом
+     */
+    static node_pointer Recolor(const node_pointer &node,
+                                RedBlackTreeColor color) {
+        return MakeNode(color, node->left_, node->key_, node->right_);
+    }
+
+    /**
+     * @brief Корень всегда чёрный. Перекрашиваем его, только если нужно,
+     * чтобы не копировать узел зря
+     */
+    static node_pointer Blacken(const node_pointer &node) {
+        if (IsRed(node)) {
+            return Recolor(node, kBlack);
+        }
+        return node;
+    }
+
+    /**
+     * @brief Собирает чёрный узел (left, key, right) и устраняет нарушение
+     * правила 4 (два красных узла подряд) в одном из потомков.
+     * @details Во всех случаях нарушения результат одинаков: красный узел с
+     * двумя чёрными потомками, где a < x < b < y < c < z < d - четыре
+     * поддерева и три элемента, участвующие в нарушении.
+     */
+    static node_pointer Balance(const node_pointer &left, const key_type &key,
+                                const node_pointer &right) {
+        if (IsRed(left) && IsRed(right)) {
+            return MakeNode(kRed, Recolor(left, kBlack), key,
+                            Recolor(right, kBlack));
+        }
+        if (IsRed(left)) {
+            if (IsRed(left->left_)) {
+                const node_pointer &ll = left->left_;
+                return MakeNode(kRed, Recolor(ll, kBlack), left->key_,
+                                MakeNode(kBlack, left->right_, key, right));
+            }
+            if (IsRed(left->right_)) {
+                const node_pointer &lr = left->right_;
+                return MakeNode(
+                    kRed, MakeNode(kBlack, left->left_, left->key_, lr->left_),
+                    lr->key_, MakeNode(kBlack, lr->right_, key, right));
+            }
+        }
+        if (IsRed(right)) {
+            if (IsRed(right->right_)) {
+                const node_pointer &rr = right->right_;
+                return MakeNode(kRed, MakeNode(kBlack, left, key, right->left_),
+                                right->key_, Recolor(rr, kBlack));
+            }
+            if (IsRed(right->left_)) {
+                const node_pointer &rl = right->left_;
+                return MakeNode(
+                    kRed, MakeNode(kBlack, left, key, rl->left_), rl->key_,
+                    MakeNode(kBlack, rl->right_, right->key_, right->right_));
+            }
+        }
+        return MakeNode(kBlack, left, key, right);
+    }
+
+    /**
+     * @brief Рекурсивная вставка: копирует путь от node до места вставки
+     *
+     * @param found Устанавливается в true, если эквивалентный элемент найден
+     * @return node_pointer Новый корень поддерева (при found && !replace -
+     * сам node)
+     */
+    node_pointer InsertNode(const node_pointer &node, const key_type &key,
+                            bool replace, bool &found) const {
+        if (node == nullptr) {
+            return MakeNode(kRed, nullptr, key, nullptr);
+        }
+
+        if (cmp_(key, node->key_)) {
+            node_pointer left = InsertNode(node->left_, key, replace, found);
+            if (left == node->left_) {
+                return node;
+            }
+            return node->color_ == kBlack
+                       ? Balance(left, node->key_, node->right_)
+                       : MakeNode(kRed, left, node->key_, node->right_);
+        }
+        if (cmp_(node->key_, key)) {
+            node_pointer right = InsertNode(node->right_, key, replace, found);
+            if (right == node->right_) {
+                return node;
+            }
+            return node->color_ == kBlack
+                       ? Balance(node->left_, node->key_, right)
+                       : MakeNode(kRed, node->left_, node->key_, right);
+        }
+
+        found = true;
+        if (!replace) {
+            return node;
+        }
+        return MakeNode(node->color_, node->left_, key, node->right_);
+    }
+
+    /**
+     * @brief Восстанавливает баланс, когда черная высота левого поддерева
+     * left на единицу меньше, чем у right
+     */
+    static node_pointer BalanceLeft(const node_pointer &left,
+                                    const key_type &key,
+                                    const node_pointer &right) {
+        if (IsRed(left)) {
+            return MakeNode(kRed, Recolor(left, kBlack), key, right);
+        }
+        if (IsBlack(right)) {
+            return Balance(left, key, Recolor(right, kRed));
+        }
+        // right красный, его левый потомок обязательно чёрный
+        const node_pointer &rl = right->left_;
+        return MakeNode(kRed, MakeNode(kBlack, left, key, rl->left_), rl->key_,
+                        Balance(rl->right_, right->key_,
+                                Recolor(right->right_, kRed)));
+    }
+
+    /**
+     * @brief Восстанавливает баланс, когда черная высота правого поддерева
+     * right на единицу меньше, чем у left
+     */
+    static node_pointer BalanceRight(const node_pointer &left,
+                                     const key_type &key,
+                                     const node_pointer &right) {
+        if (IsRed(right)) {
+            return MakeNode(kRed, left, key, Recolor(right, kBlack));
+        }
+        if (IsBlack(left)) {
+            return Balance(Recolor(left, kRed), key, right);
+        }
+        // left красный, его правый потомок обязательно чёрный
+        const node_pointer &lr = left->right_;
+        return MakeNode(kRed,
+                        Balance(Recolor(left->left_, kRed), left->key_,
+                                lr->left_),
+                        lr->key_, MakeNode(kBlack, lr->right_, key, right));
+    }
+
+    /**
+     * @brief Склеивает два поддерева одинаковой черной высоты, все элементы
+     * left меньше всех элементов right (удаленный узел был между ними)
+     */
+    static node_pointer Append(const node_pointer &left,
+                               const node_pointer &right) {
+        if (left == nullptr) {
+            return right;
+        }
+        if (right == nullptr) {
+            return left;
+        }
+
+        if (IsRed(left) && IsRed(right)) {
+            node_pointer middle = Append(left->right_, right->left_);
+            if (IsRed(middle)) {
+                return MakeNode(
+                    kRed,
+                    MakeNode(kRed, left->left_, left->key_, middle->left_),
+                    middle->key_,
+                    MakeNode(kRed, middle->right_, right->key_,
+                             right->right_));
+            }
+            return MakeNode(kRed, left->left_, left->key_,
+                            MakeNode(kRed, middle, right->key_, right->right_));
+        }
+        if (IsBlack(left) && IsBlack(right)) {
+            node_pointer middle = Append(left->right_, right->left_);
+            if (IsRed(middle)) {
+                return MakeNode(
+                    kRed,
+                    MakeNode(kBlack, left->left_, left->key_, middle->left_),
+                    middle->key_,
+                    MakeNode(kBlack, middle->right_, right->key_,
+                             right->right_));
+            }
+            return BalanceLeft(
+                left->left_, left->key_,
+                MakeNode(kBlack, middle, right->key_, right->right_));
+        }
+        if (IsRed(right)) {
+            return MakeNode(kRed, Append(left, right->left_), right->key_,
+                            right->right_);
+        }
+        return MakeNode(kRed, left->left_, left->key_,
+                        Append(left->right_, right));
+    }
+
+    /**
+     * @brief Рекурсивное удаление элемента key (который обязательно есть в
+     * поддереве node). Если удаление было из чёрного поддерева, то черная
+     * высота результата на единицу меньше - это исправляется на уровень выше
+     * в BalanceLeft()/BalanceRight()
+     */
+    template <typename SearchKey, typename KeyLess>
+    node_pointer EraseNode(const node_pointer &node, const SearchKey &key,
+                           const KeyLess &less) const {
+        if (less(key, node->key_)) {
+            node_pointer left = EraseNode(node->left_, key, less);
+            if (IsBlack(node->left_)) {
+                return BalanceLeft(left, node->key_, node->right_);
+            }
+            return MakeNode(kRed, left, node->key_, node->right_);
+        }
+        if (less(node->key_, key)) {
+            node_pointer right = EraseNode(node->right_, key, less);
+            if (IsBlack(node->right_)) {
+                return BalanceRight(node->left_, node->key_, right);
+            }
+            return MakeNode(kRed, node->left_, node->key_, right);
+        }
+        return Append(node->left_, node->right_);
+    }
+
+    /**
+     * @brief Считает черную высоту поддерева и количество его узлов
+     *
+     * @return int Черная высота или -1, если свойства дерева нарушены
+     */
+    int ComputeBlackHeight(const tree_node *node,
+                           size_type &count) const noexcept {
+        if (node == nullptr) {
+            return 0;
+        }
+        ++count;
+        if (node->color_ == kRed &&
+            (IsRed(node->left_) || IsRed(node->right_))) {
+            return -1;
+        }
+        if ((node->left_ && !cmp_(node->left_->key_, node->key_)) ||
+            (node->right_ && !cmp_(node->key_, node->right_->key_))) {
+            return -1;
+        }
+        int left = ComputeBlackHeight(node->left_.get(), count);
+        int right = ComputeBlackHeight(node->right_.get(), count);
+        if (left < 0 || left != right) {
+            return -1;
+        }
+        return left + (node->color_ == kBlack ? 1 : 0);
+    }
+
+    /**
+     * @brief Неизменяемый узел дерева. Потомки - указатели со счетчиком
+     * ссылок, т.к. поддерево может входить сразу в несколько версий. Указателя
+     * на родителя нет: у общего узла в разных версиях разные родители.
+     */
+    struct PersistentTreeNode {
+        PersistentTreeNode(RedBlackTreeColor color, node_pointer left,
+                           const key_type &key, node_pointer right)
+            : left_(std::move(left)), right_(std::move(right)), key_(key),
+              color_(color) {
+        }
+
+        node_pointer left_;
+        node_pointer right_;
+        key_type key_;
+        RedBlackTreeColor color_;
+    };
+
+    /**
+     * @brief Константный итератор дерева.
+     * @details Т.к. в узлах нет указателей на родителя, итератор хранит стек
+     * узлов, которые ещё предстоит обойти: на вершине стека - текущий узел,
+     * под ним - предки, в которых обход свернул налево. Пустой стек - это
+     * End(). Итератор действителен, пока жива хотя бы одна версия дерева,
+     * содержащая его узлы.
+     */
+    struct PersistentTreeIterator {
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = tree_type::key_type;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        reference operator*() const noexcept {
+            return stack_.back()->key_;
+        }
+
+        pointer operator->() const noexcept {
+            return &stack_.back()->key_;
+        }
+
+        const_iterator &operator++() {
+            const tree_node *node = stack_.back();
+            stack_.pop_back();
+            PushLeftPath(node->right_.get());
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            if (it1.stack_.empty() || it2.stack_.empty()) {
+                return it1.stack_.empty() == it2.stack_.empty();
+            }
+            return it1.stack_.back() == it2.stack_.back();
+        }
+
+        friend bool operator!=(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return !(it1 == it2);
+        }
+
+        /**
+         * @brief Кладет в стек node и всех его левых потомков
+         */
+        void PushLeftPath(const tree_node *node) {
+            while (node != nullptr) {
+                stack_.push_back(node);
+                node = node->left_.get();
+            }
+        }
+
+        std::vector<const tree_node *> stack_;
+    };
+
+    // Корень дерева (nullptr для пустого дерева)
+    node_pointer root_;
+    // Количество элементов в дереве
+    size_type size_;
+    // Компаратор дерева (класс для сравнения значений узлов)
+    Comparator cmp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_TREE_H_
@@ -0,0 +1,626 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_PRIORITY_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @brief Sift and heapify routines of an implicit d-ary heap, shared by
+ * s21::priority_queue and s21::indexed_priority_queue
+ *
+ * @details The children of node i are Arity * i + 1 ... Arity * i + Arity. A
+ * wider node makes the heap shallower (log_d n levels): push, decrease_key
+ * and heapify touch fewer cache lines, while pop compares more children per
+ * level. 4-ary is a good default; plain pop + push of cheap keys can be a
+ * little faster with a binary heap (see benchmarks/bench_priority_queue.cc).
+ *
+ * Sifts move a "hole" instead of swapping, so each level costs one move.
+ * Every time an element lands in its final slot on_placed(element, index) is
+ * called; the indexed queue uses it to keep its position table up to date.
+ *
+ * @tparam Arity number of children per node, at least 2
+ */
+template <std::size_t Arity>
+struct DaryHeapAlgorithms {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+    using size_type = std::size_t;
+
+    /**
+     * @brief Moves first[index] up while it has priority over its parent
+     */
+    template <typename RandomIt, typename Compare, typename OnPlaced>
+    static void SiftUp(RandomIt first, size_type index, Compare &comp,
+                       OnPlaced &on_placed) {
+        auto value = std::move(first[index]);
+        while (index > 0) {
+            size_type parent = (index - 1) / Arity;
+            if (!comp(first[parent], value)) {
+                break;
+            }
+            first[index] = std::move(first[parent]);
+            on_placed(first[index], index);
+            index = parent;
+        }
+        first[index] = std::move(value);
+        on_placed(first[index], index);
+    }
+
+    /**
+     * @brief Moves first[index] down while one of its children has priority
+     * over it
+     */
+    template <typename RandomIt, typename Compare, typename OnPlaced>
+    static void SiftDown(RandomIt first, size_type size, size_type index,
+                         Compare &comp, OnPlaced &on_placed) {
+        auto value = std::move(first[index]);
+        for (;;) {
+            size_type child = Arity * index + 1;
+            if (child >= size) {
+                break;
+            }
+            size_type last = child + Arity < size ? child + Arity : size;
+            size_type best = child;
+            for (++child; child < last; ++child) {
+                best = comp(first[best], first[child]) ? child : best;
+            }
+            if (!comp(value, first[best])) {
+                break;
+            }
+            first[index] = std::move(first[best]);
+            on_placed(first[index], index);
+            index = best;
+        }
+        first[index] = std::move(value);
+        on_placed(first[index], index);
+    }
+
+    /**
+     * @brief Fills the hole at index with value: moves the hole all the way
+     * down to a leaf, then sifts value up from there (Floyd's bottom-up
+     * variant)
+     *
+     * @details Used by pop(), where value is the former last element and
+     * almost always belongs near the bottom: each level costs d - 1
+     * comparisons between the children instead of d, and the way back up is
+     * usually a single comparison
+     */
+    template <typename RandomIt, typename Value, typename Compare,
+              typename OnPlaced>
+    static void FillHole(RandomIt first, size_type size, size_type index,
+                         Value &&value, Compare &comp, OnPlaced &on_placed) {
+        size_type top = index;
+        for (;;) {
+            size_type child = Arity * index + 1;
+            if (child >= size) {
+                break;
+            }
+            size_type last = child + Arity < size ? child + Arity : size;
+            size_type best = child;
+            for (++child; child < last; ++child) {
+                best = comp(first[best], first[child]) ? child : best;
+            }
+            first[index] = std::move(first[best]);
+            on_placed(first[index], index);
+            index = best;
+        }
+        while (index > top) {
+            size_type parent = (index - 1) / Arity;
+            if (!comp(first[parent], value)) {
+                break;
+            }
+            first[index] = std::move(first[parent]);
+            on_placed(first[index], index);
+            index = parent;
+        }
+        first[index] = std::forward<Value>(value);
+        on_placed(first[index], index);
+    }
+
+    /**
+     * @brief Turns [first, first + size) into a heap in O(size) (Floyd)
+     */
+    template <typename RandomIt, typename Compare, typename OnPlaced>
+    static void MakeHeap(RandomIt first, size_type size, Compare &comp,
+                         OnPlaced &on_placed) {
+        if (size < 2) {
+            for (size_type i = 0; i < size; ++i) {
+                on_placed(first[i], i);
+            }
+            return;
+        }
+        for (size_type i = (size - 2) / Arity + 1; i-- > 0;) {
+            SiftDown(first, size, i, comp, on_placed);
+        }
+        // Leaves that never moved still have to be reported
+        for (size_type i = (size - 2) / Arity + 1; i < size; ++i) {
+            on_placed(first[i], i);
+        }
+    }
+};
+
+/**
+ * @brief s21::priority_queue - container adaptor that provides constant time
+ * lookup of the largest (by default) element, at the expense of logarithmic
+ * insertion and extraction
+ *
+ * @details The elements form an implicit d-ary heap inside the Container,
+ * there are no per-element allocations. Like std::priority_queue, a Compare
+ * of std::greater<T> makes the smallest element appear as the top().
+ *
+ * @tparam T containers type
+ * @tparam Container random access container with push_back/pop_back
+ * @tparam Compare strict weak ordering; top() is the element for which
+ * comp(top, other) is false for all others
+ * @tparam Arity number of children per heap node (2, 4 and 8 are typical)
+ */
+template <typename T, typename Container = s21::vector<T>,
+          typename Compare = std::less<T>, std::size_t Arity = 4>
+class priority_queue {
+    using algorithms = DaryHeapAlgorithms<Arity>;
+
+  public:
+    using container_type = Container;
+    using value_compare = Compare;
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+
+    // Member functions
+  public:
+    priority_queue() : container_{}, comp_{} {
+    }
+
+    explicit priority_queue(const Compare &comp) : container_{}, comp_(comp) {
+    }
+
+    /**
+     * @brief initializer_list constructor, builds the heap in O(n)
+     *
+     * @param items Elements to initialize the queue with
+     */
+    explicit priority_queue(std::initializer_list<value_type> const &items,
+                            const Compare &comp = Compare())
+        : container_{}, comp_(comp) {
+        push_range(items.begin(), items.end());
+    }
+
+    /**
+     * @brief Range constructor, builds the heap in O(n)
+     *
+     * @param first, last Range of elements to initialize the queue with
+     */
+    template <typename InputIt>
+    priority_queue(InputIt first, InputIt last,
+                   const Compare &comp = Compare())
+        : container_{}, comp_(comp) {
+        push_range(first, last);
+    }
+
+    // Element access
+  public:
+    /**
+     * @brief Returns reference to the top element, the one to be removed by
+     * pop(). UB on an empty queue
+     */
+    const_reference top() const {
+        return *container_.begin();
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return container_.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return container_.size();
+    }
+
+    // Priority queue Modifiers
+  public:
+    /**
+     * @brief Pushes the given element value, O(log_d n)
+     *
+     * @param value the value of the element to push
+     */
+    void push(const_reference value) {
+        container_.push_back(value);
+        SiftUp(container_.size() - 1);
+    }
+
+    void push(value_type &&value) {
+        container_.push_back(std::move(value));
+        SiftUp(container_.size() - 1);
+    }
+
+    /**
+     * @brief Pushes an element constructed from args
+     *
+     * @param args arguments to forward to the constructor of the element
+     */
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        push(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Pushes all the elements of [first, last)
+     *
+     * @details Appends the elements first. If they are many compared to the
+     * queue, the whole heap is rebuilt in O(size()), otherwise each new element
+     * is sifted up in O(log_d size())
+     *
+     * @param first, last Range of elements to push
+     */
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        size_type old_size = container_.size();
+        for (; first != last; ++first) {
+            container_.push_back(*first);
+        }
+        size_type size = container_.size();
+        size_type added = size - old_size;
+        if (added == 0) {
+            return;
+        }
+        if (added * Log(size) > size) {
+            auto on_placed = [](const value_type &, size_type) {};
+            algorithms::MakeHeap(container_.begin(), size, comp_, on_placed);
+        } else {
+            for (size_type i = old_size; i < size; ++i) {
+                SiftUp(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the top element, O(d log_d n). UB on an empty queue
+     */
+    void pop() {
+        size_type size = container_.size() - 1;
+        if (size > 0) {
+            auto first = container_.begin();
+            value_type last = std::move(first[size]);
+            auto on_placed = [](const value_type &, size_type) {};
+            algorithms::FillHole(first, size, 0, std::move(last), comp_,
+                                 on_placed);
+        }
+        container_.pop_back();
+    }
+
+    /**
+     * @brief Exchanges the contents of the container adaptor with those of
+     * other
+     *
+     * @param other Container adaptor to exchange the contents with
+     */
+    void swap(priority_queue &other) noexcept {
+        std::swap(container_, other.container_);
+        std::swap(comp_, other.comp_);
+    }
+
+  private:
+    void SiftUp(size_type index) {
+        auto on_placed = [](const value_type &, size_type) {};
+        algorithms::SiftUp(container_.begin(), index, comp_, on_placed);
+    }
+
+    /**
+     * @brief Approximate height of a heap of size elements, at least 1
+     */
+    static size_type Log(size_type size) noexcept {
+        size_type levels = 1;
+        for (; size >= Arity; size /= Arity) {
+            ++levels;
+        }
+        return levels;
+    }
+
+    Container container_;
+    Compare comp_;
+};
+
+/**
+ * @brief s21::indexed_priority_queue - priority queue whose elements can be
+ * found, reprioritized and erased through a handle
+ *
+ * @details push() returns a handle that stays valid until the element leaves
+ * the queue (pop() or erase()); after that the handle may be reused by a
+ * later push(). The heap itself stores handles, a position table maps a
+ * handle to its slot in the heap, so decrease_key() and erase() are
+ * O(log_d n) and don't search.
+ *
+ * The "decrease" in decrease_key() refers to the usual min-heap: the new value
+ * must move the element towards the top. With the default std::less (largest
+ * on top) that means the new value is not less than the old one; with
+ * std::greater - not greater. update() accepts a change in either direction.
+ *
+ * @tparam T containers type, must be default constructible
+ * @tparam Compare strict weak ordering, see s21::priority_queue
+ * @tparam Arity number of children per heap node
+ */
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class indexed_priority_queue {
+    using algorithms = DaryHeapAlgorithms<Arity>;
+
+  public:
+    using value_compare = Compare;
+    using value_type = T;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using handle_type = std::size_t;
+
+    // Member functions
+  public:
+    indexed_priority_queue() : comp_{} {
+    }
+
+    explicit indexed_priority_queue(const Compare &comp) : comp_(comp) {
+    }
+
+    // Element access
+  public:
+    /**
+     * @brief Returns reference to the top element. UB on an empty queue
+     */
+    const_reference top() const {
+        return Values()[top_handle()];
+    }
+
+    /**
+     * @brief Returns the handle of the top element. UB on an empty queue
+     */
+    handle_type top_handle() const {
+        return *heap_.begin();
+    }
+
+    /**
+     * @brief Checks whether handle refers to an element of the queue
+     */
+    bool contains(handle_type handle) const noexcept {
+        return handle < positions_.size() && Positions()[handle] != kNotInHeap;
+    }
+
+    /**
+     * @brief Returns the value of the element with the given handle
+     *
+     * @throw std::out_of_range if the handle isn't in the queue
+     */
+    const_reference value(handle_type handle) const {
+        CheckHandle(handle, "value");
+        return Values()[handle];
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return heap_.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return heap_.size();
+    }
+
+    // Modifiers
+  public:
+    /**
+     * @brief Pushes the given element value, O(log_d n)
+     *
+     * @return Handle of the new element
+     */
+    handle_type push(const_reference value) {
+        return Push(value);
+    }
+
+    handle_type push(T &&value) {
+        return Push(std::move(value));
+    }
+
+    /**
+     * @brief Removes the top element. UB on an empty queue
+     */
+    void pop() {
+        erase(top_handle());
+    }
+
+    /**
+     * @brief Moves the element towards the top after lowering its key, i.e.
+     * giving it a higher priority, O(log_d n)
+     *
+     * @param handle element to change
+     * @param value new value, comp(old value, value) or equal
+     * @throw std::out_of_range if the handle isn't in the queue
+     * @throw std::invalid_argument if value would move the element down
+     */
+    void decrease_key(handle_type handle, const_reference value) {
+        CheckHandle(handle, "decrease_key");
+        if (comp_(value, Values()[handle])) {
+            throw std::invalid_argument(
+                "s21::indexed_priority_queue::decrease_key The new value has "
+                "a lower priority");
+        }
+        Values()[handle] = value;
+        SiftUp(Positions()[handle]);
+    }
+
+    /**
+     * @brief Changes the value of the element in either direction, O(d
+     * log_d n)
+     *
+     * @throw std::out_of_range if the handle isn't in the queue
+     */
+    void update(handle_type handle, const_reference value) {
+        CheckHandle(handle, "update");
+        bool up = comp_(Values()[handle], value);
+        Values()[handle] = value;
+        if (up) {
+            SiftUp(Positions()[handle]);
+        } else {
+            SiftDown(Positions()[handle]);
+        }
+    }
+
+    /**
+     * @brief Removes the element with the given handle, O(d log_d n). The
+     * value is reset to value_type(), so it doesn't hold its resources until
+     * the handle is reused
+     *
+     * @throw std::out_of_range if the handle isn't in the queue
+     */
+    void erase(handle_type handle) {
+        CheckHandle(handle, "erase");
+        // The only allocation goes first: if it throws, nothing has changed
+        free_.push_back(handle);
+        size_type index = Positions()[handle];
+        size_type last = heap_.size() - 1;
+        handle_type *heap = heap_.data();
+        handle_type moved = heap[last];
+        heap[index] = moved;
+        heap_.pop_back();
+        Positions()[handle] = kNotInHeap;
+        if (index != last) {
+            // The last element may belong either above or below the hole
+            size_type parent = (index - 1) / Arity;
+            if (index > 0 && comp_(Values()[heap[parent]], Values()[moved])) {
+                SiftUp(index);
+            } else {
+                SiftDown(index);
+            }
+        }
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            Values()[handle] = value_type();
+        }
+    }
+
+    void swap(indexed_priority_queue &other) noexcept {
+        heap_.swap(other.heap_);
+        values_.swap(other.values_);
+        positions_.swap(other.positions_);
+        free_.swap(other.free_);
+        std::swap(comp_, other.comp_);
+    }
+
+  private:
+    static constexpr size_type kNotInHeap =
+        std::numeric_limits<size_type>::max();
+
+    // s21::vector::operator[] checks bounds, the hot paths index raw data
+    value_type *Values() noexcept {
+        return values_.data();
+    }
+
+    const value_type *Values() const noexcept {
+        return values_.data();
+    }
+
+    size_type *Positions() noexcept {
+        return positions_.data();
+    }
+
+    const size_type *Positions() const noexcept {
+        return positions_.data();
+    }
+
+    void CheckHandle(handle_type handle, const char *method) const {
+        if (!contains(handle)) {
+            throw std::out_of_range(
+                std::string("s21::indexed_priority_queue::") + method +
+                " The handle is not in the queue");
+        }
+    }
+
+    /**
+     * @brief Grows the capacity of items geometrically so that the next
+     * push_back can't reallocate, and so can't throw
+     */
+    template <typename Items>
+    static void ReserveOneMore(Items &items) {
+        if (items.size() == items.capacity()) {
+            items.reserve(items.size() ? items.size() * 2 : 1);
+        }
+    }
+
+    template <typename U>
+    handle_type Push(U &&value) {
+        // Every allocation but the value's goes first: if one throws, nothing
+        // has changed, and once the value is stored the rest can't throw
+        ReserveOneMore(heap_);
+        handle_type handle;
+        if (free_.empty()) {
+            ReserveOneMore(positions_);
+            handle = values_.size();
+            values_.push_back(std::forward<U>(value));
+            positions_.push_back(kNotInHeap);
+        } else {
+            handle = free_.back();
+            Values()[handle] = std::forward<U>(value);
+            free_.pop_back();
+        }
+        heap_.push_back(handle);
+        SiftUp(heap_.size() - 1);
+        return handle;
+    }
+
+    /**
+     * @brief Compares heap entries (handles) by the values they refer to
+     */
+    struct HandleCompare {
+        bool operator()(handle_type lhs, handle_type rhs) const {
+            return (*comp)(values[lhs], values[rhs]);
+        }
+
+        const Compare *comp;
+        const value_type *values;
+    };
+
+    /**
+     * @brief Records the new slot of a handle moved by a sift
+     */
+    struct RecordPosition {
+        void operator()(handle_type handle, size_type index) const noexcept {
+            positions[handle] = index;
+        }
+
+        size_type *positions;
+    };
+
+    void SiftUp(size_type index) {
+        HandleCompare comp{&comp_, Values()};
+        RecordPosition on_placed{Positions()};
+        algorithms::SiftUp(heap_.data(), index, comp, on_placed);
+    }
+
+    void SiftDown(size_type index) {
+        HandleCompare comp{&comp_, Values()};
+        RecordPosition on_placed{Positions()};
+        algorithms::SiftDown(heap_.data(), heap_.size(), index, comp,
+                             on_placed);
+    }
+
+    // Heap of handles
+    vector<handle_type> heap_;
+    // Element values, by handle
+    vector<value_type> values_;
+    // Slot of each handle in heap_, kNotInHeap for free handles
+    vector<size_type> positions_;
+    // Handles of removed elements, reused by push()
+    vector<handle_type> free_;
+    Compare comp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_PRIORITY_QUEUE_H_
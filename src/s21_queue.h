@@ -1,13 +1,13 @@
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_STACK_H_S21_QUEUE_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_STACK_H_S21_QUEUE_H_
 
-#include "s21_list.h"
+#include "s21_deque.h"
 #include <algorithm>
 #include <initializer_list>
 
 namespace s21 {
 
-template <typename T, typename Container = s21::list<T>>
+template <typename T, typename Container = s21::deque<T>>
 class queue {
   public:
     using value_type = T;
@@ -187,7 +187,7 @@ class queue {
     }
 
     /**
-     * @brief Pushes a new element to the end of the queue.
+     * @brief Pushes a new element to the end of the queue
      *
      * @details The element is constructed in-place, i.e. no copy or move
      * operations are performed. The constructor of the element is called with
@@ -198,11 +198,85 @@ class queue {
      * Container::emplace_back
      */
     template <typename... Args>
+    decltype(auto) emplace(Args &&...args) {
+        return container_.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Pushes every argument to the end of the queue as a separate
+     * element
+     *
+     * @details Each argument goes through push(), so rvalues are moved into
+     * the container rather than copied
+     * @param args Elements to push
+     */
+    template <typename... Args>
     void emplace_back(Args &&...args) {
-        container_.emplace_back(std::forward<Args>(args)...);
+        (push(std::forward<Args>(args)), ...);
+    }
+
+    /**
+     * @brief Pushes the elements of [first, last) to the end of the queue.
+     * Effectively calls q.append_range(first, last), so the container can
+     * grow once for the whole batch
+     *
+     * @param first, last Range of elements to push
+     */
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        container_.append_range(first, last);
+    }
+
+    /**
+     * @brief Moves up to count elements from the front of the queue to out,
+     * in pop() order, then removes them with one call to q.pop_front_n()
+     *
+     * @param out Output iterator the elements are moved to
+     * @param count Maximum number of elements to pop
+     * @return Output iterator past the last written element
+     */
+    template <typename OutputIt>
+    OutputIt pop_n(OutputIt out, size_type count) {
+        ConsumeFront(std::min(count, size()), [&out](value_type &&value) {
+            *out = std::move(value);
+            ++out;
+        });
+        return out;
+    }
+
+    /**
+     * @brief Pops every element, passing it to callback(value_type &&) in
+     * pop() order, then removes them with one call to q.pop_front_n()
+     *
+     * @details The callback must not modify the queue. If it throws, the
+     * elements it has already consumed are removed and the rest stay
+     * @param callback Consumer of the elements
+     * @return The number of elements popped
+     */
+    template <typename Callback>
+    size_type drain(Callback callback) {
+        return ConsumeFront(size(), callback);
     }
 
   private:
+    /**
+     * @brief Passes the first count elements to consume and pops them
+     */
+    template <typename Consume>
+    size_type ConsumeFront(size_type count, Consume &&consume) {
+        size_type done = 0;
+        try {
+            for (auto it = container_.begin(); done < count; ++it, ++done) {
+                consume(std::move(*it));
+            }
+        } catch (...) {
+            container_.pop_front_n(done);
+            throw;
+        }
+        container_.pop_front_n(done);
+        return done;
+    }
+
     Container container_;
 };
 
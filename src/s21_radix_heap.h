@@ -0,0 +1,324 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_RADIX_HEAP_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_RADIX_HEAP_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @brief s21::radix_heap - monotone min-priority queue over unsigned integer
+ * keys: O(1) push and O(log C) amortized pop, where C is the key range
+ *
+ * @details "Monotone" means a pushed key may not be less than the last key
+ * that was popped (last_key()). Timers and Dijkstra-style searches satisfy
+ * that: nothing is scheduled in the past.
+ *
+ * Elements are kept in digits + 1 s21::vector buckets. Bucket 0 holds keys
+ * equal to last_key(), bucket b holds keys whose highest bit that differs
+ * from last_key() is bit b - 1. push() only appends to a bucket. When bucket
+ * 0 runs out, the first non-empty bucket is emptied: its minimum becomes the
+ * new last_key() and every element moves to a strictly lower bucket, so each
+ * element moves at most digits times over its lifetime.
+ *
+ * The interface follows s21::priority_queue with std::greater: top() is the
+ * smallest element. Elements with equal keys come out in no particular order.
+ *
+ * @tparam Key unsigned integer key type
+ * @tparam Value payload stored with the key; with void (the default) the
+ * elements are the keys themselves, otherwise std::pair<Key, Value>
+ */
+template <typename Key, typename Value = void>
+class radix_heap {
+    static_assert(std::is_integral_v<Key> && std::is_unsigned_v<Key>,
+                  "s21::radix_heap requires an unsigned integer key");
+
+  public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::conditional_t<std::is_void_v<Value>, Key,
+                                          std::pair<Key, Value>>;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+
+    // Member functions
+  public:
+    radix_heap() = default;
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param items Elements to initialize the heap with
+     */
+    radix_heap(std::initializer_list<value_type> const &items) {
+        for (const auto &item : items) {
+            push(item);
+        }
+    }
+
+    // Element access
+  public:
+    /**
+     * @brief Returns reference to the element with the smallest key, the one
+     * to be removed by pop(). UB on an empty heap
+     *
+     * @details Doesn't move elements or change last_key(): if bucket 0 is
+     * empty, the minimum of the first non-empty bucket is found by a scan
+     * whose result is cached until the next pop()
+     */
+    const_reference top() const {
+        const bucket_type *buckets = Buckets();
+        if (buckets[0].size() != 0) {
+            return buckets[0].data()[buckets[0].size() - 1];
+        }
+        FindMin();
+        return buckets[min_bucket_].data()[min_index_];
+    }
+
+    /**
+     * @brief Key of top(). UB on an empty heap
+     */
+    key_type top_key() const {
+        return KeyOf(top());
+    }
+
+    /**
+     * @brief Lower bound for the keys of new elements: the key of the last
+     * popped element, 0 at first
+     */
+    key_type last_key() const noexcept {
+        return last_;
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    // Modifiers
+  public:
+    /**
+     * @brief Pushes the given element, O(1)
+     *
+     * @param value the value of the element to push
+     * @throw std::invalid_argument if its key is less than last_key()
+     */
+    void push(const_reference value) {
+        key_type key = KeyOf(value);
+        CheckKey(key);
+        Append(key, value);
+    }
+
+    void push(value_type &&value) {
+        key_type key = KeyOf(value);
+        CheckKey(key);
+        Append(key, std::move(value));
+    }
+
+    /**
+     * @brief Pushes an element constructed from args (for a keyed heap -
+     * the key and the payload)
+     *
+     * @param args arguments to forward to the constructor of the element
+     */
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        push(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Removes the element with the smallest key, O(log C) amortized.
+     * UB on an empty heap
+     *
+     * @details If growing a bucket throws, the heap is left unchanged,
+     * provided the move assignment of the elements doesn't throw
+     */
+    void pop() {
+        Pull();
+        Buckets()[0].pop_back();
+        --size_;
+    }
+
+    /**
+     * @brief Removes all the elements and resets last_key() to 0. The buckets
+     * keep their memory
+     */
+    void clear() noexcept {
+        for (size_type i = 0; i < kBuckets; ++i) {
+            Buckets()[i].clear();
+        }
+        size_ = 0;
+        last_ = 0;
+        has_min_ = false;
+    }
+
+    void swap(radix_heap &other) noexcept {
+        for (size_type i = 0; i < kBuckets; ++i) {
+            Buckets()[i].swap(other.Buckets()[i]);
+        }
+        std::swap(size_, other.size_);
+        std::swap(last_, other.last_);
+        std::swap(has_min_, other.has_min_);
+        std::swap(min_bucket_, other.min_bucket_);
+        std::swap(min_index_, other.min_index_);
+    }
+
+  private:
+    static constexpr int kDigits = std::numeric_limits<key_type>::digits;
+    static constexpr size_type kBuckets = kDigits + 1;
+
+    using bucket_type = s21::vector<value_type>;
+
+    static key_type KeyOf(const value_type &value) noexcept {
+        if constexpr (std::is_void_v<Value>) {
+            return value;
+        } else {
+            return value.first;
+        }
+    }
+
+    // s21::array::operator[] checks bounds, the hot paths index raw data
+    bucket_type *Buckets() noexcept {
+        return buckets_.data();
+    }
+
+    const bucket_type *Buckets() const noexcept {
+        return buckets_.data();
+    }
+
+    /**
+     * @brief Number of significant bits in x, 0 for 0
+     */
+    static size_type BitWidth(key_type x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        if (x == 0) {
+            return 0;
+        }
+        return std::numeric_limits<unsigned long long>::digits -
+               __builtin_clzll(static_cast<unsigned long long>(x));
+#else
+        size_type width = 0;
+        for (; x != 0; x >>= 1) {
+            ++width;
+        }
+        return width;
+#endif
+    }
+
+    size_type BucketOf(key_type key) const noexcept {
+        return BitWidth(key ^ last_);
+    }
+
+    void CheckKey(key_type key) const {
+        if (key < last_) {
+            throw std::invalid_argument(
+                "s21::radix_heap::push The key is less than the last popped "
+                "key");
+        }
+    }
+
+    template <typename V>
+    void Append(key_type key, V &&value) {
+        size_type b = BucketOf(key);
+        bucket_type &bucket = Buckets()[b];
+        bucket.push_back(std::forward<V>(value));
+        ++size_;
+        // The cached minimum of the buckets above 0 stays valid unless the
+        // new element is smaller
+        if (has_min_ && b != 0 &&
+            key < KeyOf(Buckets()[min_bucket_].data()[min_index_])) {
+            min_bucket_ = b;
+            min_index_ = bucket.size() - 1;
+        }
+    }
+
+    /**
+     * @brief Caches the position of the smallest element of the first
+     * non-empty bucket. Bucket 0 must be empty and the heap must not
+     */
+    void FindMin() const {
+        if (has_min_) {
+            return;
+        }
+        const bucket_type *buckets = Buckets();
+        size_type b = 1;
+        while (buckets[b].size() == 0) {
+            ++b;
+        }
+        const value_type *first = buckets[b].data();
+        size_type min = 0;
+        for (size_type i = 1; i < buckets[b].size(); ++i) {
+            if (KeyOf(first[i]) < KeyOf(first[min])) {
+                min = i;
+            }
+        }
+        min_bucket_ = b;
+        min_index_ = min;
+        has_min_ = true;
+    }
+
+    /**
+     * @brief Makes bucket 0 non-empty: redistributes the first non-empty
+     * bucket around its minimum, which becomes last_key()
+     */
+    void Pull() {
+        bucket_type *buckets = Buckets();
+        if (buckets[0].size() != 0) {
+            return;
+        }
+        FindMin();
+        size_type b = min_bucket_;
+        key_type min = KeyOf(buckets[b].data()[min_index_]);
+        key_type old_last = last_;
+        has_min_ = false;
+        last_ = min;
+        // Every key in bucket b differs from min below bit b - 1, so every
+        // element moves to a lower bucket
+        value_type *first = buckets[b].data();
+        value_type *last = first + buckets[b].size();
+        value_type *it = first;
+        try {
+            for (; it != last; ++it) {
+                buckets[BucketOf(KeyOf(*it))].push_back(std::move(*it));
+            }
+        } catch (...) {
+            // A push_back failed to grow its bucket. Keys are integers, so a
+            // moved-from element still has its key and tells which bucket
+            // its value went to: move the values back, newest first
+            while (it != first) {
+                --it;
+                bucket_type &target = buckets[BucketOf(KeyOf(*it))];
+                *it = std::move(target.data()[target.size() - 1]);
+                target.pop_back();
+            }
+            last_ = old_last;
+            throw;
+        }
+        buckets[b].clear();
+    }
+
+    s21::array<bucket_type, kBuckets> buckets_;
+    key_type last_ = 0;
+    size_type size_ = 0;
+    // Position of the minimum found by the const top(), valid while has_min_
+    mutable bool has_min_ = false;
+    mutable size_type min_bucket_ = 0;
+    mutable size_type min_index_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_RADIX_HEAP_H_
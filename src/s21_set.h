@@ -28,6 +28,7 @@
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_SET_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_SET_H_
 
+#include <iterator>
 #include <vector>
 
 #include "s21_tree.h"
@@ -52,6 +53,10 @@ class set {
     using const_iterator = typename tree_type::const_iterator;
     // Тип для размера контейнера
     using size_type = std::size_t;
+    // Дескриптор извлеченного узла (см. s21_node_handle.h)
+    using node_handle = typename tree_type::node_handle;
+    // Результат вставки дескриптора узла
+    using insert_return_type = typename tree_type::insert_return_type;
 
     /**
      * @brief Конструктор по умолчанию, создает пустое множество
@@ -71,6 +76,37 @@ class set {
         }
     }
 
+    /**
+     * @brief Конструктор из диапазона, создает множество из элементов
+     * [first, last).
+     * @details Вместо поэлементной вставки дерево строится сразу
+     * сбалансированным из отсортированных элементов (см. метод Build()
+     * реализации дерева). Из нескольких эквивалентных элементов остается
+     * первый.
+     *
+     * @param first Начало диапазона
+     * @param last Конец диапазона
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<
+                                    InputIt>::iterator_category>
+    set(InputIt first, InputIt last) : set() {
+        tree_->Build(first, last, true);
+    }
+
+    /**
+     * @brief Параллельная версия конструктора из диапазона: сортировка,
+     * создание узлов и построение дерева выполняются на потоках пула.
+     *
+     * @param first Начало диапазона
+     * @param last Конец диапазона
+     * @param policy Политика параллельного выполнения
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<
+                                    InputIt>::iterator_category>
+    set(InputIt first, InputIt last, parallel_policy policy) : set() {
+        tree_->Build(first, last, true, policy.pool_);
+    }
+
     /**
      * @brief Конструктор копирования (Copy Constructor). Создает множество
      * путем копирования данных из объекта other.
@@ -231,6 +267,40 @@ class set {
         tree_->Erase(pos);
     }
 
+    /**
+     * @brief Извлекает элемент на позиции pos из контейнера вместе с узлом,
+     * не удаляя его. Узел можно вставить в другой контейнер того же типа
+     * методом insert(node_handle &&) без выделения памяти.
+     *
+     * @param pos
+     * @return node_handle Дескриптор узла
+     */
+    node_handle extract(iterator pos) noexcept {
+        return tree_->Extract(pos);
+    }
+
+    /**
+     * @brief Извлекает элемент с ключом, эквивалентным key (см. extract())
+     *
+     * @param key
+     * @return node_handle Дескриптор узла (пустой, если элемента нет)
+     */
+    node_handle extract(const key_type &key) {
+        return tree_->Extract(key);
+    }
+
+    /**
+     * @brief Вставляет узел из дескриптора node, если контейнер ещё не
+     * содержит элемент с эквивалентным ключом. Память не выделяется.
+     *
+     * @param node Дескриптор узла, полученный из extract()
+     * @return insert_return_type Позиция, признак вставки и (если вставка не
+     * произошла) сам узел
+     */
+    insert_return_type insert(node_handle &&node) {
+        return tree_->InsertUnique(std::move(node));
+    }
+
     /**
      * @brief Обменяет содержимое контейнера на содержимое other
      *
@@ -253,6 +323,84 @@ class set {
         tree_->MergeUnique(*other.tree_);
     }
 
+    /**
+     * @brief Параллельная версия merge().
+     * @details Детали реализации описаны в методе MergeUnique() реализации
+     * дерева. Сложность O(n + m) вместо O(m log(n + m)) у последовательной
+     * версии, поэтому выигрыш есть и на одном потоке для множеств сравнимого
+     * размера.
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     */
+    void merge(set &other, parallel_policy policy) {
+        tree_->MergeUnique(*other.tree_, *policy.pool_);
+    }
+
+    /**
+     * @brief Возвращает объединение множеств this и other.
+     *
+     * @param other
+     * @return set
+     */
+    set set_union(const set &other) const {
+        return set(tree_->Union(*other.tree_));
+    }
+
+    /**
+     * @brief Параллельная версия set_union()
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     * @return set
+     */
+    set set_union(const set &other, parallel_policy policy) const {
+        return set(tree_->Union(*other.tree_, policy.pool_));
+    }
+
+    /**
+     * @brief Возвращает пересечение множеств this и other.
+     *
+     * @param other
+     * @return set
+     */
+    set set_intersection(const set &other) const {
+        return set(tree_->Intersection(*other.tree_));
+    }
+
+    /**
+     * @brief Параллельная версия set_intersection()
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     * @return set
+     */
+    set set_intersection(const set &other, parallel_policy policy) const {
+        return set(tree_->Intersection(*other.tree_, policy.pool_));
+    }
+
+    /**
+     * @brief Возвращает разность множеств this и other (элементы this, которых
+     * нет в other).
+     *
+     * @param other
+     * @return set
+     */
+    set set_difference(const set &other) const {
+        return set(tree_->Difference(*other.tree_));
+    }
+
+    /**
+     * @brief Параллельная версия set_difference()
+     *
+     * @param other
+     * @param policy Политика параллельного выполнения
+     * @return set
+     */
+    set set_difference(const set &other, parallel_policy policy) const {
+        return set(tree_->Difference(*other.tree_, policy.pool_));
+    }
+
     /**
      * @brief Находит элемент с ключом, эквивалентным key.
      *
@@ -308,6 +456,14 @@ class set {
     }
 
   private:
+    /**
+     * @brief Создает множество, забирая содержимое готового дерева tree
+     *
+     * @param tree
+     */
+    explicit set(tree_type &&tree) : tree_(new tree_type(std::move(tree))) {
+    }
+
     // Указатель на объект созданного дерева, используемого в контейнере
     tree_type *tree_;
 };
@@ -0,0 +1,736 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_SOA_VECTOR_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+
+/**
+ * @brief Contiguous run of elements: a pointer and a size (std::span is
+ * C++20). Doesn't own the elements. operator[] is unchecked, like std::span
+ *
+ * @tparam T element type, const-qualified for a read-only view
+ */
+template <typename T>
+class column_span {
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using reference = T &;
+    using pointer = T *;
+    using iterator = T *;
+    using size_type = std::size_t;
+
+    constexpr column_span() noexcept = default;
+
+    constexpr column_span(pointer data, size_type size) noexcept
+        : data_(data), size_(size) {
+    }
+
+    constexpr reference operator[](size_type pos) const noexcept {
+        return data_[pos];
+    }
+
+    /**
+     * @brief Access to the first element. UB on an empty span
+     */
+    constexpr reference front() const noexcept {
+        return data_[0];
+    }
+
+    /**
+     * @brief Access to the last element. UB on an empty span
+     */
+    constexpr reference back() const noexcept {
+        return data_[size_ - 1];
+    }
+
+    constexpr pointer data() const noexcept {
+        return data_;
+    }
+
+    constexpr iterator begin() const noexcept {
+        return data_;
+    }
+
+    constexpr iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+  private:
+    pointer data_ = nullptr;
+    size_type size_ = 0;
+};
+
+/**
+ * @brief s21::soa_vector - growable sequence of records stored as a structure
+ * of arrays: field I of every record lives in its own contiguous column
+ *
+ * @details A pass that reads one field of s21::vector<Record> drags the whole
+ * record through the cache; here it streams a single dense column:
+ *
+ *     s21::soa_vector<std::uint64_t, double, std::int32_t> orders;
+ *     orders.push_back({42, 9.99, 3});
+ *     double total = 0;
+ *     for (double price : orders.column<1>()) total += price;
+ *
+ * Every column starts on a kCacheLineSize boundary (or stricter, if a field
+ * needs it), so a column is a valid target for aligned SIMD loads and
+ * auto-vectorized loops. The columns share size and capacity and grow
+ * together, by doubling.
+ *
+ * A record is read through a tuple of references (reference), which also
+ * works with structured bindings: for (auto [id, price, qty] : orders).
+ * The iterator is random access over those proxies and has no operator->.
+ *
+ * Like s21::vector, growing moves the elements, so any push may invalidate
+ * references, spans and iterators.
+ *
+ * @tparam Ts types of the fields, one column each
+ */
+template <typename... Ts>
+class soa_vector {
+    static_assert(sizeof...(Ts) > 0, "s21::soa_vector needs a column");
+
+    template <bool IsConst>
+    class SoaIterator;
+
+  public:
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts &...>;
+    using const_reference = std::tuple<const Ts &...>;
+    using iterator = SoaIterator<false>;
+    using const_iterator = SoaIterator<true>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <std::size_t I>
+    using column_type = std::tuple_element_t<I, value_type>;
+
+    // Alignment of the first element of every column
+    static constexpr std::size_t kColumnAlignment =
+        std::max({kCacheLineSize, alignof(Ts)...});
+
+    // Member functions
+  public:
+    /**
+     * @brief Default constructor, doesn't allocate. The other constructors
+     * delegate to it, so if they throw, the destructor frees the records
+     * built so far and the columns
+     */
+    soa_vector() noexcept {
+    }
+
+    /**
+     * @brief Parameterized constructor, creates size records with
+     * value-initialized fields
+     *
+     * @param size Number of records
+     */
+    explicit soa_vector(size_type size) : soa_vector() {
+        resize(size);
+    }
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param init Records to initialize the container with
+     */
+    soa_vector(std::initializer_list<value_type> const &init)
+        : soa_vector() {
+        reserve(init.size());
+        for (const auto &item : init) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Copy constructor - copies all records from the rhs
+     *
+     * @param rhs Object to copy from
+     */
+    soa_vector(const soa_vector &rhs) : soa_vector() {
+        reserve(rhs.size_);
+        for (const_reference record : rhs) {
+            std::apply(
+                [this](const Ts &...fields) {
+                    ConstructBack(std::index_sequence_for<Ts...>(), fields...);
+                },
+                record);
+        }
+    }
+
+    /**
+     * @brief Move constructor - steals all the resources from the given object
+     *
+     * @param rhs Object to steal resources from
+     */
+    soa_vector(soa_vector &&rhs) noexcept
+        : columns_(std::exchange(rhs.columns_, columns_type())),
+          size_(std::exchange(rhs.size_, 0)),
+          capacity_(std::exchange(rhs.capacity_, 0)) {
+    }
+
+    /**
+     * @brief Destructor - destroys the records and frees the columns
+     */
+    ~soa_vector() {
+        clear();
+        Deallocate(columns_);
+    }
+
+    /**
+     * @brief Copy assignment - copies all the records from the given object
+     *
+     * @param rhs Objects to copy records from
+     * @return Results of the copy assignment
+     */
+    soa_vector &operator=(const soa_vector &rhs) {
+        if (this != &rhs) {
+            soa_vector copy(rhs);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment - steals all the resources from the given object
+     *
+     * @param rhs Objects to steal resources from
+     * @return Results of the move assignment
+     */
+    soa_vector &operator=(soa_vector &&rhs) noexcept {
+        if (this != &rhs) {
+            soa_vector moved(std::move(rhs));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    // Element Access
+  public:
+    /**
+     * @brief Safe access to the records of the container
+     *
+     * @param pos Index of the record to access
+     * @return References to the fields of the record at the given index
+     */
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range(
+                "s21::soa_vector::at The index is out of range");
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range(
+                "s21::soa_vector::at The index is out of range");
+        }
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Unchecked access to the records of the container
+     *
+     * @param pos Index of the record to access
+     * @return References to the fields of the record at the given index
+     */
+    reference operator[](size_type pos) noexcept {
+        return MakeRow<reference>(columns_, pos,
+                                  std::index_sequence_for<Ts...>());
+    }
+
+    const_reference operator[](size_type pos) const noexcept {
+        return MakeRow<const_reference>(columns_, pos,
+                                        std::index_sequence_for<Ts...>());
+    }
+
+    /**
+     * @brief Access to the first record. UB on an empty container
+     */
+    reference front() noexcept {
+        return (*this)[0];
+    }
+
+    const_reference front() const noexcept {
+        return (*this)[0];
+    }
+
+    /**
+     * @brief Access to the last record. UB on an empty container
+     */
+    reference back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    const_reference back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    /**
+     * @brief Pointer to the first element of column I, aligned to
+     * kColumnAlignment; nullptr if nothing was allocated yet
+     */
+    template <std::size_t I>
+    column_type<I> *data() noexcept {
+        return std::get<I>(columns_);
+    }
+
+    template <std::size_t I>
+    const column_type<I> *data() const noexcept {
+        return std::get<I>(columns_);
+    }
+
+    /**
+     * @brief Field I of every record, as one contiguous span
+     */
+    template <std::size_t I>
+    column_span<column_type<I>> column() noexcept {
+        return {data<I>(), size_};
+    }
+
+    template <std::size_t I>
+    column_span<const column_type<I>> column() const noexcept {
+        return {data<I>(), size_};
+    }
+
+    // Iterators
+  public:
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() /
+               (sizeof(Ts) + ...);
+    }
+
+    /**
+     * @brief Number of records the container can hold without reallocating
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Makes room for at least new_capacity records in every column
+     *
+     * @throw std::length_error if new_capacity exceeds max_size()
+     */
+    void reserve(size_type new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error(
+                "s21::soa_vector::reserve() exceeds max_size()");
+        }
+        if (new_capacity > capacity_) {
+            Reallocate(new_capacity);
+        }
+    }
+
+    /**
+     * @brief Releases the unused capacity of the columns
+     */
+    void shrink_to_fit() {
+        if (size_ == 0) {
+            Deallocate(columns_);
+            columns_ = columns_type();
+            capacity_ = 0;
+        } else if (size_ < capacity_) {
+            Reallocate(size_);
+        }
+    }
+
+    // Modifiers
+  public:
+    /**
+     * @brief Destroys all the records, the columns keep their memory
+     */
+    void clear() noexcept {
+        while (size_ != 0) {
+            pop_back();
+        }
+    }
+
+    /**
+     * @brief Appends a record, copying or moving its fields into the columns
+     *
+     * @param value the record to append
+     */
+    void push_back(const value_type &value) {
+        std::apply([this](const Ts &...fields) { emplace_back(fields...); },
+                   value);
+    }
+
+    void push_back(value_type &&value) {
+        std::apply(
+            [this](Ts &...fields) { emplace_back(std::move(fields)...); },
+            value);
+    }
+
+    /**
+     * @brief Appends a record whose field I is constructed in place in column
+     * I from fields[I]. If a field constructor throws, nothing is appended
+     *
+     * @param fields one argument per column
+     * @return References to the fields of the new record
+     */
+    template <typename... Args>
+    reference emplace_back(Args &&...fields) {
+        static_assert(sizeof...(Args) == sizeof...(Ts),
+                      "s21::soa_vector::emplace_back takes one argument per "
+                      "column");
+        if (size_ == capacity_) {
+            // fields may refer to a record of this container, so they are
+            // read before the columns move
+            value_type value(std::forward<Args>(fields)...);
+            Reallocate(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
+            std::apply(
+                [this](Ts &...moved) {
+                    ConstructBack(std::index_sequence_for<Ts...>(),
+                                  std::move(moved)...);
+                },
+                value);
+        } else {
+            ConstructBack(std::index_sequence_for<Ts...>(),
+                          std::forward<Args>(fields)...);
+        }
+        return back();
+    }
+
+    /**
+     * @brief Removes the last record. UB on an empty container
+     */
+    void pop_back() noexcept {
+        --size_;
+        DestroyRow(size_, sizeof...(Ts));
+    }
+
+    /**
+     * @brief Resizes the container to count records, appending records with
+     * value-initialized fields or removing records from the back
+     */
+    void resize(size_type count) {
+        while (size_ > count) {
+            pop_back();
+        }
+        reserve(count);
+        while (size_ < count) {
+            ConstructBack(std::index_sequence_for<Ts...>(), Ts()...);
+        }
+    }
+
+    void swap(soa_vector &other) noexcept {
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+  private:
+    using columns_type = std::tuple<Ts *...>;
+
+    static constexpr size_type kMinCapacity = 16;
+
+    // A record is split over the columns, so growing moves the columns only
+    // if no move can throw: otherwise a throw in column I would leave the
+    // earlier columns moved from. Move-only types are moved regardless
+    static constexpr bool kMoveOnGrow =
+        (std::is_nothrow_move_constructible_v<Ts> && ...) ||
+        !(std::is_copy_constructible_v<Ts> && ...);
+
+    /**
+     * @brief Calls f(std::integral_constant<std::size_t, I>()) for every
+     * column I in order
+     */
+    template <typename F>
+    static void ForEachColumn(F &&f) {
+        ForEachColumn(f, std::index_sequence_for<Ts...>());
+    }
+
+    template <typename F, std::size_t... I>
+    static void ForEachColumn(F &f, std::index_sequence<I...>) {
+        (f(std::integral_constant<std::size_t, I>()), ...);
+    }
+
+    template <typename Row, std::size_t... I>
+    static Row MakeRow(const columns_type &columns, size_type pos,
+                       std::index_sequence<I...>) noexcept {
+        return Row(std::get<I>(columns)[pos]...);
+    }
+
+    template <typename U>
+    static U *AllocateColumn(size_type count) {
+        return static_cast<U *>(::operator new(
+            count * sizeof(U), std::align_val_t(kColumnAlignment)));
+    }
+
+    static void Deallocate(const columns_type &columns) noexcept {
+        ForEachColumn([&columns](auto column) {
+            ::operator delete(std::get<decltype(column)::value>(columns),
+                              std::align_val_t(kColumnAlignment));
+        });
+    }
+
+    /**
+     * @brief Destroys the fields of record pos in the first count columns
+     */
+    void DestroyRow(size_type pos, size_type count) noexcept {
+        ForEachColumn([this, pos, count](auto column) {
+            if (decltype(column)::value < count) {
+                std::destroy_at(std::get<decltype(column)::value>(columns_) +
+                                pos);
+            }
+        });
+    }
+
+    /**
+     * @brief Constructs record size_ in place from fields, which must fit in
+     * the capacity. Rolls the record back if a field constructor throws
+     */
+    template <std::size_t... I, typename... Args>
+    void ConstructBack(std::index_sequence<I...>, Args &&...fields) {
+        size_type built = 0;
+        try {
+            ((::new (static_cast<void *>(std::get<I>(columns_) + size_))
+                  column_type<I>(std::forward<Args>(fields)),
+              ++built),
+             ...);
+        } catch (...) {
+            DestroyRow(size_, built);
+            throw;
+        }
+        ++size_;
+    }
+
+    /**
+     * @brief Moves (see kMoveOnGrow) every column into a new one of
+     * new_capacity elements. Strong guarantee if the move constructors don't
+     * throw or the types are copyable
+     */
+    void Reallocate(size_type new_capacity) {
+        columns_type columns{};
+        // Columns fully built in columns, and elements built in the next one
+        size_type done = 0;
+        size_type moved = 0;
+        try {
+            ForEachColumn([&columns, new_capacity](auto column) {
+                constexpr std::size_t kI = decltype(column)::value;
+                std::get<kI>(columns) =
+                    AllocateColumn<column_type<kI>>(new_capacity);
+            });
+            ForEachColumn([this, &columns, &done, &moved](auto column) {
+                constexpr std::size_t kI = decltype(column)::value;
+                using field_type = column_type<kI>;
+                field_type *from = std::get<kI>(columns_);
+                field_type *to = std::get<kI>(columns);
+                for (moved = 0; moved < size_; ++moved) {
+                    if constexpr (kMoveOnGrow) {
+                        ::new (static_cast<void *>(to + moved))
+                            field_type(std::move(from[moved]));
+                    } else {
+                        ::new (static_cast<void *>(to + moved))
+                            field_type(from[moved]);
+                    }
+                }
+                ++done;
+            });
+        } catch (...) {
+            ForEachColumn([this, &columns, done, moved](auto column) {
+                constexpr std::size_t kI = decltype(column)::value;
+                size_type count = kI < done ? size_ : kI == done ? moved : 0;
+                std::destroy_n(std::get<kI>(columns), count);
+            });
+            Deallocate(columns);
+            throw;
+        }
+
+        size_type size = size_;
+        clear();
+        Deallocate(columns_);
+        columns_ = columns;
+        capacity_ = new_capacity;
+        size_ = size;
+    }
+
+    /**
+     * @brief Random access iterator over the records: the container and an
+     * index. Dereferencing yields a tuple of references, not a real reference
+     */
+    template <bool IsConst>
+    class SoaIterator {
+        using container_pointer =
+            std::conditional_t<IsConst, const soa_vector *, soa_vector *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = soa_vector::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference =
+            std::conditional_t<IsConst, soa_vector::const_reference,
+                               soa_vector::reference>;
+
+        SoaIterator() noexcept = default;
+
+        SoaIterator(container_pointer container, size_type index) noexcept
+            : container_(container), index_(index) {
+        }
+
+        // iterator converts to const_iterator
+        template <bool OtherConst,
+                  typename = std::enable_if_t<IsConst && !OtherConst>>
+        SoaIterator(const SoaIterator<OtherConst> &other) noexcept
+            : container_(other.container_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*container_)[index_];
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return (*container_)[index_ + n];
+        }
+
+        SoaIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        SoaIterator operator++(int) noexcept {
+            SoaIterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        SoaIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        SoaIterator operator--(int) noexcept {
+            SoaIterator tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        SoaIterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        SoaIterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend SoaIterator operator+(SoaIterator it,
+                                     difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend SoaIterator operator+(difference_type n,
+                                     SoaIterator it) noexcept {
+            return it += n;
+        }
+
+        friend SoaIterator operator-(SoaIterator it,
+                                     difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const SoaIterator &lhs,
+                                         const SoaIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const SoaIterator &lhs,
+                               const SoaIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const SoaIterator &lhs,
+                               const SoaIterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const SoaIterator &lhs,
+                              const SoaIterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const SoaIterator &lhs,
+                              const SoaIterator &rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const SoaIterator &lhs,
+                               const SoaIterator &rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const SoaIterator &lhs,
+                               const SoaIterator &rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+      private:
+        friend class soa_vector;
+        template <bool>
+        friend class SoaIterator;
+
+        container_pointer container_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    columns_type columns_{};
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_SOA_VECTOR_H_
@@ -0,0 +1,365 @@
+/**
+ * @file s21_spsc_queue.h
+ * @brief s21::spsc_queue - lock-free очередь фиксированной емкости для
+ * передачи данных от одного потока-производителя одному потоку-потребителю.
+ *
+ * @details Кольцевой буфер из степени двойки ячеек и два монотонно растущих
+ * индекса: tail_ пишет только производитель, head_ - только потребитель.
+ * Синхронизация - одна release-запись своего индекса и acquire-чтение чужого,
+ * без атомарных read-modify-write операций.
+ *
+ * Чтобы потоки не делили кэш-линии:
+ * - индексы лежат на разных кэш-линиях;
+ * - каждая сторона хранит локальную копию чужого индекса и перечитывает его,
+ * только когда по копии очередь выглядит полной (пустой).
+ *
+ * push_n()/pop_n() переносят пачку элементов за одну публикацию индекса и
+ * одно уведомление. Блокирующие push()/pop(value) ждут по стратегии Wait
+ * (см. s21_wait_strategy.h).
+ *
+ * Методы производителя (push*, try_push*, emplace) и потребителя (front, pop*,
+ * try_pop*) можно вызывать одновременно только из одного потока каждой
+ * стороны. empty() и size() можно вызывать из любого потока, но результат
+ * приблизительный.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_SPSC_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_SPSC_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_cache_line.h"
+#include "s21_wait_strategy.h"
+
+namespace s21 {
+/**
+ * @brief Очередь одного производителя и одного потребителя
+ *
+ * @tparam T Тип элемента
+ * @tparam Wait Стратегия ожидания блокирующих операций
+ */
+template <typename T, typename Wait = yield_wait>
+class spsc_queue {
+  public:
+    // Тип элемента
+    using value_type = T;
+    // Тип ссылки на элемент
+    using reference = T &;
+    // Тип константной ссылки на элемент
+    using const_reference = const T &;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+    // Стратегия ожидания
+    using wait_strategy = Wait;
+
+    /**
+     * @brief Создает очередь
+     *
+     * @param capacity Минимальная емкость, округляется вверх до степени двойки
+     */
+    explicit spsc_queue(size_type capacity = 1024)
+        : capacity_(RoundUpToPowerOfTwo(capacity)),
+          mask_(capacity_ - 1),
+          buffer_(static_cast<value_type *>(
+              ::operator new(capacity_ * sizeof(value_type),
+                             std::align_val_t(alignof(value_type))))) {
+    }
+
+    spsc_queue(const spsc_queue &) = delete;
+    spsc_queue &operator=(const spsc_queue &) = delete;
+
+    /**
+     * @brief Деструктор удаляет оставшиеся элементы. Оба потока к этому
+     * моменту должны закончить работу с очередью
+     */
+    ~spsc_queue() {
+        size_type tail = producer_.tail_.load(std::memory_order_acquire);
+        for (size_type i = consumer_.head_.load(std::memory_order_relaxed);
+             i != tail; ++i) {
+            Slot(i)->~value_type();
+        }
+        ::operator delete(buffer_, std::align_val_t(alignof(value_type)));
+    }
+
+    /**
+     * @brief Емкость очереди (степень двойки)
+     */
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Количество элементов на момент вызова
+     */
+    size_type size() const noexcept {
+        size_type head = consumer_.head_.load(std::memory_order_acquire);
+        size_type tail = producer_.tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // Методы производителя
+
+    /**
+     * @brief Создает элемент в конце очереди из args, если есть место
+     *
+     * @return false Очередь полна, ничего не создано
+     */
+    template <typename... Args>
+    bool try_emplace(Args &&...args) {
+        size_type tail = producer_.tail_.load(std::memory_order_relaxed);
+        if (!HasRoomFor(tail, 1)) {
+            return false;
+        }
+        ::new (static_cast<void *>(Slot(tail)))
+            value_type(std::forward<Args>(args)...);
+        Publish(tail + 1);
+        return true;
+    }
+
+    bool try_push(const_reference value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(value_type &&value) {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief Создает элемент в конце очереди из args, при необходимости
+     * дожидаясь места
+     */
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        size_type tail = producer_.tail_.load(std::memory_order_relaxed);
+        if (!HasRoomFor(tail, 1)) {
+            not_full_.Wait([this, tail] { return HasRoomFor(tail, 1); });
+        }
+        ::new (static_cast<void *>(Slot(tail)))
+            value_type(std::forward<Args>(args)...);
+        Publish(tail + 1);
+    }
+
+    void push(const_reference value) {
+        emplace(value);
+    }
+
+    void push(value_type &&value) {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Копирует в очередь до count элементов из [first, ...) столько,
+     * сколько помещается, и публикует их разом
+     *
+     * @details Если копирование элемента бросило исключение, уже созданные
+     * элементы остаются в очереди, исключение пробрасывается дальше
+     *
+     * @param first Начало входной последовательности
+     * @param count Сколько элементов взять
+     * @return size_type Сколько элементов добавлено
+     */
+    template <typename InputIt>
+    size_type push_n(InputIt first, size_type count) {
+        size_type tail = producer_.tail_.load(std::memory_order_relaxed);
+        size_type room = capacity_ - (tail - producer_.head_cache_);
+        if (room < count) {
+            producer_.head_cache_ =
+                consumer_.head_.load(std::memory_order_acquire);
+            room = capacity_ - (tail - producer_.head_cache_);
+        }
+        size_type pushed = 0;
+        size_type n = std::min(count, room);
+        try {
+            for (; pushed < n; ++pushed, ++first) {
+                ::new (static_cast<void *>(Slot(tail + pushed)))
+                    value_type(*first);
+            }
+        } catch (...) {
+            if (pushed != 0) {
+                Publish(tail + pushed);
+            }
+            throw;
+        }
+        if (pushed != 0) {
+            Publish(tail + pushed);
+        }
+        return pushed;
+    }
+
+    // Методы потребителя
+
+    /**
+     * @brief Первый элемент очереди. Очередь не должна быть пустой (см.
+     * empty() или try_pop())
+     */
+    reference front() noexcept {
+        return *Slot(consumer_.head_.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Удаляет первый элемент. Очередь не должна быть пустой
+     */
+    void pop() noexcept {
+        size_type head = consumer_.head_.load(std::memory_order_relaxed);
+        Slot(head)->~value_type();
+        Consume(head + 1);
+    }
+
+    /**
+     * @brief Переносит первый элемент в value и удаляет его, если очередь не
+     * пуста
+     *
+     * @return false Очередь пуста, value не изменен
+     */
+    bool try_pop(reference value) {
+        size_type head = consumer_.head_.load(std::memory_order_relaxed);
+        if (!HasItems(head, 1)) {
+            return false;
+        }
+        TakeOne(head, value);
+        return true;
+    }
+
+    /**
+     * @brief Переносит первый элемент в value и удаляет его, при
+     * необходимости дожидаясь элемента
+     */
+    void pop(reference value) {
+        size_type head = consumer_.head_.load(std::memory_order_relaxed);
+        if (!HasItems(head, 1)) {
+            not_empty_.Wait([this, head] { return HasItems(head, 1); });
+        }
+        TakeOne(head, value);
+    }
+
+    /**
+     * @brief Переносит в out до max_count элементов, сколько есть в очереди,
+     * и освобождает их ячейки разом
+     *
+     * @param out Выходной итератор
+     * @param max_count Сколько элементов взять не более
+     * @return size_type Сколько элементов перенесено
+     */
+    template <typename OutputIt>
+    size_type pop_n(OutputIt out, size_type max_count) {
+        size_type head = consumer_.head_.load(std::memory_order_relaxed);
+        size_type available = consumer_.tail_cache_ - head;
+        if (available < max_count) {
+            consumer_.tail_cache_ =
+                producer_.tail_.load(std::memory_order_acquire);
+            available = consumer_.tail_cache_ - head;
+        }
+        size_type popped = 0;
+        size_type n = std::min(max_count, available);
+        try {
+            for (; popped < n; ++popped, ++out) {
+                value_type *slot = Slot(head + popped);
+                *out = std::move(*slot);
+                slot->~value_type();
+            }
+        } catch (...) {
+            if (popped != 0) {
+                Consume(head + popped);
+            }
+            throw;
+        }
+        if (popped != 0) {
+            Consume(head + popped);
+        }
+        return popped;
+    }
+
+  private:
+    static size_type RoundUpToPowerOfTwo(size_type value) {
+        if (value > (static_cast<size_type>(-1) >> 1) / sizeof(value_type)) {
+            throw std::length_error("s21::spsc_queue Capacity is too large");
+        }
+        size_type result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    value_type *Slot(size_type index) const noexcept {
+        return buffer_ + (index & mask_);
+    }
+
+    /**
+     * @brief Есть ли место для count элементов (производитель). Перечитывает
+     * head_, только если по кэшированной копии места нет
+     */
+    bool HasRoomFor(size_type tail, size_type count) noexcept {
+        if (capacity_ - (tail - producer_.head_cache_) >= count) {
+            return true;
+        }
+        producer_.head_cache_ = consumer_.head_.load(std::memory_order_acquire);
+        return capacity_ - (tail - producer_.head_cache_) >= count;
+    }
+
+    /**
+     * @brief Есть ли count элементов (потребитель). Перечитывает tail_, только
+     * если по кэшированной копии элементов нет
+     */
+    bool HasItems(size_type head, size_type count) noexcept {
+        if (consumer_.tail_cache_ - head >= count) {
+            return true;
+        }
+        consumer_.tail_cache_ = producer_.tail_.load(std::memory_order_acquire);
+        return consumer_.tail_cache_ - head >= count;
+    }
+
+    void Publish(size_type tail) noexcept {
+        producer_.tail_.store(tail, std::memory_order_release);
+        not_empty_.Notify();
+    }
+
+    void Consume(size_type head) noexcept {
+        consumer_.head_.store(head, std::memory_order_release);
+        not_full_.Notify();
+    }
+
+    void TakeOne(size_type head, reference value) {
+        value_type *slot = Slot(head);
+        value = std::move(*slot);
+        slot->~value_type();
+        Consume(head + 1);
+    }
+
+    // Данные производителя: индекс конца и его копия индекса начала
+    struct alignas(kCacheLineSize) ProducerSide {
+        std::atomic<size_type> tail_{0};
+        size_type head_cache_ = 0;
+    };
+
+    // Данные потребителя: индекс начала и его копия индекса конца
+    struct alignas(kCacheLineSize) ConsumerSide {
+        std::atomic<size_type> head_{0};
+        size_type tail_cache_ = 0;
+    };
+
+    // Неизменяемые после создания поля, которые читают оба потока
+    const size_type capacity_;
+    const size_type mask_;
+    value_type *const buffer_;
+
+    ProducerSide producer_;
+    ConsumerSide consumer_;
+    // Ожидание элементов (ждет потребитель, уведомляет производитель)
+    alignas(kCacheLineSize) Wait not_empty_;
+    // Ожидание места (ждет производитель, уведомляет потребитель)
+    alignas(kCacheLineSize) Wait not_full_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_SPSC_QUEUE_H_
@@ -0,0 +1,564 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_STABLE_VECTOR_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_STABLE_VECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.h"
+
+namespace s21 {
+
+/**
+ * @brief s21::stable_vector - growable sequence that never moves its
+ * elements: a segmented vector
+ *
+ * @details Instead of reallocating, it appends blocks of geometrically
+ * growing size: block 0 holds kFirstBlockSize elements and every next block
+ * twice as many as the one before. The element at index i is found with one
+ * count-leading-zeros and a shift, so indexing stays O(1), and at most half
+ * of the allocated memory is unused.
+ *
+ * Elements stay where they were constructed, so pointers and references to
+ * them remain valid through push_back(), emplace_back(), reserve() and
+ * pop_back() of other elements: a parser can hand out pointers into a
+ * stable_vector it keeps appending to. The iterators hold the container and
+ * an index, so only end() moves on push_back().
+ *
+ * clear() destroys the elements but keeps the blocks for reuse;
+ * shrink_to_fit() frees the unused ones.
+ *
+ * @tparam T containers type
+ */
+template <typename T>
+class stable_vector {
+    template <bool IsConst>
+    class StableIterator;
+
+  public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = StableIterator<false>;
+    using const_iterator = StableIterator<true>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // Size of the first block, a power of two
+    static constexpr size_type kFirstBlockSize = 16;
+
+    // Member functions
+  public:
+    /**
+     * @brief Default constructor, doesn't allocate. The other constructors
+     * delegate to it, so if they throw, the destructor frees the elements
+     * built so far and the blocks
+     */
+    stable_vector() noexcept {
+    }
+
+    /**
+     * @brief Parameterized constructor, creates a stable_vector of a given
+     * size with value-initialized elements
+     *
+     * @param size Size of the stable_vector
+     */
+    explicit stable_vector(size_type size) : stable_vector() {
+        resize(size);
+    }
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param init Elements to initialize the stable_vector with
+     */
+    stable_vector(std::initializer_list<value_type> const &init)
+        : stable_vector() {
+        reserve(init.size());
+        for (const auto &item : init) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Copy constructor - copies all values from the rhs
+     *
+     * @param rhs Object to copy from
+     */
+    stable_vector(const stable_vector &rhs) : stable_vector() {
+        reserve(rhs.size_);
+        for (const auto &item : rhs) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Move constructor - steals all the blocks from the given object
+     *
+     * @param rhs Object to steal resources from
+     */
+    stable_vector(stable_vector &&rhs) noexcept
+        : blocks_(std::exchange(rhs.blocks_, blocks_type{})),
+          block_count_(std::exchange(rhs.block_count_, 0)),
+          size_(std::exchange(rhs.size_, 0)),
+          capacity_(std::exchange(rhs.capacity_, 0)) {
+    }
+
+    /**
+     * @brief Destructor - destroys the elements and frees the blocks
+     */
+    ~stable_vector() {
+        clear();
+        FreeBlocks(0);
+    }
+
+    /**
+     * @brief Copy assignment - copies all the elements from the given object
+     *
+     * @param rhs Objects to copy elements from
+     * @return Results of the copy assignment
+     */
+    stable_vector &operator=(const stable_vector &rhs) {
+        if (this != &rhs) {
+            stable_vector copy(rhs);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment - steals all the blocks from the given object
+     *
+     * @param rhs Objects to steal resources from
+     * @return Results of the move assignment
+     */
+    stable_vector &operator=(stable_vector &&rhs) noexcept {
+        if (this != &rhs) {
+            stable_vector moved(std::move(rhs));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    // Element Access
+  public:
+    /**
+     * @brief Safe access to the elements of the container
+     *
+     * @param pos Index of the element to access
+     * @return The element at the given index
+     */
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range(
+                "s21::stable_vector::at The index is out of range");
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range(
+                "s21::stable_vector::at The index is out of range");
+        }
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Unchecked access to the elements of the container
+     *
+     * @param pos Index of the element to access
+     * @return The element at the given index
+     */
+    reference operator[](size_type pos) noexcept {
+        return *Slot(pos);
+    }
+
+    const_reference operator[](size_type pos) const noexcept {
+        return *Slot(pos);
+    }
+
+    /**
+     * @brief Access to the first element. UB on an empty stable_vector
+     */
+    reference front() noexcept {
+        return *Slot(0);
+    }
+
+    const_reference front() const noexcept {
+        return *Slot(0);
+    }
+
+    /**
+     * @brief Access to the last element. UB on an empty stable_vector
+     */
+    reference back() noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    const_reference back() const noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    // Iterators
+  public:
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() /
+               sizeof(value_type);
+    }
+
+    /**
+     * @brief Number of elements the allocated blocks can hold
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Allocates blocks until they can hold new_capacity elements.
+     * Never moves the existing elements
+     *
+     * @throw std::length_error if new_capacity exceeds max_size()
+     */
+    void reserve(size_type new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error(
+                "s21::stable_vector::reserve() exceeds max_size()");
+        }
+        while (capacity_ < new_capacity) {
+            AddBlock();
+        }
+    }
+
+    /**
+     * @brief Frees the blocks that hold no elements
+     */
+    void shrink_to_fit() noexcept {
+        size_type used = 0;
+        for (size_type held = 0; held < size_; ++used) {
+            held += BlockSize(used);
+        }
+        FreeBlocks(used);
+    }
+
+    // Modifiers
+  public:
+    /**
+     * @brief Destroys all the elements, the blocks stay allocated
+     */
+    void clear() noexcept {
+        while (size_ != 0) {
+            pop_back();
+        }
+    }
+
+    /**
+     * @brief Appends the given element value to the end of the container.
+     * Doesn't move the other elements
+     *
+     * @param value the value of the element to append
+     */
+    void push_back(const_reference value) {
+        emplace_back(value);
+    }
+
+    void push_back(value_type &&value) {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief Constructs an element from args in place at the end. Doesn't
+     * move the other elements, so args may refer to one of them
+     *
+     * @param args arguments to forward to the constructor of the element
+     * @return Reference to the new element
+     */
+    template <typename... Args>
+    reference emplace_back(Args &&...args) {
+        if (size_ == capacity_) {
+            AddBlock();
+        }
+        value_type *slot = Slot(size_);
+        ::new (static_cast<void *>(slot))
+            value_type(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    /**
+     * @brief Removes the last element. UB on an empty stable_vector
+     */
+    void pop_back() noexcept {
+        --size_;
+        Slot(size_)->~value_type();
+    }
+
+    /**
+     * @brief Resizes the container to count elements, appending
+     * value-initialized elements or removing elements from the back
+     */
+    void resize(size_type count) {
+        while (size_ > count) {
+            pop_back();
+        }
+        reserve(count);
+        while (size_ < count) {
+            emplace_back();
+        }
+    }
+
+    void swap(stable_vector &other) noexcept {
+        std::swap(blocks_, other.blocks_);
+        std::swap(block_count_, other.block_count_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+  private:
+    static constexpr size_type BlockShift() noexcept {
+        size_type shift = 0;
+        while ((size_type(1) << shift) < kFirstBlockSize) {
+            ++shift;
+        }
+        return shift;
+    }
+
+    static constexpr size_type kFirstBlockShift = BlockShift();
+    static_assert(size_type(1) << kFirstBlockShift == kFirstBlockSize,
+                  "s21::stable_vector first block size must be a power of "
+                  "two");
+
+    // Enough blocks for every index a size_type can hold
+    static constexpr size_type kMaxBlocks =
+        std::numeric_limits<size_type>::digits - kFirstBlockShift;
+
+    using blocks_type = s21::array<value_type *, kMaxBlocks>;
+
+    static constexpr size_type BlockSize(size_type block) noexcept {
+        return kFirstBlockSize << block;
+    }
+
+    /**
+     * @brief Number of significant bits in x, x > 0
+     */
+    static size_type BitWidth(size_type x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return std::numeric_limits<unsigned long long>::digits -
+               __builtin_clzll(static_cast<unsigned long long>(x));
+#else
+        size_type width = 0;
+        for (; x != 0; x >>= 1) {
+            ++width;
+        }
+        return width;
+#endif
+    }
+
+    /**
+     * @brief Address of the element at index pos: block k starts at index
+     * kFirstBlockSize * (2^k - 1), so the block is the highest bit of
+     * pos + kFirstBlockSize and the offset is the bits below it
+     */
+    value_type *Slot(size_type pos) const noexcept {
+        size_type shifted = pos + kFirstBlockSize;
+        size_type top = BitWidth(shifted) - 1;
+        return blocks_.data()[top - kFirstBlockShift] +
+               (shifted - (size_type(1) << top));
+    }
+
+    void AddBlock() {
+        size_type count = BlockSize(block_count_);
+        blocks_.data()[block_count_] = static_cast<value_type *>(
+            ::operator new(count * sizeof(value_type),
+                           std::align_val_t(alignof(value_type))));
+        ++block_count_;
+        capacity_ += count;
+    }
+
+    /**
+     * @brief Frees the blocks from first on, which must hold no elements
+     */
+    void FreeBlocks(size_type first) noexcept {
+        while (block_count_ > first) {
+            --block_count_;
+            ::operator delete(blocks_.data()[block_count_],
+                              std::align_val_t(alignof(value_type)));
+            blocks_.data()[block_count_] = nullptr;
+            capacity_ -= BlockSize(block_count_);
+        }
+    }
+
+    /**
+     * @brief Random access iterator: the stable_vector and an index, so it
+     * survives push_back()
+     */
+    template <bool IsConst>
+    class StableIterator {
+        using container_pointer =
+            std::conditional_t<IsConst, const stable_vector *,
+                               stable_vector *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        StableIterator() noexcept = default;
+
+        StableIterator(container_pointer container, size_type index) noexcept
+            : container_(container), index_(index) {
+        }
+
+        // iterator converts to const_iterator
+        template <bool OtherConst,
+                  typename = std::enable_if_t<IsConst && !OtherConst>>
+        StableIterator(const StableIterator<OtherConst> &other) noexcept
+            : container_(other.container_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return *container_->Slot(index_);
+        }
+
+        pointer operator->() const noexcept {
+            return container_->Slot(index_);
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *container_->Slot(index_ + n);
+        }
+
+        StableIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        StableIterator operator++(int) noexcept {
+            StableIterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        StableIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        StableIterator operator--(int) noexcept {
+            StableIterator tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        StableIterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        StableIterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend StableIterator operator+(StableIterator it,
+                                        difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend StableIterator operator+(difference_type n,
+                                        StableIterator it) noexcept {
+            return it += n;
+        }
+
+        friend StableIterator operator-(StableIterator it,
+                                        difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const StableIterator &lhs,
+                                         const StableIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const StableIterator &lhs,
+                               const StableIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const StableIterator &lhs,
+                               const StableIterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const StableIterator &lhs,
+                              const StableIterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const StableIterator &lhs,
+                              const StableIterator &rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const StableIterator &lhs,
+                               const StableIterator &rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const StableIterator &lhs,
+                               const StableIterator &rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+      private:
+        friend class stable_vector;
+        template <bool>
+        friend class StableIterator;
+
+        container_pointer container_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    blocks_type blocks_{};
+    size_type block_count_ = 0;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_STABLE_VECTOR_H_
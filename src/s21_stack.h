@@ -4,11 +4,11 @@
 #include <algorithm>
 #include <initializer_list>
 
-#include "s21_list.h"
+#include "s21_deque.h"
 
 namespace s21 {
 
-template <typename T, typename Container = s21::list<T>>
+template <typename T, typename Container = s21::deque<T>>
 class stack {
   public:
     using value_type = T;
@@ -178,11 +178,85 @@ class stack {
      * Container::emplace_back
      */
     template <typename... Args>
-    void emplace_front(Args &&...args) {
+    decltype(auto) emplace(Args &&...args) {
         return container_.emplace_back(std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Pushes every argument on top of the stack as a separate element
+     *
+     * @details Each argument goes through push(), so rvalues are moved into
+     * the container rather than copied
+     * @param args Elements to push
+     */
+    template <typename... Args>
+    void emplace_front(Args &&...args) {
+        (push(std::forward<Args>(args)), ...);
+    }
+
+    /**
+     * @brief Pushes the elements of [first, last) on top of the stack, the
+     * last one ends up on top. Effectively calls s.append_range(first, last),
+     * so the container can grow once for the whole batch
+     *
+     * @param first, last Range of elements to push
+     */
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        container_.append_range(first, last);
+    }
+
+    /**
+     * @brief Moves up to count elements from the top of the stack to out,
+     * in pop() order, then removes them with one call to s.pop_back_n()
+     *
+     * @param out Output iterator the elements are moved to
+     * @param count Maximum number of elements to pop
+     * @return Output iterator past the last written element
+     */
+    template <typename OutputIt>
+    OutputIt pop_n(OutputIt out, size_type count) {
+        ConsumeTop(std::min(count, size()), [&out](value_type &&value) {
+            *out = std::move(value);
+            ++out;
+        });
+        return out;
+    }
+
+    /**
+     * @brief Pops every element, passing it to callback(value_type &&) in
+     * pop() order, then removes them with one call to s.pop_back_n()
+     *
+     * @details The callback must not modify the stack. If it throws, the
+     * elements it has already consumed are removed and the rest stay
+     * @param callback Consumer of the elements
+     * @return The number of elements popped
+     */
+    template <typename Callback>
+    size_type drain(Callback callback) {
+        return ConsumeTop(size(), callback);
+    }
+
   private:
+    /**
+     * @brief Passes the top count elements to consume and pops them
+     */
+    template <typename Consume>
+    size_type ConsumeTop(size_type count, Consume &&consume) {
+        size_type done = 0;
+        try {
+            for (auto it = container_.end(); done < count; ++done) {
+                --it;
+                consume(std::move(*it));
+            }
+        } catch (...) {
+            container_.pop_back_n(done);
+            throw;
+        }
+        container_.pop_back_n(done);
+        return done;
+    }
+
     Container container_;
 };
 
@@ -0,0 +1,460 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_STATIC_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_STATIC_QUEUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @brief s21::static_queue - FIFO queue with a compile-time capacity that
+ * never touches the heap
+ *
+ * @details The elements live inline in uninitialized storage used as a ring
+ * buffer: a slot holds an object only while it holds an element, so T needs
+ * no default constructor and a popped element is destroyed right away. The
+ * ring has a power-of-two number of slots (N rounded up), so wrapping an
+ * index is a mask instead of a division. The interface matches s21::queue;
+ * in addition try_push()/try_pop() report a full/empty queue through the
+ * return value instead of throwing.
+ *
+ * @tparam T containers type
+ * @tparam N maximum number of elements
+ */
+template <typename T, std::size_t N>
+class static_queue {
+    static_assert(N > 0, "s21::static_queue capacity must be positive");
+
+  public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+
+    // Member functions
+  public:
+    static_queue() noexcept {
+    }
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param items Elements to initialize the queue with, front first
+     * @throw std::length_error if there are more than N items
+     */
+    explicit static_queue(std::initializer_list<value_type> const &items)
+        : static_queue() {
+        for (const auto &item : items) {
+            push(item);
+        }
+    }
+
+    /**
+     * @brief Copy constructor - copies the elements of rhs one by one
+     *
+     * @param rhs Object to copy from
+     */
+    static_queue(const static_queue &rhs) : static_queue() {
+        for (size_type i = 0; i < rhs.size_; ++i) {
+            Append(*rhs.Slot(i));
+        }
+    }
+
+    /**
+     * @brief Move constructor - moves the elements of rhs one by one and
+     * leaves rhs empty
+     *
+     * @param rhs Object to move from
+     */
+    static_queue(static_queue &&rhs) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>)
+        : static_queue() {
+        for (size_type i = 0; i < rhs.size_; ++i) {
+            Append(std::move(*rhs.Slot(i)));
+        }
+        rhs.clear();
+    }
+
+    /**
+     * @brief Destructor - destroys the elements
+     */
+    ~static_queue() {
+        clear();
+    }
+
+    /**
+     * @brief Copy assignment - replaces the elements with copies of the
+     * elements of rhs. Basic guarantee
+     *
+     * @param rhs Object to copy elements from
+     * @return Results of the copy assignment
+     */
+    static_queue &operator=(const static_queue &rhs) {
+        if (this != &rhs) {
+            clear();
+            for (size_type i = 0; i < rhs.size_; ++i) {
+                Append(*rhs.Slot(i));
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment - replaces the elements with the elements moved
+     * out of rhs and leaves rhs empty
+     *
+     * @param rhs Object to move elements from
+     * @return Results of the move assignment
+     */
+    static_queue &operator=(static_queue &&rhs) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        if (this != &rhs) {
+            clear();
+            for (size_type i = 0; i < rhs.size_; ++i) {
+                Append(std::move(*rhs.Slot(i)));
+            }
+            rhs.clear();
+        }
+        return *this;
+    }
+
+    // Element access
+  public:
+    /**
+     * @brief Returns reference to the first element, the next one to be
+     * removed by pop(). UB on an empty queue
+     */
+    reference front() noexcept {
+        return *Slot(0);
+    }
+
+    const_reference front() const noexcept {
+        return *Slot(0);
+    }
+
+    /**
+     * @brief Returns reference to the last, most recently pushed element. UB
+     * on an empty queue
+     */
+    reference back() noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    const_reference back() const noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        return size_ == N;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Maximum number of elements, N
+     */
+    [[nodiscard]] static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    // Queue Modifiers
+  public:
+    /**
+     * @brief Pushes the given element value to the end of the queue
+     *
+     * @param value the value of the element to push
+     * @throw std::length_error if the queue is full
+     */
+    void push(const_reference value) {
+        if (!try_push(value)) {
+            throw std::length_error(
+                "s21::static_queue::push The queue is full");
+        }
+    }
+
+    void push(value_type &&value) {
+        if (!try_push(std::move(value))) {
+            throw std::length_error(
+                "s21::static_queue::push The queue is full");
+        }
+    }
+
+    /**
+     * @brief Pushes the given element value to the end of the queue if there
+     * is room
+     *
+     * @param value the value of the element to push
+     * @return false if the queue is full and nothing was pushed
+     */
+    bool try_push(const_reference value) noexcept(
+        std::is_nothrow_copy_constructible_v<value_type>) {
+        if (full()) {
+            return false;
+        }
+        Append(value);
+        return true;
+    }
+
+    bool try_push(value_type &&value) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        if (full()) {
+            return false;
+        }
+        Append(std::move(value));
+        return true;
+    }
+
+    /**
+     * @brief Pushes a new element to the end of the queue, constructed in
+     * place in its slot from args
+     *
+     * @param args arguments to forward to the constructor of the element
+     * @return Reference to the new element
+     * @throw std::length_error if the queue is full
+     */
+    template <typename... Args>
+    reference emplace(Args &&...args) {
+        if (full()) {
+            throw std::length_error(
+                "s21::static_queue::emplace The queue is full");
+        }
+        Append(std::forward<Args>(args)...);
+        return back();
+    }
+
+    /**
+     * @brief Removes the first element. UB on an empty queue
+     */
+    void pop() noexcept {
+        std::destroy_at(Slot(0));
+        head_ = (head_ + 1) & kMask;
+        --size_;
+    }
+
+    /**
+     * @brief Destroys all elements
+     */
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < size_; ++i) {
+                std::destroy_at(Slot(i));
+            }
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Moves the first element into value and removes it
+     *
+     * @param value receives the removed element
+     * @return false if the queue is empty and value is untouched
+     */
+    bool try_pop(reference value) noexcept(
+        std::is_nothrow_move_assignable_v<value_type>) {
+        if (empty()) {
+            return false;
+        }
+        value = std::move(front());
+        pop();
+        return true;
+    }
+
+    /**
+     * @brief Exchanges the contents of two queues element by element: the
+     * common prefix is swapped, the rest of the longer queue is moved over
+     *
+     * @param other queue to exchange the contents with
+     */
+    void swap(static_queue &other) noexcept(
+        std::is_nothrow_move_constructible_v<value_type> &&
+        std::is_nothrow_swappable_v<value_type>) {
+        static_queue &longer = size_ < other.size_ ? other : *this;
+        static_queue &shorter = size_ < other.size_ ? *this : other;
+        size_type common = shorter.size_;
+        for (size_type i = 0; i < common; ++i) {
+            using std::swap;
+            swap(*Slot(i), *other.Slot(i));
+        }
+        for (size_type i = common; i < longer.size_; ++i) {
+            shorter.Append(std::move(*longer.Slot(i)));
+        }
+        for (size_type i = common; i < longer.size_; ++i) {
+            std::destroy_at(longer.Slot(i));
+        }
+        longer.size_ = common;
+    }
+
+    /**
+     * @brief Pushes the elements of [first, last) to the end of the queue
+     *
+     * @details For forward iterators the length of the range is checked up
+     * front, so a range that doesn't fit pushes nothing; each element then
+     * goes straight into its slot without a per-element capacity check.
+     * Input iterators push one element at a time
+     * @param first, last Range of elements to push
+     * @throw std::length_error if the elements don't fit
+     */
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        using Category =
+            typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        Category>) {
+            auto count = static_cast<size_type>(std::distance(first, last));
+            if (count > N - size_) {
+                throw std::length_error(
+                    "s21::static_queue::push_range The queue is full");
+            }
+            for (; first != last; ++first) {
+                Append(*first);
+            }
+        } else {
+            for (; first != last; ++first) {
+                push(*first);
+            }
+        }
+    }
+
+    /**
+     * @brief Moves up to count elements from the front of the queue to out,
+     * in pop() order, then removes them in one step
+     *
+     * @param out Output iterator the elements are moved to
+     * @param count Maximum number of elements to pop
+     * @return Output iterator past the last written element
+     */
+    template <typename OutputIt>
+    OutputIt pop_n(OutputIt out, size_type count) {
+        ConsumeFront(std::min(count, size_), [&out](value_type &&value) {
+            *out = std::move(value);
+            ++out;
+        });
+        return out;
+    }
+
+    /**
+     * @brief Pops every element, passing it to callback(value_type &&) in
+     * pop() order, then removes them in one step
+     *
+     * @details The callback must not modify the queue. If it throws, the
+     * elements it has already consumed are removed and the rest stay
+     * @param callback Consumer of the elements
+     * @return The number of elements popped
+     */
+    template <typename Callback>
+    size_type drain(Callback callback) {
+        return ConsumeFront(size_, callback);
+    }
+
+    /**
+     * @brief Pushes every argument to the end of the queue, following the
+     * convention of s21::queue
+     *
+     * @param args elements to push
+     * @throw std::length_error if the queue becomes full
+     */
+    template <typename... Args>
+    void emplace_back(Args &&...args) {
+        (push(std::forward<Args>(args)), ...);
+    }
+
+  private:
+    static constexpr size_type RoundUpToPowerOfTwo(size_type value) noexcept {
+        size_type result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static constexpr size_type kSlots = RoundUpToPowerOfTwo(N);
+    static constexpr size_type kMask = kSlots - 1;
+
+    /**
+     * @brief Raw storage of the slot at position pos counting from the front
+     */
+    void *Storage(size_type pos) noexcept {
+        return storage_ + ((head_ + pos) & kMask) * sizeof(value_type);
+    }
+
+    const void *Storage(size_type pos) const noexcept {
+        return storage_ + ((head_ + pos) & kMask) * sizeof(value_type);
+    }
+
+    /**
+     * @brief Element at position pos counting from the front. The element
+     * must be alive; launder makes the pointer refer to the object
+     * placement-constructed in the byte storage
+     */
+    value_type *Slot(size_type pos) noexcept {
+        return std::launder(static_cast<value_type *>(Storage(pos)));
+    }
+
+    const value_type *Slot(size_type pos) const noexcept {
+        return std::launder(static_cast<const value_type *>(Storage(pos)));
+    }
+
+    /**
+     * @brief Passes the first count elements to consume and pops them
+     */
+    template <typename Consume>
+    size_type ConsumeFront(size_type count, Consume &&consume) {
+        size_type done = 0;
+        try {
+            for (; done < count; ++done) {
+                consume(std::move(*Slot(done)));
+            }
+        } catch (...) {
+            PopFront(done);
+            throw;
+        }
+        PopFront(done);
+        return done;
+    }
+
+    /**
+     * @brief Destroys the first count elements
+     */
+    void PopFront(size_type count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < count; ++i) {
+                std::destroy_at(Slot(i));
+            }
+        }
+        head_ = (head_ + count) & kMask;
+        size_ -= count;
+    }
+
+    /**
+     * @brief Constructs an element at the back. The queue must not be full
+     */
+    template <typename... Args>
+    void Append(Args &&...args) {
+        ::new (Storage(size_)) value_type(std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    alignas(value_type) unsigned char storage_[kSlots * sizeof(value_type)];
+    size_type head_ = 0;
+    size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_STATIC_QUEUE_H_
@@ -0,0 +1,433 @@
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_STATIC_STACK_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_STATIC_STACK_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @brief s21::static_stack - LIFO stack with a compile-time capacity that
+ * never touches the heap
+ *
+ * @details The elements live inline in uninitialized storage: a slot holds
+ * an object only while it holds an element, so T needs no default
+ * constructor and a popped element is destroyed right away. The interface
+ * matches s21::stack; in addition try_push()/try_pop() report a full/empty
+ * stack through the return value instead of throwing.
+ *
+ * @tparam T containers type
+ * @tparam N maximum number of elements
+ */
+template <typename T, std::size_t N>
+class static_stack {
+    static_assert(N > 0, "s21::static_stack capacity must be positive");
+
+  public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+
+    // Member functions
+  public:
+    static_stack() noexcept {
+    }
+
+    /**
+     * @brief initializer_list constructor
+     *
+     * @param items Elements to initialize the stack with, the last one on top
+     * @throw std::length_error if there are more than N items
+     */
+    explicit static_stack(std::initializer_list<value_type> const &items)
+        : static_stack() {
+        for (const auto &item : items) {
+            push(item);
+        }
+    }
+
+    /**
+     * @brief Copy constructor - copies the elements of rhs one by one
+     *
+     * @param rhs Object to copy from
+     */
+    static_stack(const static_stack &rhs) : static_stack() {
+        for (size_type i = 0; i < rhs.size_; ++i) {
+            Append(*rhs.Slot(i));
+        }
+    }
+
+    /**
+     * @brief Move constructor - moves the elements of rhs one by one and
+     * leaves rhs empty
+     *
+     * @param rhs Object to move from
+     */
+    static_stack(static_stack &&rhs) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>)
+        : static_stack() {
+        for (size_type i = 0; i < rhs.size_; ++i) {
+            Append(std::move(*rhs.Slot(i)));
+        }
+        rhs.clear();
+    }
+
+    /**
+     * @brief Destructor - destroys the elements
+     */
+    ~static_stack() {
+        clear();
+    }
+
+    /**
+     * @brief Copy assignment - replaces the elements with copies of the
+     * elements of rhs. Basic guarantee
+     *
+     * @param rhs Object to copy elements from
+     * @return Results of the copy assignment
+     */
+    static_stack &operator=(const static_stack &rhs) {
+        if (this != &rhs) {
+            clear();
+            for (size_type i = 0; i < rhs.size_; ++i) {
+                Append(*rhs.Slot(i));
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment - replaces the elements with the elements moved
+     * out of rhs and leaves rhs empty
+     *
+     * @param rhs Object to move elements from
+     * @return Results of the move assignment
+     */
+    static_stack &operator=(static_stack &&rhs) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        if (this != &rhs) {
+            clear();
+            for (size_type i = 0; i < rhs.size_; ++i) {
+                Append(std::move(*rhs.Slot(i)));
+            }
+            rhs.clear();
+        }
+        return *this;
+    }
+
+    // Element access
+  public:
+    /**
+     * @brief Returns reference to the top element, the next one to be removed
+     * by pop(). UB on an empty stack
+     */
+    reference top() noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    const_reference top() const noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    // Capacity
+  public:
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        return size_ == N;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Maximum number of elements, N
+     */
+    [[nodiscard]] static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    // Stack Modifiers
+  public:
+    /**
+     * @brief Pushes the given element value to the top of the stack
+     *
+     * @param value the value of the element to push
+     * @throw std::length_error if the stack is full
+     */
+    void push(const_reference value) {
+        if (!try_push(value)) {
+            throw std::length_error(
+                "s21::static_stack::push The stack is full");
+        }
+    }
+
+    void push(value_type &&value) {
+        if (!try_push(std::move(value))) {
+            throw std::length_error(
+                "s21::static_stack::push The stack is full");
+        }
+    }
+
+    /**
+     * @brief Pushes the given element value to the top of the stack if there
+     * is room
+     *
+     * @param value the value of the element to push
+     * @return false if the stack is full and nothing was pushed
+     */
+    bool try_push(const_reference value) noexcept(
+        std::is_nothrow_copy_constructible_v<value_type>) {
+        if (full()) {
+            return false;
+        }
+        Append(value);
+        return true;
+    }
+
+    bool try_push(value_type &&value) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        if (full()) {
+            return false;
+        }
+        Append(std::move(value));
+        return true;
+    }
+
+    /**
+     * @brief Pushes a new element on top of the stack, constructed in place
+     * in its slot from args
+     *
+     * @param args arguments to forward to the constructor of the element
+     * @return Reference to the new element
+     * @throw std::length_error if the stack is full
+     */
+    template <typename... Args>
+    reference emplace(Args &&...args) {
+        if (full()) {
+            throw std::length_error(
+                "s21::static_stack::emplace The stack is full");
+        }
+        Append(std::forward<Args>(args)...);
+        return top();
+    }
+
+    /**
+     * @brief Removes the top element. UB on an empty stack
+     */
+    void pop() noexcept {
+        --size_;
+        std::destroy_at(Slot(size_));
+    }
+
+    /**
+     * @brief Destroys all elements
+     */
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < size_; ++i) {
+                std::destroy_at(Slot(i));
+            }
+        }
+        size_ = 0;
+    }
+
+    /**
+     * @brief Moves the top element into value and removes it
+     *
+     * @param value receives the removed element
+     * @return false if the stack is empty and value is untouched
+     */
+    bool try_pop(reference value) noexcept(
+        std::is_nothrow_move_assignable_v<value_type>) {
+        if (empty()) {
+            return false;
+        }
+        value = std::move(top());
+        pop();
+        return true;
+    }
+
+    /**
+     * @brief Exchanges the contents of two stacks element by element: the
+     * common bottom part is swapped, the rest of the taller stack is moved
+     * over
+     *
+     * @param other stack to exchange the contents with
+     */
+    void swap(static_stack &other) noexcept(
+        std::is_nothrow_move_constructible_v<value_type> &&
+        std::is_nothrow_swappable_v<value_type>) {
+        static_stack &taller = size_ < other.size_ ? other : *this;
+        static_stack &shorter = size_ < other.size_ ? *this : other;
+        size_type common = shorter.size_;
+        for (size_type i = 0; i < common; ++i) {
+            using std::swap;
+            swap(*Slot(i), *other.Slot(i));
+        }
+        for (size_type i = common; i < taller.size_; ++i) {
+            shorter.Append(std::move(*taller.Slot(i)));
+        }
+        for (size_type i = common; i < taller.size_; ++i) {
+            std::destroy_at(taller.Slot(i));
+        }
+        taller.size_ = common;
+    }
+
+    /**
+     * @brief Pushes the elements of [first, last) on top of the stack, the
+     * last one ends up on top
+     *
+     * @details For forward iterators the length of the range is checked up
+     * front, so a range that doesn't fit pushes nothing; each element then
+     * goes straight into its slot without a per-element capacity check.
+     * Input iterators push one element at a time
+     * @param first, last Range of elements to push
+     * @throw std::length_error if the elements don't fit
+     */
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        using Category =
+            typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        Category>) {
+            auto count = static_cast<size_type>(std::distance(first, last));
+            if (count > N - size_) {
+                throw std::length_error(
+                    "s21::static_stack::push_range The stack is full");
+            }
+            for (; first != last; ++first) {
+                Append(*first);
+            }
+        } else {
+            for (; first != last; ++first) {
+                push(*first);
+            }
+        }
+    }
+
+    /**
+     * @brief Moves up to count elements from the top of the stack to out,
+     * in pop() order, then removes them in one step
+     *
+     * @param out Output iterator the elements are moved to
+     * @param count Maximum number of elements to pop
+     * @return Output iterator past the last written element
+     */
+    template <typename OutputIt>
+    OutputIt pop_n(OutputIt out, size_type count) {
+        ConsumeTop(std::min(count, size_), [&out](value_type &&value) {
+            *out = std::move(value);
+            ++out;
+        });
+        return out;
+    }
+
+    /**
+     * @brief Pops every element, passing it to callback(value_type &&) in
+     * pop() order, then removes them in one step
+     *
+     * @details The callback must not modify the stack. If it throws, the
+     * elements it has already consumed are removed and the rest stay
+     * @param callback Consumer of the elements
+     * @return The number of elements popped
+     */
+    template <typename Callback>
+    size_type drain(Callback callback) {
+        return ConsumeTop(size_, callback);
+    }
+
+    /**
+     * @brief Pushes every argument to the top of the stack, following the
+     * convention of s21::stack
+     *
+     * @param args elements to push
+     * @throw std::length_error if the stack becomes full
+     */
+    template <typename... Args>
+    void emplace_front(Args &&...args) {
+        (push(std::forward<Args>(args)), ...);
+    }
+
+  private:
+    /**
+     * @brief Raw storage of the slot at position pos counting from the bottom
+     */
+    void *Storage(size_type pos) noexcept {
+        return storage_ + pos * sizeof(value_type);
+    }
+
+    const void *Storage(size_type pos) const noexcept {
+        return storage_ + pos * sizeof(value_type);
+    }
+
+    /**
+     * @brief Element at position pos counting from the bottom. The element
+     * must be alive; launder makes the pointer refer to the object
+     * placement-constructed in the byte storage
+     */
+    value_type *Slot(size_type pos) noexcept {
+        return std::launder(static_cast<value_type *>(Storage(pos)));
+    }
+
+    const value_type *Slot(size_type pos) const noexcept {
+        return std::launder(static_cast<const value_type *>(Storage(pos)));
+    }
+
+    /**
+     * @brief Passes the top count elements to consume and pops them
+     */
+    template <typename Consume>
+    size_type ConsumeTop(size_type count, Consume &&consume) {
+        size_type done = 0;
+        try {
+            for (; done < count; ++done) {
+                consume(std::move(*Slot(size_ - 1 - done)));
+            }
+        } catch (...) {
+            PopTop(done);
+            throw;
+        }
+        PopTop(done);
+        return done;
+    }
+
+    /**
+     * @brief Destroys the top count elements
+     */
+    void PopTop(size_type count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 1; i <= count; ++i) {
+                std::destroy_at(Slot(size_ - i));
+            }
+        }
+        size_ -= count;
+    }
+
+    /**
+     * @brief Constructs an element on the top. The stack must not be full
+     */
+    template <typename... Args>
+    void Append(Args &&...args) {
+        ::new (Storage(size_)) value_type(std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    alignas(value_type) unsigned char storage_[N * sizeof(value_type)];
+    size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_STATIC_STACK_H_
@@ -0,0 +1,367 @@
+/**
+ * @file s21_thread_pool.h
+ * @brief Небольшой пул потоков с перехватом задач (work stealing) для
+ * fork-join параллелизма в контейнерах библиотеки.
+ *
+ * @details У каждого рабочего потока есть своя очередь задач. Свои задачи
+ * поток берет с конца очереди (LIFO - так лучше используется кэш для
+ * рекурсивных fork-join алгоритмов), а при отсутствии своих задач ворует
+ * задачи у других потоков с начала их очередей (FIFO - так воруются самые
+ * "крупные" задачи). Задачи, отправленные из внешних потоков, попадают в
+ * отдельную общую очередь.
+ *
+ * Поток, ожидающий завершения группы задач (TaskGroup::Wait()), не простаивает,
+ * а сам выполняет задачи из очередей. Благодаря этому вложенные fork-join
+ * вызовы не приводят к взаимной блокировке, а вызывающий поток участвует в
+ * вычислениях наравне с рабочими потоками.
+ *
+ * Используются только средства стандартной библиотеки (std::thread).
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_THREAD_POOL_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+class ThreadPool {
+  public:
+    // Тип для количества потоков
+    using size_type = std::size_t;
+    // Тип задачи, выполняемой пулом
+    using task_type = std::function<void()>;
+
+    /**
+     * @brief Создает пул потоков
+     *
+     * @param threads Общее количество потоков, участвующих в вычислениях,
+     * включая поток, который ожидает результат. Т.е. создается threads - 1
+     * рабочих потоков. Пул из одного потока выполняет все задачи в вызывающем
+     * потоке.
+     */
+    explicit ThreadPool(size_type threads = std::thread::hardware_concurrency())
+        : queues_(std::max<size_type>(threads, 1)) {
+        workers_.reserve(queues_.size() - 1);
+        for (size_type i = 1; i < queues_.size(); ++i) {
+            workers_.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Деструктор дожидается завершения всех рабочих потоков. Задачи,
+     * которые к этому моменту остались в очередях, не выполняются.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Возвращает общее количество потоков пула (включая вызывающий)
+     *
+     * @return size_type
+     */
+    size_type Size() const noexcept {
+        return queues_.size();
+    }
+
+    /**
+     * @brief Ставит задачу в очередь. Если вызов сделан из рабочего потока
+     * этого пула, то задача попадает в очередь этого потока, иначе - в общую
+     * очередь (очередь с индексом 0, которую обслуживает вызывающий поток).
+     *
+     * @param task Задача
+     */
+    void Submit(task_type task) {
+        WorkQueue &queue = queues_[CurrentIndex()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex_);
+            queue.tasks_.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            ++pending_;
+        }
+        wake_.notify_one();
+    }
+
+    /**
+     * @brief Выполняет одну задачу из очередей пула, если она есть.
+     * @details Сначала проверяется своя очередь (с конца), затем по кругу
+     * очереди других потоков (с начала).
+     *
+     * @return true задача была выполнена
+     * @return false задач не нашлось
+     */
+    bool RunPendingTask() {
+        task_type task;
+        if (TakeTask(CurrentIndex(), task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Усыпляет вызывающий поток, пока в очередях нет задач и
+     * done() ложно. Поток, который делает done() истинным, должен после этого
+     * вызвать NotifyWaiters()
+     *
+     * @param done Условие окончания ожидания
+     */
+    template <typename Predicate>
+    void WaitForTaskOr(Predicate done) {
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        wake_.wait(lock, [this, &done] { return pending_ > 0 || done(); });
+    }
+
+    /**
+     * @brief Будит потоки, ожидающие в WaitForTaskOr(). Захват wake_mutex_
+     * гарантирует, что ожидающий либо уже увидел изменение условия, либо
+     * получит уведомление
+     */
+    void NotifyWaiters() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+        }
+        wake_.notify_all();
+    }
+
+  private:
+    // Очередь задач одного потока. Выравниваем по кэш-линии, чтобы мьютексы
+    // соседних очередей не попадали в одну линию
+    struct alignas(kCacheLineSize) WorkQueue {
+        std::mutex mutex_;
+        std::deque<task_type> tasks_;
+    };
+
+    /**
+     * @brief Индекс очереди текущего потока. Для потоков, не принадлежащих
+     * пулу, это общая очередь с индексом 0
+     */
+    size_type CurrentIndex() const noexcept {
+        return current_pool_ == this ? current_index_ : 0;
+    }
+
+    bool TakeTask(size_type index, task_type &task) {
+        {
+            // Своя очередь - с конца
+            WorkQueue &own = queues_[index];
+            std::lock_guard<std::mutex> lock(own.mutex_);
+            if (!own.tasks_.empty()) {
+                task = std::move(own.tasks_.back());
+                own.tasks_.pop_back();
+                --pending_;
+                return true;
+            }
+        }
+
+        // Чужие очереди - с начала
+        for (size_type shift = 1; shift < queues_.size(); ++shift) {
+            WorkQueue &victim = queues_[(index + shift) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex_);
+            if (!victim.tasks_.empty()) {
+                task = std::move(victim.tasks_.front());
+                victim.tasks_.pop_front();
+                --pending_;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void WorkerLoop(size_type index) {
+        current_pool_ = this;
+        current_index_ = index;
+
+        task_type task;
+        while (true) {
+            if (TakeTask(index, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_.wait(lock, [this] { return stop_ || pending_ > 0; });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    // Очереди задач: 0 - общая очередь, 1..n-1 - очереди рабочих потоков
+    std::vector<WorkQueue> queues_;
+    // Рабочие потоки
+    std::vector<std::thread> workers_;
+    // Количество задач во всех очередях. Увеличивается под wake_mutex_, чтобы
+    // не потерять пробуждение. Знаковый, т.к. задачу могут забрать раньше, чем
+    // счетчик будет увеличен
+    std::atomic<std::ptrdiff_t> pending_{0};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+    // Пул и индекс очереди текущего рабочего потока
+    static inline thread_local const ThreadPool *current_pool_ = nullptr;
+    static inline thread_local size_type current_index_ = 0;
+};
+
+/**
+ * @brief Группа задач для fork-join: Run() запускает задачу в пуле, Wait()
+ * дожидается завершения всех запущенных задач группы.
+ *
+ * @details Если какая-то задача выбросила исключение, то первое из них будет
+ * выброшено из Wait() после завершения всех задач группы.
+ */
+class TaskGroup {
+  public:
+    explicit TaskGroup(ThreadPool &pool) : pool_(pool) {
+    }
+
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    /**
+     * @brief Группа не может быть уничтожена, пока её задачи выполняются, т.к.
+     * они ссылаются на группу
+     */
+    ~TaskGroup() {
+        WaitNoThrow();
+    }
+
+    /**
+     * @brief Запускает задачу в пуле (fork)
+     *
+     * @tparam Function Тип вызываемого объекта без аргументов
+     * @param function Задача
+     */
+    template <typename Function>
+    void Run(Function &&function) {
+        running_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            pool_.Submit([this, pool = &pool_,
+                          function = std::forward<Function>(function)] {
+                try {
+                    function();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex_);
+                    if (!error_) {
+                        error_ = std::current_exception();
+                    }
+                }
+                // После обнуления счетчика группа может быть уже уничтожена,
+                // поэтому пул берется из захваченного указателя
+                if (running_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    pool->NotifyWaiters();
+                }
+            });
+        } catch (...) {
+            // Задача не попала в очередь - не ждем её
+            running_.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Дожидается завершения всех задач группы (join). Пока задачи не
+     * завершены, вызывающий поток сам выполняет задачи из пула, а когда задач
+     * в очередях нет - спит до появления новой задачи или завершения группы.
+     */
+    void Wait() {
+        WaitNoThrow();
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+  private:
+    void WaitNoThrow() noexcept {
+        while (running_.load(std::memory_order_acquire) != 0) {
+            if (!pool_.RunPendingTask()) {
+                pool_.WaitForTaskOr([this] {
+                    return running_.load(std::memory_order_acquire) == 0;
+                });
+            }
+        }
+    }
+
+    ThreadPool &pool_;
+    std::atomic<std::size_t> running_{0};
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+};
+
+/**
+ * @brief Параллельно выполняет function(begin, end) для поддиапазонов
+ * [first, last), размер которых не меньше grain (кроме, возможно, одного).
+ * Диапазон делится на количество частей, равное количеству потоков пула.
+ *
+ * @param pool Пул потоков
+ * @param first Начало диапазона индексов
+ * @param last Конец диапазона индексов
+ * @param grain Минимальный размер поддиапазона
+ * @param function Вызываемый объект с сигнатурой void(size_t, size_t)
+ */
+template <typename Function>
+void ParallelFor(ThreadPool &pool, std::size_t first, std::size_t last,
+                 std::size_t grain, const Function &function) {
+    std::size_t count = last - first;
+    std::size_t parts = std::min(pool.Size(), std::max<std::size_t>(
+                                                  count / std::max<std::size_t>(
+                                                              grain, 1),
+                                                  1));
+    if (parts <= 1) {
+        function(first, last);
+        return;
+    }
+
+    TaskGroup group(pool);
+    for (std::size_t part = 1; part < parts; ++part) {
+        std::size_t begin = first + count * part / parts;
+        std::size_t end = first + count * (part + 1) / parts;
+        group.Run([&function, begin, end] { function(begin, end); });
+    }
+    // Первую часть выполняем в текущем потоке
+    function(first, first + count / parts);
+    group.Wait();
+}
+
+/**
+ * @brief Политика параллельного выполнения операций контейнеров. Передается
+ * последним аргументом в методы, у которых есть параллельная версия.
+ */
+struct parallel_policy {
+    explicit parallel_policy(ThreadPool &pool) noexcept : pool_(&pool) {
+    }
+
+    // Пул потоков, на котором выполняется операция
+    ThreadPool *pool_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_THREAD_POOL_H_
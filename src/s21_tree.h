@@ -42,10 +42,16 @@
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_TREE_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_TREE_H_
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <utility>
 #include <vector>
 
+#include "s21_node_handle.h"
+#include "s21_thread_pool.h"
+
 namespace s21 {
 // Цвета для узлов дерева
 enum RedBlackTreeColor {
@@ -53,1466 +59,2288 @@ enum RedBlackTreeColor {
     kRed
 };
 
-template <typename Key, typename Comparator = std::less<Key>>
-class RedBlackTree {
-  private:
-    struct RedBlackTreeNode;
-    struct RedBlackTreeIterator;
-    struct RedBlackTreeIteratorConst;
-#if defined(S21_CONTAINERS_TREE_TEST_HELPER)
-    template <typename U>
-    friend class RedBlackTreeTestHelper;
-#endif
-  public:
-    // Тип элемента (Key — параметр шаблона)
-    using key_type = Key;
-    // Тип указателя на элемент
-    using reference = key_type &;
-    // Тип константной ссылки на элемент
-    using const_reference = const key_type &;
-    // Внутренний класс для итератора
-    using iterator = RedBlackTreeIterator;
-    // Внутренний класс для константного итератора
-    using const_iterator = RedBlackTreeIteratorConst;
-    // Тип для размера контейнера
-    using size_type = std::size_t;
-
-    // Внутренний класс для дерева
-    using tree_type = RedBlackTree;
-    // Внутренний класс узла дерева
-    using tree_node = RedBlackTreeNode;
-    // Внутренний тип для цвета дерева
-    using tree_color = RedBlackTreeColor;
-
+/**
+ * @brief Алгоритмы красно-черного дерева, не зависящие от значений узлов:
+ * встраивание и изъятие узла с балансировкой, повороты и обход.
+ *
+ * @details Используются обычным деревом RedBlackTree (узлы с ключами) и
+ * интрузивным деревом (s21_intrusive_tree.h), где узлом служит хук, встроенный
+ * в объект пользователя. Узел Node должен содержать поля parent_, left_,
+ * right_ (Node *) и color_ (RedBlackTreeColor). Дерево задается служебным
+ * узлом head (см. описание итератора RedBlackTree): head->parent_ - корень,
+ * head->left_ - минимальный узел, head->right_ - максимальный, head всегда
+ * красный.
+ *
+ * @tparam Node Тип узла
+ */
+template <typename Node>
+struct RedBlackTreeAlgorithms {
     /**
-     * @brief Конструктор по умолчанию, создает пустое дерево
+     * @brief Выставляет значения служебного узла head в значения, необходимые
+     * для пустого дерева
      */
-    RedBlackTree() : head_(new tree_node), size_(0U) {
+    static void InitializeHead(Node *head) noexcept {
+        // У пустого дерева корня нет
+        head->parent_ = nullptr;
+        // Т.к. элементов нет, то самый маленький (самый левый) элемент будет
+        // указывать на голову
+        head->left_ = head;
+        // Т.к. элементов нет, то самый большой (самый правый) элемент будет
+        // указывать на голову
+        head->right_ = head;
     }
 
     /**
-     * @brief Конструктор копирования (Copy Constructor). Создает дерево путем
-     * копирования данных из объекта other.
-     *
-     * @param other копируемый объект
+     * @brief Встраивает new_node в дерево потомком parent (слева, если
+     * to_left) и выполняет балансировку. Место вставки parent уже найдено
+     * спуском по дереву (см. Insert() и FindOrEmplace()).
+     *
+     * @param head Служебный узел дерева
+     * @param parent Будущий родитель нового узла или nullptr для пустого
+     * дерева
+     * @param to_left Новый узел становится левым потомком parent
+     * @param new_node Встраиваемый узел
      */
-    RedBlackTree(const tree_type &other) : RedBlackTree() {
-        if (other.Size() > 0) {
-            CopyTreeFromOther(other);
+    static void Link(Node *head, Node *parent, bool to_left,
+                     Node *new_node) noexcept {
+        if (parent != nullptr) {
+            // Если дерево не пустое
+            // То родителем нового узла указываем найденный parent
+            new_node->parent_ = parent;
+            if (to_left) {
+                parent->left_ = new_node;
+            } else {
+                parent->right_ = new_node;
+            }
+        } else {
+            // Если дерево пустое, то new_node становится корнем дерева
+            new_node->color_ = kBlack;
+            new_node->parent_ = head;
+            head->parent_ = new_node;
         }
-    }
 
-    /**
-     * @brief Конструктор переноса (Move Constructor). Создает дерево путем
-     * передачи владения ресурсами от объекта other. Фактически просто
-     * обмениваемся ресурсами с other.
-     *
-     * @param other переносимый объект
-     */
-    RedBlackTree(tree_type &&other) noexcept : RedBlackTree() {
-        Swap(other);
+        // Обновляем указатель на самый маленький элемент дерева, если
+        // необходимо
+        if (head->left_ == head || head->left_->left_ != nullptr) {
+            head->left_ = new_node;
+        }
+
+        // Обновляем указатель на самый большой элемент дерева, если необходимо
+        if (head->right_ == head || head->right_->right_ != nullptr) {
+            head->right_ = new_node;
+        }
+
+        // Вызываем балансировку после вставки нового узла
+        BalancingInsert(head, new_node);
     }
 
     /**
-     * @brief Оператор присваивания копированием.
+     * @brief Балансировка дерева, после вставки нового элемента.
+     * @details Основной алгоритм расписан по ходу функции, используемая
+     * терминология:
+     * node — добавленный элемент (сын), который нарушает 3 пункт правил (Оба
+     * потомка каждого красного узла — чёрные). Хотя на самом деле может и не
+     * нарушает, мы всегда вызываем балансировку. Но если условия не нарушены,
+     * то мы не зайдем в цикл while
      *
-     * @param other Копируемый список
-     * @return list& Созданная копия
+     * parent — папа элемента node
+     *
+     * gparent — дедушка элемента node, папа элемента parent
+     *
+     * uncle — дядя элемента node, брат элемента parent, второй сын элемента
+     * gparent
+     *
+     * При перебалансировке возможны 6 различных случаев:
+     * 1) 3 случая, когда дядя справа у деда
+     * 2) 3 случая, когда дядя слева у деда
+     *
+     * Походу функции подробно описаны первые 3 случая. Вторые 3 случая
+     * зеркально отражают первые 3 случая (это очень наглядно будет видно по
+     * коду).
+     *
+     * P.S. Можно посмотреть картинки, примеры и почитать дополнительные
+     * описания тут: https://habr.com/ru/company/otus/blog/472040/
+     *
+     * @param head Служебный узел дерева
+     * @param node добавленный элемент
      */
-    tree_type &operator=(const tree_type &other) {
-        if (this != &other) {
-            if (other.Size() > 0) {
-                CopyTreeFromOther(other);
+    static void BalancingInsert(Node *head, Node *node) noexcept {
+        // Папа
+        Node *parent = node->parent_;
+
+        while (node != head->parent_ && parent->color_ == kRed) {
+            // Дед
+            Node *gparent = parent->parent_;
+
+            if (gparent->left_ == parent) {
+                // Обрабатываем ситуацию, когда дядя справа у деда
+                Node *uncle = gparent->right_;
+
+                if (uncle != nullptr && uncle->color_ == kRed) {
+                    // Случай первый — красный дядя
+
+                    // Если и отец, и дядя красного цвета, то мы можем
+                    // «спустить» чёрный цвет с уровня деда на уровень отца и
+                    // перекрасить узлы. В этом случае «чёрная высота» останется
+                    // прежней, однако возможно нарушение 3 правила для элемента
+                    // gparent, поэтому необходимо рекурсивно вызвать дальнейшую
+                    // балансировку для этого узла (следующая итерация цикла
+                    // while).
+                    parent->color_ = kBlack;
+                    uncle->color_ = kBlack;
+                    gparent->color_ = kRed;
+                    // Меняем указатели для следующей итерации цикла while
+                    node = gparent;
+                    parent = node->parent_;
+                } else {
+                    // Случай второй — чёрный дядя — папа и дед в разных
+                    // сторонах.
+
+                    // Эту структуру необходимо привести к третьему случаю,
+                    // когда папа и дед идут в одну сторону. Для этого нужно
+                    // выполнить малый поворот от сына node к его отцу и далее
+                    // будет вызван 3 случай для элемента node.
+                    if (parent->right_ == node) {
+                        // Выполняем поворот
+                        RotateLeft(head, parent);
+                        // Меняем местами указатели на отца и сына, т.к. в
+                        // третьем случае сын снизу должен быть, а после
+                        // поворота node встала сверху от parent
+                        std::swap(parent, node);
+                    }
+                    // Случай третий — чёрный дядя — папа и дед в одной стороне
+
+                    // В этом случае мы уже можем совершить большой поворот от
+                    // отца через деда к чёрному дяде и перекрасить parent в
+                    // чёрный, а gparent в красный.
+                    RotateRight(head, gparent);
+                    gparent->color_ = kRed;
+                    parent->color_ = kBlack;
+                    break;
+                }
             } else {
-                Clear();
+                // Обрабатываем ситуацию, когда дядя слева у деда
+                Node *uncle = gparent->left_;
+
+                if (uncle != nullptr && uncle->color_ == kRed) {
+                    // Случай первый — красный дядя
+                    // Аналогично ситуации, когда дядя справа у деда
+                    parent->color_ = kBlack;
+                    uncle->color_ = kBlack;
+                    gparent->color_ = kRed;
+
+                    node = gparent;
+                    parent = node->parent_;
+                } else {
+                    // Случай второй — чёрный дядя — папа и дед в разных
+                    // сторонах. Аналогично ситуации, когда дядя справа у деда
+                    if (parent->left_ == node) {
+                        RotateRight(head, parent);
+                        std::swap(parent, node);
+                    }
+                    // Случай третий — чёрный дядя — папа и дед в одной стороне
+                    // Аналогично ситуации, когда дядя справа у деда
+                    RotateLeft(head, gparent);
+                    gparent->color_ = kRed;
+                    parent->color_ = kBlack;
+                    break;
+                }
             }
         }
 
-        return *this;
+        // Корень всегда должен быть черным после наших поворотов
+        head->parent_->color_ = kBlack;
     }
 
     /**
-     * @brief Оператор присваивания переносом
+     * @brief Вращаем дерево вправо относительно node
      *
-     * @param other Перемещаемый список
-     * @return list& Результат перемещения
+     * @param node
      */
-    tree_type &operator=(tree_type &&other) noexcept {
-        Clear();
-        Swap(other);
-        return *this;
-    }
+    static void RotateRight(Node *head, Node *node) noexcept {
+        // Выбираем левый узел в качестве опорного
+        Node *const pivot = node->left_;
 
-    /**
-     * @brief Деструктор объекта (Destructor)
-     */
-    ~RedBlackTree() {
-        Clear();
-        delete head_;
-        // Для избежания сбоев при повторном освобождении указателей и повторном
-        // использовании указателей
-        head_ = nullptr;
-    }
+        pivot->parent_ = node->parent_;
 
-    /**
-     * @brief Удаляет содержимое контейнера (все элементы). Контейнер при этом
-     * остается консистентным.
-     */
-    void Clear() noexcept {
-        Destroy(Root());
-        InitializeHead();
-        // Размер пустого дерева всегда 0
-        size_ = 0;
-    }
+        if (node == head->parent_) {
+            // Опорный элемент становится корнем дерева, если node было корнем
+            head->parent_ = pivot;
+        } else if (node->parent_->left_ == node) {
+            // Если узел был слева у родителя, то опорный элемент становится
+            // слева
+            node->parent_->left_ = pivot;
+        } else {
+            // Если узел была справа у родителя, то опорный элемент становится
+            // справа
+            node->parent_->right_ = pivot;
+        }
 
-    /**
-     * @brief Возвращает количество элементов в контейнере
-     *
-     * @return size_type
-     */
-    size_type Size() const noexcept {
-        return size_;
+        node->left_ = pivot->right_;
+        if (pivot->right_ != nullptr) {
+            pivot->right_->parent_ = node;
+        }
+
+        node->parent_ = pivot;
+        pivot->right_ = node;
     }
 
     /**
-     * @brief Проверяет, является ли контейнер пустым
+     * @brief Вращаем дерево влево относительно node.
+     * @details В целом аналогично повороту вправо, только в другую сторону
      *
-     * @return true контейнер пустой
-     * @return false контейнер непустой
+     * @param node
      */
-    bool Empty() const noexcept {
-        return size_ == 0;
-    }
+    static void RotateLeft(Node *head, Node *node) noexcept {
+        Node *const pivot = node->right_;
 
-    /**
-     * @brief Возвращает максимальное количество элементов, которое может
-     * содержать дерево из-за ограничений реализации системы или библиотеки.
-     *
-     * @warning В реальности значение max_size() никогда не будет достижимо.
+        pivot->parent_ = node->parent_;
+
+        if (node == head->parent_) {
+            head->parent_ = pivot;
+        } else if (node->parent_->left_ == node) {
+            node->parent_->left_ = pivot;
+        } else {
+            node->parent_->right_ = pivot;
+        }
+
+        node->right_ = pivot->left_;
+        if (pivot->left_ != nullptr) {
+            pivot->left_->parent_ = node;
+        }
+
+        node->parent_ = pivot;
+        pivot->left_ = node;
+    }
+
+    /**
+     * @brief Изымает узел deleted_node из дерева, при необходимости
+     * осуществляется ребалансировка дерева.
      *
-     * @details Это число не зависит от состояния ОС или доступной памяти, а
-     * определяется только реализацией контейнера. Во время выполнения размер
-     * контейнера может быть ограничен значением, меньшим max_size(), чем объем
-     * доступной оперативной памяти.
+     * @details Чтобы удалить узел из красно-черного дерева, мы следуем обычному
+     * процессу удаления BST, который гарантирует, что удаляемый узел является
+     * либо конечным узлом (т.е. не содержит дочерних узлов), либо имеет только
+     * один дочерний узел. Возможные варианты удаляемых узлов:
      *
-     * Для расчета используются следующие вводные:
-     * 1) Размер size_t должен совпадать с размером указателя для любой
-     * платформы. Указатель должен быть в состоянии адресовать любой байт в
-     * памяти, а size_t хранить размер любого (в т.ч. занимающего всю память)
-     * объекта. Таким образом максимальное значение size_t - это максимальное
-     * количество байт памяти. Это значение мы получаем при помощи
-     * std::numeric_limits<size_t>::max();
+     * 1) К2 — красный узел с двумя детьми.
+     * Задача удаления узла с двумя дочерними элементами сводится к задаче
+     * удаления узла с одним или нулём дочерних элементов. Для этого необходимо
+     * найти ближайший элемент, который меньше или больше удаляемого и поменять
+     * их местами.
      *
-     * 2) GCC ограничивает объекты размером в половину адресного пространства.
-     * Поэтому полученное в п.1 число делим на 2.
+     * ВАЖНО: Наиболее удобно при обмене элементов местами изменять только
+     * значения в узлах, а цвет оставлять прежним, чтобы не нарушать структуру
+     * дерева и не изменять чёрную высоту. Обычно это быстро, т.к. происходит
+     * обмен только одного поля (значения), даже для сложных классов (если класс
+     * поддерживает move). И это проще реализовать, т.к. не надо делать
+     * фактический обмен узлов с перепривязкой всех указателей на узлы. Однако в
+     * этом случае мы фактический удаляем другой узел, хоть и содержащую нужное
+     * значение. Соответственно в этом случае мы не можем гарантировать, что
+     * указатели/итераторы на другие узлы дерева останутся валидными. Т.к.
+     * оригинальная реализация дерева в STL требует от нас сохранять указатели и
+     * итераторы валидными (References and iterators to the erased elements are
+     * invalidated. Other references and iterators are not affected.), то мы
+     * будем наоборот обменивать узлы целиком, оставляя значение на старом
+     * месте.
      *
-     * Почему так происходит - см. описание s21::list::max_size()
+     * После обмена нужно удалить узел из его нового места. Это будет либо
+     * самый правый элемент в левой ветке (максимальный слева), либо самый левый
+     * в правой (минимальный справа) (см ниже пояснение с *), в любом случае у
+     * него не будет одного дочернего узла слева или справа.
      *
-     * 3) В дереве хранится указатель на голову (служебный узел) -
-     * sizeof(head_), компаратор - sizeof(cmp_), количество созданных элементов
-     * - sizeof(size_), всё вместе - sizeof(tree_type). Кроме этого выделяется
-     * память на один служебный узел, который есть даже у пустого дерева -
-     * sizeof(tree_node). Всё это вычитаем из памяти, полученной в п.2. Таким
-     * образом получаем максимальное количество памяти, доступной для создания
-     * узлов дерева.
+     * Таким образом, задача удаления узла с 2 детьми сводится к задаче удаления
+     * элемента с 1 или 0 детьми.
      *
-     * 4) Чтобы определить максимальное количество элементов в контейнере, делим
-     * число, полученное в п.3, на размер одного узла, т.е. sizeof(tree_node)
+     * *) При поиске ближайшего элемента в идеале необходимо просматривать и
+     * левое и правое поддеревья, чтобы выбрать ближайшее значение к удаляемому.
+     * Но мы будем всегда искать справа (если правое поддерево есть, конечно),
+     * т.к. это проще и не оказывает существенного влияния на работу дерева.
+     *
+     * 2) Ч2 — чёрный узел с двумя детьми.
+     * Аналогично предыдущему случаю К2, задача удаления узла с 2 детьми
+     * сводится к задаче удаления элемента с 1 или 0 детьми.
+     *
+     * 3) К1 — красный узел с одним ребёнком.
+     * Если у красного узла одного ребёнка нет, значит, вместо него находится
+     * чёрный NIL-элемент и чёрная высота красного узла равна 1. Следовательно,
+     * с другой стороны чёрная высота также должны быть равна 1. Но так как у
+     * красного узла дочерний элемент не может быть красного цвета, то другой
+     * его ребёнок должен быть чёрного цвета. Так как чёрная высота должна быть
+     * равна 1, то это может быть только чёрный NIL-элемент, так как в случае
+     * обычного чёрного элемента высота будет выше.
+     *
+     * Таким образом, К1 случай не имеет места быть.
+     *
+     * 4) Ч1 — чёрный узел с одним ребёнком.
+     * Если у чёрного элемента нет одного ребёнка, значит, вместо него находится
+     * чёрный NIL-элемент с чёрной высотой 1. Следовательно, с другой стороны
+     * должен быть красный узел без детей. Для удаления такого элемента обменять
+     * значения красного и чёрного узлов и удалить красный узел (аналогично
+     * случаю К2 вместо обмена значений мы будем делать обмен узлов), чёрная
+     * высота при этом сохранится.
+     *
+     * Таким образом, К1 сводится к задаче удаления красного узла без детей (К0)
+     *
+     * 5) К0 — красный узел без детей.
+     * Просто удаляем элемент, чёрная высота при этом сохранится.
+     *
+     * 6) Ч0 — чёрный узел без детей. Просто удаляем узел, но при этом чёрная
+     * высота изменится. Соответственно необходимо запустить перебалансировку.
+     *
+     *
+     * P.S. Можно посмотреть картинки, примеры и почитать дополнительные
+     * описания тут: https://habr.com/ru/company/otus/blog/521034/
      *
+     * Указатели извлеченного узла остаются в промежуточном состоянии, их
+     * сбрасывает вызывающая сторона.
+     *
+     * @param head Служебный узел дерева
+     * @param deleted_node Извлекаемый узел (не head)
      */
-    size_type MaxSize() const noexcept {
-        return ((std::numeric_limits<size_type>::max() / 2) -
-                sizeof(tree_type) - sizeof(tree_node)) /
-               sizeof(tree_node);
+    static void Extract(Node *head, Node *deleted_node) noexcept {
+        // Обработка К2 и Ч2
+        if (deleted_node->left_ != nullptr && deleted_node->right_ != nullptr) {
+            // Находим самый левый узел в правой ветке (минимальный справа)
+            Node *replace = SearchMinimum(deleted_node->right_);
+            // Обмениваем местами удаляемый узел и найденный узел
+            SwapNodesForErase(head, deleted_node, replace);
+        }
+
+        // Обработка К1 — не требуется, т.к. такой случай невозможен
+
+        // Обработка Ч1
+        if (deleted_node->color_ == kBlack &&
+            ((deleted_node->left_ == nullptr &&
+              deleted_node->right_ != nullptr) ||
+             (deleted_node->left_ != nullptr &&
+              deleted_node->right_ == nullptr))) {
+            // Находим красный узел без детей (К0) для обмена значений с ним
+            Node *replace;
+            if (deleted_node->left_ != nullptr) {
+                replace = deleted_node->left_;
+            } else {
+                replace = deleted_node->right_;
+            }
+            // Обмениваем местами удаляемый узел и найденный узел
+            SwapNodesForErase(head, deleted_node, replace);
+        }
+
+        // Обработка К0
+        // Дополнительных действий не требуется узел будет просто удален в конце
+        // функции. При таком случае все необходимые переменные для удаления уже
+        // заполнены корректно
+
+        // Обработка Ч0
+        // Самый сложный и интересный случай, нам необходимо перед удалением
+        // перебаласировать дерево таким образом, чтобы черная высота не
+        // нарушилась после удаления узла
+        if (deleted_node->color_ == kBlack && deleted_node->left_ == nullptr &&
+            deleted_node->right_ == nullptr) {
+            EraseBalancing(head, deleted_node);
+        }
+
+        // Теперь собственно изымаем из дерева узел, который мы удаляем.
+        if (deleted_node == head->parent_) {
+            // Отдельно обрабатываем случай, когда удаляем корень дерева
+            // Удаление именно корня возможно только в том случае, если он
+            // единственный элемент дерева (в остальных случаях мы сведем задачу
+            // к удалению другого узла). Поэтому в даном случае приводим
+            // состояние служебного узла head в соответствие с изначальными
+            // данными для пустого дерева.
+            InitializeHead(head);
+        } else {
+            // В остальных случаях отцепляем ссылки родителя на нашу удаляемый
+            // узел
+            if (deleted_node == deleted_node->parent_->left_) {
+                deleted_node->parent_->left_ = nullptr;
+            } else {
+                deleted_node->parent_->right_ = nullptr;
+            }
+
+            // Ищем новый минимум для служебного узла, если мы удаляем старый
+            // минимум
+            if (head->left_ == deleted_node) {
+                head->left_ = SearchMinimum(head->parent_);
+            }
+
+            // Ищем новый максимум для служебного узла, если мы удаляем старый
+            // максимум
+            if (head->right_ == deleted_node) {
+                head->right_ = SearchMaximum(head->parent_);
+            }
+        }
+    }
+
+    /**
+     * @brief Меняет местами узлы node и other с целью последующего удаления
+     * узла node - это важный момент, т.е. это не универсальный свап узлов, а
+     * только частный случай (универсальный более сложен, но нам не нужны эти
+     * лишние действия)
+     *
+     * Необходимость обмена именно узлов, а не их значений описана в функции
+     * ExtractNode()
+     *
+     * @param node
+     * @param other
+     */
+    static void SwapNodesForErase(Node *head, Node *node,
+                                  Node *other) noexcept {
+        // Меняем ссылку на узел other у родителя other
+        if (other->parent_->left_ == other) {
+            other->parent_->left_ = node;
+        } else {
+            other->parent_->right_ = node;
+        }
+
+        if (node == head->parent_) {
+            // Если node является корнем дерева, то меняем ссылку на новый
+            // корень
+            head->parent_ = other;
+        } else {
+            // Если node не является корнем, то меняем ссылку на узел node у
+            // родителя node
+            if (node->parent_->left_ == node) {
+                node->parent_->left_ = other;
+            } else {
+                node->parent_->right_ = other;
+            }
+        }
+
+        // Свапаем всё, кроме key_, т.к. ключи должны остаться на своем месте в
+        // дереве, а все остальное должно обменяться (см. описание алгоритма
+        // удаления)
+        std::swap(node->parent_, other->parent_);
+        std::swap(node->left_, other->left_);
+        std::swap(node->right_, other->right_);
+        std::swap(node->color_, other->color_);
+
+        // Меняем родителей у потомков свапаемых узлов
+
+        if (node->left_) {
+            // При текущем алгоритме удаления у нас не может быть left_
+            // заполнен, но в универсальном варианте надо проверять
+            node->left_->parent_ = node;
+        }
+
+        if (node->right_) {
+            node->right_->parent_ = node;
+        }
+
+        if (other->left_) {
+            other->left_->parent_ = other;
+        }
+
+        if (other->right_) {
+            other->right_->parent_ = other;
+        }
+    }
+
+    /**
+     * @brief Функция для перебалансировки дерева перед удалением узла
+     * deleted_node, чтобы черная высота не нарушилась после удаления узла.
+     *
+     * @details Перебалансировка выполняется в том случае, если удаляется черный
+     * узел без детей, т.к. в этом случае гарантированно нарушается свойство 5
+     * красно-чёрного дерева (свойства описаны в начале файла).
+     *
+     * При перебалансировке возможны 8 различных случаев:
+     * 1) 4 случая, если удаляемый элемент находится слева от родителя (левый
+     * сын).
+     * 2) 4 случая, если удаляемый элемент находится справа от родителя
+     * (правый сын).
+     *
+     * Мы рассмотрим только 4 случая для левого сына. Вторые 4 случая (для
+     * правого сына) зеркально отражают первые четыре случая (это очень наглядно
+     * будет видно по коду).
+     *
+     * Терминология далее:
+     * check_node - элемент, для которого мы хотим восстановить высоту (на
+     * первой итерации является удаляемым элементом) parent - Родитель
+     * check_node sibling - Брат или сестра check_node (второй ребенок parent)
+     *
+     * Возможные случаи для для левого сына:
+     * 6.1) sibling красного цвета.
+     *
+     * В этом случае мы меняем местами цвета sibling и parent, а затем выполняем
+     * поворот налево через parent (при этом изменятся parent и sibling в
+     * текущей итерации алгоритма). Это сводит случай 6.1 к случаям 6.2, 6.3
+     * или 6.4.
+     *
+     * 6.2) sibling черного цвета и оба ребенка sibling черного цвета.
+     *
+     * В этом случае мы меняем цвет sibling на красный.
+     * Если цвет parent красный, то мы меняем его цвет на черный и останавливаем
+     * балансировку (дерево будет сбалансировано).
+     * Если цвет parent черный, мы устанавливаем check_node равной parent и
+     * переходим к следующей итерации балансировки (т.е. начинаем проверять
+     * случаи для нового check_node, начиная с 6.1). Это обусловлено тем, что в
+     * данном случае мы изменили цвет sibling на красный - в результате чёрная
+     * высота всей нашей структуры уменьшилась на 1 и мы должны рекурсивно
+     * вызывать балансировку для parent.
+     *
+     * 6.3) sibling черного цвета, левый ребенок sibling красный, правый ребенок
+     * sibling черный.
+     *
+     * В этом случае мы меняем местами цвета sibling и левого ребенка sibling, а
+     * затем выполняем поворот направо через sibling (при этом изменится sibling
+     * в текущей итерации алгоритма). Это сводит случай 6.3 к случаю 6.4.
+     *
+     * 6.4) sibling черного цвета, правый ребенок sibling красный.
+     *
+     * В этом случае мы меняем цвет правого ребенка sibling на черный, меняем
+     * цвет sibling на цвет parent, меняем цвет parent на черный, а затем
+     * выполняем поворот налево через sibling. После этого дерево будет
+     * сбалансировано, останавливаем балансировку
+     *
+     * P.S. Можно посмотреть картинки, примеры и почитать дополнительные
+     * описания тут:
+     * https://algorithmtutor.com/Data-Structures/Tree/Red-Black-Trees/
+     *
+     * @param deleted_node Удаляемый узел
+     */
+    static void EraseBalancing(Node *head, Node *deleted_node) noexcept {
+        Node *check_node = deleted_node;
+        Node *parent = deleted_node->parent_;
+
+        // Проверку осуществляем в цикле, пока проверяемый узел черный
+        // (необходимость зацикливания указана в описании случая 6.2)). Ну или
+        // пока дерево не кончится
+        while (check_node != head->parent_ && check_node->color_ == kBlack) {
+            if (check_node == parent->left_) {
+                // Удаляемый элемент находится слева от родителя
+                Node *sibling = parent->right_;
+
+                // Случай 6.1
+                if (sibling->color_ == kRed) {
+                    std::swap(sibling->color_, parent->color_);
+                    RotateLeft(head, parent);
+                    parent = check_node->parent_;
+                    sibling = parent->right_;
+                }
+
+                // Случай 6.2
+                if (sibling->color_ == kBlack &&
+                    (sibling->left_ == nullptr ||
+                     sibling->left_->color_ == kBlack) &&
+                    (sibling->right_ == nullptr ||
+                     sibling->right_->color_ == kBlack)) {
+                    sibling->color_ = kRed;
+                    if (parent->color_ == kRed) {
+                        parent->color_ = kBlack;
+                        // Балансировка завершена
+                        break;
+                    }
+                    // Идем балансировать parent
+                    check_node = parent;
+                    parent = check_node->parent_;
+                } else {
+                    if (sibling->left_ != nullptr &&
+                        sibling->left_->color_ == kRed &&
+                        (sibling->right_ == nullptr ||
+                         sibling->right_->color_ == kBlack)) {
+                        // Случай 6.3
+                        std::swap(sibling->color_, sibling->left_->color_);
+                        RotateRight(head, sibling);
+                        sibling = parent->right_;
+                    }
+
+                    // Случай 6.4
+                    sibling->right_->color_ = kBlack;
+                    sibling->color_ = parent->color_;
+                    parent->color_ = kBlack;
+                    RotateLeft(head, parent);
+                    // Балансировка завершена
+                    break;
+                }
+            } else {
+                // Удаляемый элемент находится справа от родителя
+                Node *sibling = parent->left_;
+
+                // Случай 6.1
+                if (sibling->color_ == kRed) {
+                    std::swap(sibling->color_, parent->color_);
+                    RotateRight(head, parent);
+                    parent = check_node->parent_;
+                    sibling = parent->left_;
+                }
+
+                // Случай 6.2
+                if (sibling->color_ == kBlack &&
+                    (sibling->left_ == nullptr ||
+                     sibling->left_->color_ == kBlack) &&
+                    (sibling->right_ == nullptr ||
+                     sibling->right_->color_ == kBlack)) {
+                    sibling->color_ = kRed;
+                    if (parent->color_ == kRed) {
+                        parent->color_ = kBlack;
+                        // Балансировка завершена
+                        break;
+                    }
+                    // Идем балансировать parent
+                    check_node = parent;
+                    parent = check_node->parent_;
+                } else {
+                    if (sibling->right_ != nullptr &&
+                        sibling->right_->color_ == kRed &&
+                        (sibling->left_ == nullptr ||
+                         sibling->left_->color_ == kBlack)) {
+                        // Случай 6.3
+                        std::swap(sibling->color_, sibling->right_->color_);
+                        RotateLeft(head, sibling);
+                        sibling = parent->left_;
+                    }
+                    // Случай 6.4
+                    sibling->left_->color_ = kBlack;
+                    sibling->color_ = parent->color_;
+                    parent->color_ = kBlack;
+                    RotateRight(head, parent);
+                    // Балансировка завершена
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Находит среди потомков node самый маленький (самый левый) элемент
+     * дерева и возвращает указатель на него.
+     *
+     * @param node
+     * @return Node*
+     */
+    static Node *SearchMinimum(Node *node) noexcept {
+        while (node->left_ != nullptr) {
+            node = node->left_;
+        };
+        return node;
+    }
+
+    /**
+     * @brief Находит среди потомков node самый большой (самый правый) элемент
+     * дерева и возвращает указатель на него.
+     *
+     * @param node
+     * @return Node*
+     */
+    static Node *SearchMaximum(Node *node) noexcept {
+        while (node->right_ != nullptr) {
+            node = node->right_;
+        };
+        return node;
+    }
+
+    /**
+     * @brief Возвращает следующий относительно current узел дерева.
+     * @details Реализация описана по ходу функции. В реализации учитывается
+     * наличие служебного узла (головы), через которую реализуется
+     * зацикливание при обходе элементов.
+     *
+     * @return Node*
+     */
+    static Node *NextNode(const Node *current) noexcept {
+        // Мы не меняем текущий узел в этой функции, поэтому со спокойной
+        // совестью делаем const_cast
+        Node *node = const_cast<Node *>(current);
+        if (node->color_ == kRed &&
+            (node->parent_ == nullptr || node->parent_->parent_ == node)) {
+            // Если мы находимся в End(), то сдвигаем итератор в left, чтобы
+            // оказаться на самом маленьком элементе дерева (указатель на
+            // который и хранится в left в End()) Критерии, что текущий узел
+            // является End(): 1) Цвет текущего узла красный (Т.к. корень
+            // всегда черный, а End() всегда красный). AND 2) Родитель
+            // текущего узла равен nullptr - только у End() parent может
+            // быть nullptr для пустого дерева (и это надо проверять, чтобы
+            // не словить segmentation fault для пустого дерева). OR 3)
+            // Родитель родителя текущего узла равен текущему узлу. Это
+            // выполняется и для корня дерева и для End(), поэтому нужно еще
+            // первое условие с проверкой цвета.
+            node = node->left_;
+        } else if (node->right_ != nullptr) {
+            // Если мы находимся не в End() и правая ветвь непустая, то в
+            // первую очередь идем в неё, т.к. ближайший больший элемента
+            // будет именно в правой ветви
+            node = node->right_;
+
+            // Далее сдвигаемся полностью влево (while left_ != nullptr), до
+            // самого маленького элемента в левых ветвях, он и будет самым
+            // маленьким следующим элементом. Если левых ветвей вообще не
+            // будет, то самым маленьким останется правая ветвь, в которую
+            // мы зашли в начале блока
+            while (node->left_ != nullptr) {
+                node = node->left_;
+            }
+        } else {
+            // В остальных случаях сдвигаемся к родительскому элементу до
+            // тех пор, пока правая ветвь родителя будет содержать узел,
+            // отличный от текущего
+            Node *parent = node->parent_;
+
+            while (node == parent->right_) {
+                node = parent;
+                parent = parent->parent_;
+            }
+            // Если в дереве у корня нет правого элемента, то при инкременте
+            // мы будем каждый раз попадать на него: Указатель находится  на
+            // корне. Т.к. right пустой, то идем в parent (который является
+            // служебным узлом End(). У parent-right указывает на самый
+            // большой элемент дерева, т.е. на нашу единственный узел,
+            // поэтому мы опять поднимаемся в parent, который указывает на
+            // нашу единственный узел (parent у End() указывает на корень
+            // дерева). Чтобы этого не происходило, добавляем проверку
+            // node->right_ != parent, т.е. находясь в End(), мы не будем
+            // уходить в parent
+            if (node->right_ != parent) {
+                node = parent;
+            }
+        }
+
+        return node;
+    }
+
+    /**
+     * @brief Возвращает предыдущий относительно current узел дерева.
+     * @details Работает идентично NextNode, только двигаемся в обратную
+     * сторону, поэтому всё наоборот.
+     *
+     * @return Node*
+     */
+    static Node *PrevNode(const Node *current) noexcept {
+        Node *node = const_cast<Node *>(current);
+
+        if (node->color_ == kRed &&
+            (node->parent_ == nullptr || node->parent_->parent_ == node)) {
+            node = node->right_;
+        } else if (node->left_ != nullptr) {
+            node = node->left_;
+            while (node->right_ != nullptr) {
+                node = node->right_;
+            }
+        } else {
+            Node *parent = node->parent_;
+            while (node == parent->left_) {
+                node = parent;
+                parent = parent->parent_;
+            }
+            if (node->left_ != parent) {
+                node = parent;
+            }
+        }
+
+        return node;
     }
+};
+
+template <typename Key, typename Comparator = std::less<Key>>
+class RedBlackTree {
+  private:
+    struct RedBlackTreeNode;
+    struct RedBlackTreeIterator;
+    struct RedBlackTreeIteratorConst;
+#if defined(S21_CONTAINERS_TREE_TEST_HELPER)
+    template <typename U>
+    friend class RedBlackTreeTestHelper;
+#endif
+  public:
+    // Тип элемента (Key — параметр шаблона)
+    using key_type = Key;
+    // Тип указателя на элемент
+    using reference = key_type &;
+    // Тип константной ссылки на элемент
+    using const_reference = const key_type &;
+    // Внутренний класс для итератора
+    using iterator = RedBlackTreeIterator;
+    // Внутренний класс для константного итератора
+    using const_iterator = RedBlackTreeIteratorConst;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+    // Внутренний класс для дерева
+    using tree_type = RedBlackTree;
+    // Внутренний класс узла дерева
+    using tree_node = RedBlackTreeNode;
+    // Внутренний тип для цвета дерева
+    using tree_color = RedBlackTreeColor;
+    // Алгоритмы балансировки и обхода, общие с интрузивным деревом
+    using tree_algorithms = RedBlackTreeAlgorithms<tree_node>;
+    // Дескриптор извлеченного узла (см. s21_node_handle.h)
+    using node_handle = NodeHandle<tree_node, key_type>;
+    // Результат вставки дескриптора в дерево с уникальными элементами
+    using insert_return_type = InsertReturnType<iterator, node_handle>;
 
     /**
-     * @brief Возвращает итератор на начало контейнера.
-     * @details Для пустого контейнера возвращаемый итератор будет равен end().
-     * Все нюансы реализации итераторов описаны в классе итератора.
-     *
-     * @return iterator
+     * @brief Конструктор по умолчанию, создает пустое дерево
      */
-    iterator Begin() noexcept {
-        return iterator(MostLeft());
+    RedBlackTree() : head_(new tree_node), size_(0U) {
     }
 
     /**
-     * @brief Версия begin() для const
+     * @brief Конструктор копирования (Copy Constructor). Создает дерево путем
+     * копирования данных из объекта other.
      *
-     * @return const_iterator
+     * @param other копируемый объект
      */
-    const_iterator Begin() const noexcept {
-        return const_iterator(MostLeft());
+    RedBlackTree(const tree_type &other) : RedBlackTree() {
+        if (other.Size() > 0) {
+            CopyTreeFromOther(other);
+        }
     }
 
     /**
-     * @brief Возвращает итератор на конец контейнера (элемент после последнего
-     * элемента контейнера).
-     * @details Элемент является служебной "заглушкой" и его разыменование - UB
+     * @brief Конструктор переноса (Move Constructor). Создает дерево путем
+     * передачи владения ресурсами от объекта other. Фактически просто
+     * обмениваемся ресурсами с other.
      *
-     * @return iterator
+     * @param other переносимый объект
      */
-    iterator End() noexcept {
-        return iterator(head_);
+    RedBlackTree(tree_type &&other) noexcept : RedBlackTree() {
+        Swap(other);
     }
 
     /**
-     * @brief Версия end() для const
+     * @brief Оператор присваивания копированием.
      *
-     * @return const_iterator
+     * @param other Копируемый список
+     * @return list& Созданная копия
      */
-    const_iterator End() const noexcept {
-        return const_iterator(head_);
+    tree_type &operator=(const tree_type &other) {
+        if (this != &other) {
+            if (other.Size() > 0) {
+                CopyTreeFromOther(other);
+            } else {
+                Clear();
+            }
+        }
+
+        return *this;
     }
 
     /**
-     * @brief Извлекает все элементы из other и вставляет их в this.
-     * @details Никакие элементы не копируются и не перемещаются,
-     * переназначаются только внутренние указатели узлов контейнера. Все
-     * указатели и ссылки на переданные элементы остаются действительными, но
-     * теперь ссылаются на *this, а не на other.
-     *
-     * В данной функции мы переносим все элементы, даже если такие уже есть в
-     * текущем дереве. Поэтому мы не используем функцию ExtractNode(), т.к. она
-     * вызывает перебалансировку дерева other после изъятия узла, что лишняя
-     * ненужная операция, т.к. все равно будут перенесены все без исключения
-     * элементы other. Поэтому мы проходимся по порядку по всем элементам other,
-     * изымаем их и вставляем в текущее дерево.
-     *
-     * Т.к. мы не создаем копии узлов, то это экономит много времени.
+     * @brief Оператор присваивания переносом
      *
-     * @param other
+     * @param other Перемещаемый список
+     * @return list& Результат перемещения
      */
-    void Merge(tree_type &other) {
-        if (this != &other) {
-            iterator other_begin = other.Begin();
-
-            // Пока элементы есть в other, извлекаем их
-            while (other.size_ > 0) {
-                tree_node *moving_node = other_begin.node_;
-                ++other_begin;
-
-                // Отцепляем узел от других узлов в other
-
-                if (moving_node->left_ != nullptr) {
-                    // Т.к. у нас обход слева направо, то left_ всегда будет
-                    // nullptr Однако оставим эту проверку на случай
-                    // изменения/доработки алгоритма
-                    moving_node->left_->parent_ = moving_node->parent_;
-                }
-
-                if (moving_node->right_ != nullptr) {
-                    moving_node->right_->parent_ = moving_node->parent_;
-                }
-
-                if (moving_node->parent_->left_ == moving_node) {
-                    moving_node->parent_->left_ = nullptr;
-                }
-
-                if (moving_node->parent_->right_ == moving_node) {
-                    moving_node->parent_->right_ = nullptr;
-                }
-
-                // Приводим узел к виду по умолчанию
-                moving_node->ToDefault();
-
-                --other.size_;
+    tree_type &operator=(tree_type &&other) noexcept {
+        Clear();
+        Swap(other);
+        return *this;
+    }
 
-                Insert(Root(), moving_node, false);
-            }
+    /**
+     * @brief Деструктор объекта (Destructor)
+     */
+    ~RedBlackTree() {
+        Clear();
+        delete head_;
+        // Для избежания сбоев при повторном освобождении указателей и повторном
+        // использовании указателей
+        head_ = nullptr;
+    }
 
-            // Приводим head дерева other в корректное состояние для пустого
-            // контейнера, чтобы other остался консистентным.
-            other.InitializeHead();
-        }
+    /**
+     * @brief Удаляет содержимое контейнера (все элементы). Контейнер при этом
+     * остается консистентным.
+     */
+    void Clear() noexcept {
+        Destroy(Root());
+        InitializeHead();
+        // Размер пустого дерева всегда 0
+        size_ = 0;
     }
 
     /**
-     * @brief Пытается извлечь элементы из other и вставить их в this. Если в
-     * *this есть элемент с ключом, эквивалентным ключу элемента из other,
-     * то этот элемент не извлекается из other.
-     *
-     * @details Никакие элементы не копируются и не перемещаются,
-     * переназначаются только внутренние указатели узлов контейнера. Все
-     * указатели и ссылки на переданные элементы остаются действительными, но
-     * теперь ссылаются на *this, а не на other.
-     *
-     * Т.к. other может остаться непустым после операции, то для извлечения
-     * узлов из other мы используем ExtractNode(), т.к. она вызывает
-     * перебалансировку, а мы должны сохранить other корректным красно-чёрным
-     * деревом.
+     * @brief Возвращает количество элементов в контейнере
      *
-     * @param other
+     * @return size_type
      */
-    void MergeUnique(tree_type &other) {
-        if (this != &other) {
-            iterator other_begin = other.Begin();
-            iterator other_end = other.End();
+    size_type Size() const noexcept {
+        return size_;
+    }
 
-            while (other_begin != other_end) {
-                iterator result_it = Find(other_begin.node_->key_);
-                if (result_it == End()) {
-                    iterator tmp = other_begin;
-                    ++other_begin;
-                    tree_node *moving_node = other.ExtractNode(tmp);
-                    Insert(Root(), moving_node, false);
-                } else {
-                    ++other_begin;
-                }
-            }
-        }
+    /**
+     * @brief Проверяет, является ли контейнер пустым
+     *
+     * @return true контейнер пустой
+     * @return false контейнер непустой
+     */
+    bool Empty() const noexcept {
+        return size_ == 0;
     }
 
     /**
-     * @brief Вставляет элемент со значением key в контейнер. Если в контейнере
-     * есть элементы с эквивалентным ключом, вставка выполняется по верхней
-     * границе этого диапазона.
+     * @brief Возвращает максимальное количество элементов, которое может
+     * содержать дерево из-за ограничений реализации системы или библиотеки.
+     *
+     * @warning В реальности значение max_size() никогда не будет достижимо.
+     *
+     * @details Это число не зависит от состояния ОС или доступной памяти, а
+     * определяется только реализацией контейнера. Во время выполнения размер
+     * контейнера может быть ограничен значением, меньшим max_size(), чем объем
+     * доступной оперативной памяти.
+     *
+     * Для расчета используются следующие вводные:
+     * 1) Размер size_t должен совпадать с размером указателя для любой
+     * платформы. Указатель должен быть в состоянии адресовать любой байт в
+     * памяти, а size_t хранить размер любого (в т.ч. занимающего всю память)
+     * объекта. Таким образом максимальное значение size_t - это максимальное
+     * количество байт памяти. Это значение мы получаем при помощи
+     * std::numeric_limits<size_t>::max();
+     *
+     * 2) GCC ограничивает объекты размером в половину адресного пространства.
+     * Поэтому полученное в п.1 число делим на 2.
+     *
+     * Почему так происходит - см. описание s21::list::max_size()
+     *
+     * 3) В дереве хранится указатель на голову (служебный узел) -
+     * sizeof(head_), компаратор - sizeof(cmp_), количество созданных элементов
+     * - sizeof(size_), всё вместе - sizeof(tree_type). Кроме этого выделяется
+     * память на один служебный узел, который есть даже у пустого дерева -
+     * sizeof(tree_node). Всё это вычитаем из памяти, полученной в п.2. Таким
+     * образом получаем максимальное количество памяти, доступной для создания
+     * узлов дерева.
+     *
+     * 4) Чтобы определить максимальное количество элементов в контейнере, делим
+     * число, полученное в п.3, на размер одного узла, т.е. sizeof(tree_node)
      *
-     * @param key Значение элемента для вставки
-     * @return iterator Итератор, указывающий на вставленный элемент
      */
-    iterator Insert(const key_type &key) {
-        tree_node *new_node = new tree_node{key};
-        return Insert(Root(), new_node, false).first;
+    size_type MaxSize() const noexcept {
+        return ((std::numeric_limits<size_type>::max() / 2) -
+                sizeof(tree_type) - sizeof(tree_node)) /
+               sizeof(tree_node);
     }
 
     /**
-     * @brief Вставляет элемент со значением key в контейнер, если контейнер еще
-     * не содержит элемент с эквивалентным ключом.
+     * @brief Возвращает итератор на начало контейнера.
+     * @details Для пустого контейнера возвращаемый итератор будет равен end().
+     * Все нюансы реализации итераторов описаны в классе итератора.
      *
-     * @param key Значение элемента для вставки
-     * @return std::pair<iterator, bool> - Пара, состоящая из итератора для
-     * вставленного элемента (или для элемента, который предотвратил вставку) и
-     * логического значения, установленного в true, если вставка произошла
-     * (false, если вставка не произошла
+     * @return iterator
      */
-    std::pair<iterator, bool> InsertUnique(const key_type &key) {
-        tree_node *new_node = new tree_node{key};
-        std::pair<iterator, bool> result = Insert(Root(), new_node, true);
-        if (result.second == false) {
-            // Если вставка не произошла, то удаляем созданный узел
-            delete new_node;
-        }
-
-        return result;
+    iterator Begin() noexcept {
+        return iterator(MostLeft());
     }
 
     /**
-     * @brief Размещает новые элементы args в контейнер. Если в контейнере
-     * есть элементы с эквивалентным ключом, вставка выполняется по верхней
-     * границе этого диапазона.
-     *
-     * @tparam Args Пакет параметров шаблона (Parameter pack)
-     * @param args Уже созданные элементы, которые необходимо вставить в
-     * соответствующий контейнер.
-     * @details Модифицированная версия метода emplace, которая отличается от
-     * реализации в std, т.к. получает в качестве аргументов args уже созданные
-     * объекты для размещения в контейнере (а не параметры для конструирования
-     * объектов)
-     *
-     * Однако при реализации мы должны сохранить основную идею Emplace:
-     * Основное отличие от insert - избежать ненужных копирований объекта,
-     * единожды созданный временный объект будет передаваться по функциям без
-     * копирования и встроится в дерево.
+     * @brief Версия begin() для const
      *
-     * @return std::vector<std::pair<iterator, bool>> Т.к. функция может
-     * вставить несколько элементов, то возвращается вектор, содержащий пары
-     * результата вставки для каждого вставляемого элемента. Формат пары
-     * идентичен методу InsertUnique()
+     * @return const_iterator
      */
-    template <typename... Args>
-    std::vector<std::pair<iterator, bool>> Emplace(Args &&...args) {
-        std::vector<std::pair<iterator, bool>> result;
-        // Т.к. args может быть большим, но это число нам сразу известно, то
-        // выделяем нужное количество памяти на вектор, чтобы избежать ненужных
-        // повторных выделений памяти в процессе
-        result.reserve(sizeof...(args));
-
-        // Обязательно используем std::forward, чтобы избежать лишних
-        // копирований в item
-        for (auto item : {std::forward<Args>(args)...}) {
-            // И используем std::move, чтобы опять избежать лишних копирований
-            tree_node *new_node = new tree_node(std::move(item));
-            std::pair<iterator, bool> result_insert =
-                Insert(Root(), new_node, false);
-            result.push_back(result_insert);
-        }
-        return result;
+    const_iterator Begin() const noexcept {
+        return const_iterator(MostLeft());
     }
 
     /**
-     * @brief Размещает новые элементы args в контейнер, если контейнер ещё не
-     * содержит элемент с эквивалентным ключом.
-     *
-     * @details В остальном работает идентично Emplace().
+     * @brief Возвращает итератор на конец контейнера (элемент после последнего
+     * элемента контейнера).
+     * @details Элемент является служебной "заглушкой" и его разыменование - UB
      *
-     * @tparam Args Пакет параметров шаблона (Parameter pack)
-     * @param args Уже созданные элементы, которые необходимо вставить в
-     * соответствующий контейнер.
-     * @return std::vector<std::pair<iterator, bool>> Т.к. функция может
-     * вставить несколько элементов, то возвращается вектор, содержащий пары
-     * результата вставки для каждого вставляемого элемента. Формат пары
-     * идентичен методу InsertUnique()
+     * @return iterator
      */
-    template <typename... Args>
-    std::vector<std::pair<iterator, bool>> EmplaceUnique(Args &&...args) {
-        std::vector<std::pair<iterator, bool>> result;
-        result.reserve(sizeof...(args));
-
-        for (auto item : {std::forward<Args>(args)...}) {
-            tree_node *new_node = new tree_node(std::move(item));
-            std::pair<iterator, bool> result_insert =
-                Insert(Root(), new_node, true);
-            if (result_insert.second == false) {
-                delete new_node;
-            }
-            result.push_back(result_insert);
-        }
-        return result;
+    iterator End() noexcept {
+        return iterator(head_);
     }
 
     /**
-     * @brief Находит элемент с ключом, эквивалентным key. Стандарт не
-     * регулирует, какой именно элемент будет найден, если их несколько, но в
-     * gcc находится элемент из lower_bound(), поэтому делаем аналогично
+     * @brief Версия end() для const
      *
-     * @param key Искомый ключ
-     * @return iterator Итератор найденного элемента. Если такой элемент не
-     * найден, возвращается end().
+     * @return const_iterator
      */
-    iterator Find(const_reference key) {
-        iterator result = LowerBound(key);
-
-        if (result == End() || cmp_(key, *result)) {
-            // Если LowerBound() ничего не нашел или нашел элемент > key
-            return End();
-        }
-
-        // В остальных случаях возвращаем результат LowerBound()
-        return result;
+    const_iterator End() const noexcept {
+        return const_iterator(head_);
     }
 
     /**
-     * @brief Возвращает итератор, указывающий на первый элемент, который не
-     * меньше (т.е. больше или равен) key.
-     *
-     * @details Алгоритм расписан по ходу функции. Пример поиска тут:
-     * Дерево (с повторами):
-     *  /-6----\
-     * /4\  /--8\
-     * 2 6 /6\  10
-     *     6 6\
-     *        6
-     *
-     * Ищем элемент не меньше 5:
-     * 1я строка: 6 не меньше 5 == true, запоминаем 6 и идем искать влево от 6
-     * 2я строка: 4 не меньше 5 == false, идем искать вправо от 4
-     * 3я строка: 6 не меньше 5 == true, запоминаем 6 и идем искать влево от 6
-     * 4я строка: nullptr, поиск завершен. Последний запомненный результат - 6
-     * из 3й строки
-     *
-     * Ищем элемент не меньше 6:
-     * Идентично поискам 5
-     *
-     * Ищем элемент не меньше 7:
-     * 1я строка: 6 не меньше 7 == false, идем искать вправо
-     * 2я строка: 8 не меньше 7 == true, запоминаем 8 и идем искать влево от 8
-     * 3я строка: 6 не меньше 7 == false, идем искать вправо
-     * 4я строка: 6 не меньше 7 == false, идем искать вправо
-     * 5я строка: 6 не меньше 7 == false, идем искать вправо
-     * 6я строка: nullptr, поиск завершен. Последний запомненный результат - 8
+     * @brief Извлекает все элементы из other и вставляет их в this.
+     * @details Никакие элементы не копируются и не перемещаются,
+     * переназначаются только внутренние указатели узлов контейнера. Все
+     * указатели и ссылки на переданные элементы остаются действительными, но
+     * теперь ссылаются на *this, а не на other.
      *
-     * Ищем элемент не меньше 8:
-     * Идентично поискам 7
+     * В данной функции мы переносим все элементы, даже если такие уже есть в
+     * текущем дереве. Поэтому мы не используем функцию ExtractNode(), т.к. она
+     * вызывает перебалансировку дерева other после изъятия узла, что лишняя
+     * ненужная операция, т.к. все равно будут перенесены все без исключения
+     * элементы other. Поэтому мы проходимся по порядку по всем элементам other,
+     * изымаем их и вставляем в текущее дерево.
      *
-     * Ищем элемент не меньше 888:
-     * 1я строка: 6 не меньше 888 == false, идем искать вправо
-     * 2я строка: 8 не меньше 888 == false, идем искать вправо
-     * 3я строка: 10 не меньше 888 == false, идем искать вправо
-     * 4я строка: nullptr, поиск завершен. Т.к. ничего не запомнили, то
-     * возвращаем End()
+     * Т.к. мы не создаем копии узлов, то это экономит много времени.
      *
-     * @param key ключевое значение, с которым сравниваются элементы
-     * @return iterator Итератор, указывающий на первый элемент, который не
-     * меньше key. Если такой элемент не найден, возвращается итератор End().
+     * @param other
      */
-    iterator LowerBound(const_reference key) {
-        // Начинаем от корня
-        tree_node *start = Root();
-        // Результат по умолчанию End(), он и будет использован, если в ходе
-        // поисков мы ничего не найдем
-        tree_node *result = End().node_;
+    void Merge(tree_type &other) {
+        if (this != &other) {
+            iterator other_begin = other.Begin();
 
-        // Ищем в цикле нужный элемент, пока не упрёмся в nullptr
-        // для пустого дерева даже не зайдем в цикл и вернем End()
-        while (start != nullptr) {
-            if (!cmp_(start->key_, key)) {
-                // Если найден элемент не меньше key, то запоминаем его как
-                // предварительный результат поисков (т.е. как минимум один
-                // элемент уже найден), далее в цикле будем обновлять этот
-                // указатель, если ниже по дереву найдем еще один элемент не
-                // меньше key
-                result = start;
-                // Сдвигаем указатель на левый узел найденного узла, т.к. слева
-                // располагаются элементы меньше текущего и они могут быть ближе
-                // к искомому значению
-                start = start->left_;
-            } else {
-                // Если текущий узел меньше искомого, то идем вправо, т.к. там
-                // находятся элементы больше текущего
-                start = start->right_;
-            }
-        }
+            // Пока элементы есть в other, извлекаем их
+            while (other.size_ > 0) {
+                tree_node *moving_node = other_begin.node_;
+                ++other_begin;
 
-        return iterator(result);
-    }
+                // Отцепляем узел от других узлов в other
 
-    /**
-     * @brief Возвращает итератор, указывающий на первый элемент, который больше
-     * key.
-     *
-     * @details Алгоритм в целом аналогичен LowerBound, но типа наоборот (см.
-     * отличия в комментариях по ходу функции).
-     *
-     * @param key ключевое значение, с которым сравниваются элементы
-     * @return iterator Итератор, указывающий на первый элемент, который больше
-     * key. Если такой элемент не найден, возвращается итератор End().
-     */
-    iterator UpperBound(const_reference key) {
-        tree_node *start = Root();
-        tree_node *result = End().node_;
+                if (moving_node->left_ != nullptr) {
+                    // Т.к. у нас обход слева направо, то left_ всегда будет
+                    // nullptr Однако оставим эту проверку на случай
+                    // изменения/доработки алгоритма
+                    moving_node->left_->parent_ = moving_node->parent_;
+                }
 
-        while (start != nullptr) {
-            if (cmp_(key, start->key_)) {
-                // Если искомое значение меньше значения узла, то запоминаем
-                // текущий узел, т.к. он больше искомого
-                result = start;
-                // Продолжаем поиски в левой ветви, т.к. там могут быть значения
-                // меньше текущего узла, а нам надо найти самый маленький (т.е.
-                // ближайший к key) узел
-                start = start->left_;
-            } else
-                // В противном случае ищем узлы в правой ветви
-                start = start->right_;
-        }
+                if (moving_node->right_ != nullptr) {
+                    moving_node->right_->parent_ = moving_node->parent_;
+                }
+
+                if (moving_node->parent_->left_ == moving_node) {
+                    moving_node->parent_->left_ = nullptr;
+                }
+
+                if (moving_node->parent_->right_ == moving_node) {
+                    moving_node->parent_->right_ = nullptr;
+                }
+
+                // Приводим узел к виду по умолчанию
+                moving_node->ToDefault();
+
+                --other.size_;
+
+                Insert(Root(), moving_node, false);
+            }
 
-        return iterator(result);
+            // Приводим head дерева other в корректное состояние для пустого
+            // контейнера, чтобы other остался консистентным.
+            other.InitializeHead();
+        }
     }
 
     /**
-     * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
-     * элементы становятся недействительными. Другие ссылки и итераторы не
-     * затрагиваются.
+     * @brief Пытается извлечь элементы из other и вставить их в this. Если в
+     * *this есть элемент с ключом, эквивалентным ключу элемента из other,
+     * то этот элемент не извлекается из other.
      *
-     * @param pos
-     */
-    void Erase(iterator pos) noexcept {
-        tree_node *result = ExtractNode(pos);
-        delete result;
-    }
-
-    /**
-     * @brief Обменяет содержимое контейнера на содержимое other
-     * @details Не вызывает никаких операций перемещения, копирования или замены
-     * отдельных элементов. Все итераторы и ссылки остаются действительными.
-     * Итератор End() становится недействительным.
+     * @details Никакие элементы не копируются и не перемещаются,
+     * переназначаются только внутренние указатели узлов контейнера. Все
+     * указатели и ссылки на переданные элементы остаются действительными, но
+     * теперь ссылаются на *this, а не на other.
      *
-     * Проверка на самосвап бессмысленна, т.к. дерево это переживает, а лишняя
-     * проверка будет всегда вызываться, а реально будет редко нужна.
+     * Т.к. other может остаться непустым после операции, то для извлечения
+     * узлов из other мы используем ExtractNode(), т.к. она вызывает
+     * перебалансировку, а мы должны сохранить other корректным красно-чёрным
+     * деревом.
      *
      * @param other
      */
-    void Swap(tree_type &other) noexcept {
-        std::swap(head_, other.head_);
-        std::swap(size_, other.size_);
-        std::swap(cmp_, other.cmp_);
+    void MergeUnique(tree_type &other) {
+        if (this != &other) {
+            iterator other_begin = other.Begin();
+            iterator other_end = other.End();
+
+            while (other_begin != other_end) {
+                iterator result_it = Find(other_begin.node_->key_);
+                if (result_it == End()) {
+                    iterator tmp = other_begin;
+                    ++other_begin;
+                    tree_node *moving_node = other.ExtractNode(tmp);
+                    Insert(Root(), moving_node, false);
+                } else {
+                    ++other_begin;
+                }
+            }
+        }
     }
 
     /**
-     * @brief Метод для тестирования красно-черного дерева на корректность.
-     * @details Проверяет все правила, которые должны соблюдаться для дерева
-     * (см. описание в начале файла). Пояснения написаны по ходу метода.
-     *
-     * @return true Дерево корректно
-     * @return false Дерево некорректно
+     * @brief Заменяет содержимое дерева элементами из диапазона [first, last)
+     * (массовое построение дерева).
+     *
+     * @details В отличие от поэлементной вставки (O(n log n) с балансировкой
+     * после каждой вставки) элементы сначала сортируются, а затем из
+     * отсортированной последовательности узлов сразу строится сбалансированное
+     * дерево (см. LinkBalanced()). Сортировка устойчивая, поэтому при
+     * unique_only из группы эквивалентных элементов остается первый - так же,
+     * как при последовательной вставке через InsertUnique().
+     *
+     * Если передан пул потоков, то сортировка, создание узлов и связывание
+     * дерева выполняются параллельно.
+     *
+     * Strong exception guarantee.
+     *
+     * @param first Начало диапазона
+     * @param last Конец диапазона
+     * @param unique_only true - элементы с эквивалентными ключами не
+     * дублируются (set, map), false - дублируются (multiset)
+     * @param pool Пул потоков или nullptr для последовательного выполнения
      */
-    bool CheckTree() const noexcept {
-        // head дерева должен быть красный.
-        if (head_->color_ == kBlack) {
-            return false;
-        }
+    template <typename InputIt>
+    void Build(InputIt first, InputIt last, bool unique_only,
+               ThreadPool *pool = nullptr) {
+        std::vector<key_type> items(first, last);
+
+        // Сортируем указатели, а не сами элементы, т.к. элементы могут быть
+        // неперемещаемыми (например, std::pair<const Key, Type> в map)
+        std::vector<key_type *> order(items.size());
+        for (size_type i = 0; i < items.size(); ++i) {
+            order[i] = &items[i];
+        }
+        SortPointers(order, pool);
+
+        if (unique_only) {
+            order.erase(std::unique(order.begin(), order.end(),
+                                    [this](const key_type *lhs,
+                                           const key_type *rhs) {
+                                        return !cmp_(*lhs, *rhs);
+                                    }),
+                        order.end());
+        }
+
+        std::vector<tree_node *> nodes = CreateNodes(
+            order.size(),
+            [&order](size_type i) -> key_type && {
+                return std::move(*order[i]);
+            },
+            pool);
 
-        // Пустое дерево корректно всегда
-        if (Root() == nullptr) {
-            return true;
-        }
+        Clear();
+        LinkSortedNodes(nodes, pool);
+    }
 
-        // Корень дерева должен быть чёрный.
-        if (Root()->color_ == kRed) {
-            return false;
+    /**
+     * @brief Параллельная версия MergeUnique().
+     *
+     * @details Вместо поиска и вставки каждого узла other по отдельности
+     * (O(m log(n + m))) узлы обоих деревьев выписываются по порядку, затем
+     * отсортированные последовательности сливаются параллельно (каждый поток
+     * сливает свой диапазон ключей), и из результатов заново связываются оба
+     * дерева. Узлы не копируются и не создаются заново, поэтому итераторы и
+     * ссылки остаются действительными, как и в последовательной версии.
+     * Сложность O(n + m).
+     *
+     * @param other
+     * @param pool Пул потоков
+     */
+    void MergeUnique(tree_type &other, ThreadPool &pool) {
+        if (this == &other || other.Empty()) {
+            return;
         }
 
-        // Оба потомка каждого красного узла — чёрные.
-        if (checkRedNodes(Root()) == false) {
-            return false;
-        }
+        std::vector<tree_node *> this_nodes = CollectNodes();
+        std::vector<tree_node *> other_nodes = other.CollectNodes();
 
-        // Любой простой путь от узла-предка до листового узла-потомка содержит
-        // одинаковое число чёрных узлов.
-        if (ComputeBlackHeight(Root()) == -1) {
-            return false;
-        }
+        std::vector<tree_node *> merged;
+        std::vector<tree_node *> rest;
+        MergeSorted(this_nodes, other_nodes, kMergeUnion, merged, &rest,
+                    &pool);
 
-        // Если всё ок, то возвращаем true
-        return true;
+        LinkSortedNodes(merged, &pool);
+        other.LinkSortedNodes(rest, &pool);
     }
 
-  private:
     /**
-     * @brief Приватный метод для копирования дерева other в this.
+     * @brief Возвращает новое дерево с объединением элементов this и other.
+     * Если элемент с эквивалентным ключом есть в обоих деревьях, то в
+     * результат копируется элемент из this.
      *
-     * @todo В части кейсов копирование осуществляется медленнее, чем в std.
-     * Связано это с тем, что наша версия Clear() медленнее оригинала, само
-     * копирование сопоставимо по скорости.
-     * @param other Копируемое дерево
+     * @details Используется для set/map, т.е. оба дерева не должны содержать
+     * повторяющихся элементов. Сложность O(n + m): отсортированные
+     * последовательности узлов сливаются (параллельно, если передан пул
+     * потоков), а затем из копий выбранных элементов строится
+     * сбалансированное дерево.
+     *
+     * @param other
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     * @return tree_type
      */
-    void CopyTreeFromOther(const tree_type &other) {
-        tree_node *other_copy_root = CopyTree(other.Root(), nullptr);
-        // Важно, что мы сначала создаем полную копию, а только потом вызываем
-        // очистку текущего дерева. Это необходимо для того, чтобы текущее
-        // дерево не было уничтожено, если при копировании вылетит исключение
-        // (см. тесты "CopyLeaks").
-        Clear();
-        Root() = other_copy_root;
-        Root()->parent_ = head_;
-        MostLeft() = SearchMinimum(Root());
-        MostRight() = SearchMaximum(Root());
-        size_ = other.size_;
-        cmp_ = other.cmp_;
+    tree_type Union(const tree_type &other, ThreadPool *pool = nullptr) const {
+        return CombineWith(other, kMergeUnion, pool);
     }
 
     /**
-     * @brief Приватный метод для рекурсивного создания копий узлов и связей
-     * между ними
+     * @brief Возвращает новое дерево с элементами this, ключи которых есть в
+     * other. Детали реализации аналогичны Union().
      *
-     * @param node копируемый узел.
-     * @param parent копия родителя копируемого узла.
-     * @return tree_node* указатель на созданную копию узла.
+     * @param other
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     * @return tree_type
      */
-    [[nodiscard]] tree_node *CopyTree(const tree_node *node,
-                                      tree_node *parent) {
-        // Если вылетит исключение при создании самого первого узла, то ничего
-        // страшного, ничего создано не будет
-        tree_node *copy = new tree_node{node->key_, node->color_};
-        // А вот все рекурсивные вызовы оборачиваем в try/catch, чтобы в случае
-        // возникновения исключения удалить все уже скопированные узлы (иначе
-        // будет утечка)
-        try {
-            if (node->left_) {
-                copy->left_ = CopyTree(node->left_, copy);
-            }
-
-            if (node->right_) {
-                copy->right_ = CopyTree(node->right_, copy);
-            }
-        } catch (...) {
-            Destroy(copy);
-            throw;
-        }
-
-        copy->parent_ = parent;
-        return copy;
+    tree_type Intersection(const tree_type &other,
+                           ThreadPool *pool = nullptr) const {
+        return CombineWith(other, kMergeIntersection, pool);
     }
 
     /**
-     * @brief Рекурсивно удаляет все узлы дерева и освобождает память, кроме
-     * служебного узла head.
+     * @brief Возвращает новое дерево с элементами this, ключей которых нет в
+     * other. Детали реализации аналогичны Union().
      *
-     * @todo map - 199054 элементов: std: 38.626 ms; s21: 65.842 ms;
-     * Отказаться от двойной рекурсии? Или это из-за неудачного механизма
-     * компаратора? set/multiset показывают лучшие результаты, чем map
-     * @param node
+     * @param other
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     * @return tree_type
      */
-    void Destroy(tree_node *node) noexcept {
-        if (node == nullptr)
-            return;
-        Destroy(node->left_);
-        Destroy(node->right_);
-        delete node;
+    tree_type Difference(const tree_type &other,
+                         ThreadPool *pool = nullptr) const {
+        return CombineWith(other, kMergeDifference, pool);
     }
 
     /**
-     * @brief Приватный метод, который выставляет значения служебного узла head
-     * в значения, необходимые для пустого дерева
+     * @brief Вставляет элемент со значением key в контейнер. Если в контейнере
+     * есть элементы с эквивалентным ключом, вставка выполняется по верхней
+     * границе этого диапазона.
+     *
+     * @param key Значение элемента для вставки
+     * @return iterator Итератор, указывающий на вставленный элемент
      */
-    void InitializeHead() noexcept {
-        // У пустого дерева корня нет
-        Root() = nullptr;
-        // Т.к. элементов нет, то самый маленький (самый левый) элемент будет
-        // указывать на голову
-        MostLeft() = head_;
-        // Т.к. элементов нет, то самый большой (самый правый) элемент будет
-        // указывать на голову
-        MostRight() = head_;
+    iterator Insert(const key_type &key) {
+        tree_node *new_node = new tree_node{key};
+        return Insert(Root(), new_node, false).first;
     }
 
     /**
-     * @brief Возвращает ссылку на корень дерева
+     * @brief Вставляет элемент со значением key в контейнер, если контейнер еще
+     * не содержит элемент с эквивалентным ключом.
      *
-     * @return tree_node*&
+     * @param key Значение элемента для вставки
+     * @return std::pair<iterator, bool> - Пара, состоящая из итератора для
+     * вставленного элемента (или для элемента, который предотвратил вставку) и
+     * логического значения, установленного в true, если вставка произошла
+     * (false, если вставка не произошла
      */
-    tree_node *&Root() {
-        return head_->parent_;
+    std::pair<iterator, bool> InsertUnique(const key_type &key) {
+        tree_node *new_node = new tree_node{key};
+        std::pair<iterator, bool> result = Insert(Root(), new_node, true);
+        if (result.second == false) {
+            // Если вставка не произошла, то удаляем созданный узел
+            delete new_node;
+        }
+
+        return result;
     }
 
     /**
-     * @brief Возвращает ссылку на корень дерева для const-объектов
+     * @brief Размещает новые элементы args в контейнер. Если в контейнере
+     * есть элементы с эквивалентным ключом, вставка выполняется по верхней
+     * границе этого диапазона.
      *
-     * @return const tree_node*
+     * @tparam Args Пакет параметров шаблона (Parameter pack)
+     * @param args Уже созданные элементы, которые необходимо вставить в
+     * соответствующий контейнер.
+     * @details Модифицированная версия метода emplace, которая отличается от
+     * реализации в std, т.к. получает в качестве аргументов args уже созданные
+     * объекты для размещения в контейнере (а не параметры для конструирования
+     * объектов)
+     *
+     * Однако при реализации мы должны сохранить основную идею Emplace:
+     * Основное отличие от insert - избежать ненужных копирований объекта,
+     * единожды созданный временный объект будет передаваться по функциям без
+     * копирования и встроится в дерево.
+     *
+     * @return std::vector<std::pair<iterator, bool>> Т.к. функция может
+     * вставить несколько элементов, то возвращается вектор, содержащий пары
+     * результата вставки для каждого вставляемого элемента. Формат пары
+     * идентичен методу InsertUnique()
      */
-    const tree_node *Root() const {
-        return head_->parent_;
+    template <typename... Args>
+    std::vector<std::pair<iterator, bool>> Emplace(Args &&...args) {
+        std::vector<std::pair<iterator, bool>> result;
+        // Т.к. args может быть большим, но это число нам сразу известно, то
+        // выделяем нужное количество памяти на вектор, чтобы избежать ненужных
+        // повторных выделений памяти в процессе
+        result.reserve(sizeof...(args));
+
+        // Обязательно используем std::forward, чтобы избежать лишних
+        // копирований в item
+        for (auto item : {std::forward<Args>(args)...}) {
+            // И используем std::move, чтобы опять избежать лишних копирований
+            tree_node *new_node = new tree_node(std::move(item));
+            std::pair<iterator, bool> result_insert =
+                Insert(Root(), new_node, false);
+            result.push_back(result_insert);
+        }
+        return result;
     }
 
     /**
-     * @brief Возвращает ссылку на самый маленький (самый левый) элемент дерева
+     * @brief Размещает новые элементы args в контейнер, если контейнер ещё не
+     * содержит элемент с эквивалентным ключом.
      *
-     * @return tree_node*&
+     * @details В остальном работает идентично Emplace().
+     *
+     * @tparam Args Пакет параметров шаблона (Parameter pack)
+     * @param args Уже созданные элементы, которые необходимо вставить в
+     * соответствующий контейнер.
+     * @return std::vector<std::pair<iterator, bool>> Т.к. функция может
+     * вставить несколько элементов, то возвращается вектор, содержащий пары
+     * результата вставки для каждого вставляемого элемента. Формат пары
+     * идентичен методу InsertUnique()
      */
-    tree_node *&MostLeft() {
-        return head_->left_;
+    template <typename... Args>
+    std::vector<std::pair<iterator, bool>> EmplaceUnique(Args &&...args) {
+        std::vector<std::pair<iterator, bool>> result;
+        result.reserve(sizeof...(args));
+
+        for (auto item : {std::forward<Args>(args)...}) {
+            tree_node *new_node = new tree_node(std::move(item));
+            std::pair<iterator, bool> result_insert =
+                Insert(Root(), new_node, true);
+            if (result_insert.second == false) {
+                delete new_node;
+            }
+            result.push_back(result_insert);
+        }
+        return result;
     }
 
     /**
-     * @brief Возвращает ссылку на самый маленький (самый левый) элемент дерева
-     * для const-объектов
+     * @brief Находит элемент с ключом, эквивалентным key. Стандарт не
+     * регулирует, какой именно элемент будет найден, если их несколько, но в
+     * gcc находится элемент из lower_bound(), поэтому делаем аналогично
      *
-     * @return tree_node*&
+     * @param key Искомый ключ
+     * @return iterator Итератор найденного элемента. Если такой элемент не
+     * найден, возвращается end().
      */
-    const tree_node *MostLeft() const {
-        return head_->left_;
-    }
+    iterator Find(const_reference key) {
+        iterator result = LowerBound(key);
 
-    /**
-     * @brief Возвращает ссылку на самый большой (самый правый) элемент дерева
-     * @details Версию для const-объектов не реализуем, т.к. в наших функциях
-     * эта версия просто негде вызывать
-     *
-     * @return tree_node*&
-     */
-    tree_node *&MostRight() {
-        return head_->right_;
+        if (result == End() || cmp_(key, *result)) {
+            // Если LowerBound() ничего не нашел или нашел элемент > key
+            return End();
+        }
+
+        // В остальных случаях возвращаем результат LowerBound()
+        return result;
     }
 
     /**
-     * @brief Встраивает узел new_node в дерево ниже узла root.
-     * @details Алгоритм стандартен для любого бинарного дерева: если
-     * вставляемый узел меньше текущего, то ищем место для вставки в левой ветви
-     * дерева, если больше (или равен), то ищем место для вставки в правой ветви
-     * дерева, пока не дойдем до пустого узла (nullptr) - в это место и
-     * вставляем.
-     *
-     * Если вставка повторяющихся элементов запрещена (см. параметр
-     * unique_only), то поиск останавливается, если нашли элемент с
-     * эквивалентным ключом.
-     *
-     * @param root Узел, от которого мы начинаем искать место, куда встроить
-     * новый узел
-     * @param new_node Встраиваемый узел
-     * @param unique_only Режим вставки:
-     * true - вставка только уникальных узлов, вставка осуществляется только,
-     * если контейнер ещё не содержит элемент с эквивалентным ключом. false -
-     * вставка любого узла, в т.ч., если контейнер уже содержит элемент с
-     * эквивалентным ключом.
-     * @todo Insert можно ускорить, если сделать разные версии для обычной
-     * вставки и unique, так сейсчас при обычной вставке мы делаем лишние
-     * проверки, которые можно и не делать
-     * @todo подозрительно быстро (особенно с оптимизацией) делается вставка
-     * 200000 одинаковых элементов в set
-     * @return std::pair<iterator, bool> - Пара, состоящая из итератора для
-     * вставленного элемента (или для элемента, который предотвратил вставку) и
-     * логического значения, установленного в true, если вставка произошла
-     * (false, если вставка не произошла
+     * @brief Версия Find() для поиска по значению другого типа (например,
+     * по ключу словаря без создания пары ключ-значение).
+     *
+     * @tparam SearchKey Тип искомого значения
+     * @tparam KeyLess Компаратор с перегрузками (key_type, SearchKey) и
+     * (SearchKey, key_type), согласованный с компаратором дерева
+     * @param key Искомое значение
+     * @param less Компаратор
+     * @return iterator Итератор найденного элемента или End()
      */
-    std::pair<iterator, bool> Insert(tree_node *root, tree_node *new_node,
-                                     bool unique_only) {
-        tree_node *node = root;
-        tree_node *parent = nullptr;
-
-        // Ищем место для вставки, пока не дойдем до пустого узла
+    template <typename SearchKey, typename KeyLess>
+    iterator Find(const SearchKey &key, const KeyLess &less) {
+        tree_node *node = Root();
+        tree_node *result = head_;
         while (node != nullptr) {
-            parent = node;
-            if (cmp_(new_node->key_, node->key_)) {
-                // Если new_node < node
+            if (!less(node->key_, key)) {
+                result = node;
                 node = node->left_;
             } else {
-                // Иначе (т.е. node >= new_node)
-                if (unique_only == false) {
-                    // Если вставка неуникальных элементов разрешена, то всегда
-                    // продолжаем искать дальше в правой ветви (т.к. нам не
-                    // важно, равно ли значение текущего узла вставляемому)
-                    node = node->right_;
-                } else {
-                    // Если вставка неуникальных элементов не разрешена, то
-                    // выясняем node > new_node или node == new_node
-                    if (cmp_(node->key_, new_node->key_)) {
-                        // Если node > new_node, то продолжаем поиски в правой
-                        // ветви
-                        node = node->right_;
-                    } else {
-                        // Если node == new_node то возвращаем результат о
-                        // невозможности вставки элемента
-                        return {iterator(node), false};
-                    }
-                }
+                node = node->right_;
             }
         }
 
-        // После окончания цикла parent буден указывать на узел, потомком
-        // которого станет new_node. При этом parent может быть равен nullptr,
-        // если в дереве не окажется узлов (пустое дерево), если мы даже не
-        // зашли в цикл выше
+        if (result == head_ || less(key, result->key_)) {
+            return End();
+        }
+        return iterator(result);
+    }
 
-        if (parent != nullptr) {
-            // Если дерево не пустое
-            // То родителем нового узла указываем найденный parent
-            new_node->parent_ = parent;
-            if (cmp_(new_node->key_, parent->key_)) {
-                parent->left_ = new_node;
+    /**
+     * @brief Ищет элемент, эквивалентный key, и, если его нет, создает новый
+     * элемент из args прямо в узле дерева - за один спуск по дереву.
+     *
+     * @details В отличие от пары Find() + InsertUnique(), место вставки
+     * запоминается во время поиска, поэтому при промахе дерево не
+     * обходится повторно, а элемент не копируется: узел конструируется из
+     * args на месте (std::in_place). При попадании ничего не создается.
+     *
+     * @tparam SearchKey Тип искомого значения
+     * @tparam KeyLess Компаратор (см. Find(key, less))
+     * @tparam Args Типы аргументов конструктора key_type
+     * @param key Искомое значение
+     * @param less Компаратор
+     * @param args Аргументы конструктора нового элемента
+     * @return std::pair<iterator, bool> Итератор на найденный или созданный
+     * элемент и true, если элемент был создан
+     */
+    template <typename SearchKey, typename KeyLess, typename... Args>
+    std::pair<iterator, bool> FindOrEmplace(const SearchKey &key,
+                                            const KeyLess &less,
+                                            Args &&...args) {
+        tree_node *node = Root();
+        tree_node *parent = nullptr;
+        bool to_left = false;
+        while (node != nullptr) {
+            parent = node;
+            if (less(key, node->key_)) {
+                to_left = true;
+                node = node->left_;
+            } else if (less(node->key_, key)) {
+                to_left = false;
+                node = node->right_;
             } else {
-                parent->right_ = new_node;
+                return {iterator(node), false};
             }
-        } else {
-            // Если дерево пустое, то new_node становится корнем дерева
-            new_node->color_ = kBlack;
-            new_node->parent_ = head_;
-            Root() = new_node;
-        }
-
-        ++size_;
-
-        // Обновляем указатель на самый маленький элемент дерева, если
-        // необходимо
-        if (MostLeft() == head_ || MostLeft()->left_ != nullptr) {
-            MostLeft() = new_node;
-        }
-
-        // Обновляем указатель на самый большой элемент дерева, если необходимо
-        if (MostRight() == head_ || MostRight()->right_ != nullptr) {
-            MostRight() = new_node;
         }
 
-        // Вызываем балансировку после вставки нового узла
-        BalancingInsert(new_node);
-
+        tree_node *new_node =
+            new tree_node(std::in_place, std::forward<Args>(args)...);
+        LinkNode(parent, to_left, new_node);
         return {iterator(new_node), true};
     }
 
     /**
-     * @brief Балансировка дерева, после вставки нового элемента.
-     * @details Основной алгоритм расписан по ходу функции, используемая
-     * терминология:
-     * node — добавленный элемент (сын), который нарушает 3 пункт правил (Оба
-     * потомка каждого красного узла — чёрные). Хотя на самом деле может и не
-     * нарушает, мы всегда вызываем балансировку. Но если условия не нарушены,
-     * то мы не зайдем в цикл while
+     * @brief Возвращает итератор, указывающий на первый элемент, который не
+     * меньше (т.е. больше или равен) key.
      *
-     * parent — папа элемента node
+     * @details Алгоритм расписан по ходу функции. Пример поиска тут:
+     * Дерево (с повторами):
+     *  /-6----\
+     * /4\  /--8\
+     * 2 6 /6\  10
+     *     6 6\
+     *        6
      *
-     * gparent — дедушка элемента node, папа элемента parent
+     * Ищем элемент не меньше 5:
+     * 1я строка: 6 не меньше 5 == true, запоминаем 6 и идем искать влево от 6
+     * 2я строка: 4 не меньше 5 == false, идем искать вправо от 4
+     * 3я строка: 6 не меньше 5 == true, запоминаем 6 и идем искать влево от 6
+     * 4я строка: nullptr, поиск завершен. Последний запомненный результат - 6
+     * из 3й строки
      *
-     * uncle — дядя элемента node, брат элемента parent, второй сын элемента
-     * gparent
+     * Ищем элемент не меньше 6:
+     * Идентично поискам 5
      *
-     * При перебалансировке возможны 6 различных случаев:
-     * 1) 3 случая, когда дядя справа у деда
-     * 2) 3 случая, когда дядя слева у деда
+     * Ищем элемент не меньше 7:
+     * 1я строка: 6 не меньше 7 == false, идем искать вправо
+     * 2я строка: 8 не меньше 7 == true, запоминаем 8 и идем искать влево от 8
+     * 3я строка: 6 не меньше 7 == false, идем искать вправо
+     * 4я строка: 6 не меньше 7 == false, идем искать вправо
+     * 5я строка: 6 не меньше 7 == false, идем искать вправо
+     * 6я строка: nullptr, поиск завершен. Последний запомненный результат - 8
      *
-     * Походу функции подробно описаны первые 3 случая. Вторые 3 случая
-     * зеркально отражают первые 3 случая (это очень наглядно будет видно по
-     * коду).
+     * Ищем элемент не меньше 8:
+     * Идентично поискам 7
      *
-     * P.S. Можно посмотреть картинки, примеры и почитать дополнительные
-     * описания тут: https://habr.com/ru/company/otus/blog/472040/
+     * Ищем элемент не меньше 888:
+     * 1я строка: 6 не меньше 888 == false, идем искать вправо
+     * 2я строка: 8 не меньше 888 == false, идем искать вправо
+     * 3я строка: 10 не меньше 888 == false, идем искать вправо
+     * 4я строка: nullptr, поиск завершен. Т.к. ничего не запомнили, то
+     * возвращаем End()
      *
-     * @param node добавленный элемент
+     * @param key ключевое значение, с которым сравниваются элементы
+     * @return iterator Итератор, указывающий на первый элемент, который не
+     * меньше key. Если такой элемент не найден, возвращается итератор End().
      */
-    void BalancingInsert(tree_node *node) {
-        // Папа
-        tree_node *parent = node->parent_;
-
-        while (node != Root() && parent->color_ == kRed) {
-            // Дед
-            tree_node *gparent = parent->parent_;
-
-            if (gparent->left_ == parent) {
-                // Обрабатываем ситуацию, когда дядя справа у деда
-                tree_node *uncle = gparent->right_;
-
-                if (uncle != nullptr && uncle->color_ == kRed) {
-                    // Случай первый — красный дядя
-
-                    // Если и отец, и дядя красного цвета, то мы можем
-                    // «спустить» чёрный цвет с уровня деда на уровень отца и
-                    // перекрасить узлы. В этом случае «чёрная высота» останется
-                    // прежней, однако возможно нарушение 3 правила для элемента
-                    // gparent, поэтому необходимо рекурсивно вызвать дальнейшую
-                    // балансировку для этого узла (следующая итерация цикла
-                    // while).
-                    parent->color_ = kBlack;
-                    uncle->color_ = kBlack;
-                    gparent->color_ = kRed;
-                    // Меняем указатели для следующей итерации цикла while
-                    node = gparent;
-                    parent = node->parent_;
-                } else {
-                    // Случай второй — чёрный дядя — папа и дед в разных
-                    // сторонах.
-
-                    // Эту структуру необходимо привести к третьему случаю,
-                    // когда папа и дед идут в одну сторону. Для этого нужно
-                    // выполнить малый поворот от сына node к его отцу и далее
-                    // будет вызван 3 случай для элемента node.
-                    if (parent->right_ == node) {
-                        // Выполняем поворот
-                        RotateLeft(parent);
-                        // Меняем местами указатели на отца и сына, т.к. в
-                        // третьем случае сын снизу должен быть, а после
-                        // поворота node встала сверху от parent
-                        std::swap(parent, node);
-                    }
-                    // Случай третий — чёрный дядя — папа и дед в одной стороне
+    iterator LowerBound(const_reference key) {
+        // Начинаем от корня
+        tree_node *start = Root();
+        // Результат по умолчанию End(), он и будет использован, если в ходе
+        // поисков мы ничего не найдем
+        tree_node *result = End().node_;
 
-                    // В этом случае мы уже можем совершить большой поворот от
-                    // отца через деда к чёрному дяде и перекрасить parent в
-                    // чёрный, а gparent в красный.
-                    RotateRight(gparent);
-                    gparent->color_ = kRed;
-                    parent->color_ = kBlack;
-                    break;
-                }
+        // Ищем в цикле нужный элемент, пока не упрёмся в nullptr
+        // для пустого дерева даже не зайдем в цикл и вернем End()
+        while (start != nullptr) {
+            if (!cmp_(start->key_, key)) {
+                // Если найден элемент не меньше key, то запоминаем его как
+                // предварительный результат поисков (т.е. как минимум один
+                // элемент уже найден), далее в цикле будем обновлять этот
+                // указатель, если ниже по дереву найдем еще один элемент не
+                // меньше key
+                result = start;
+                // Сдвигаем указатель на левый узел найденного узла, т.к. слева
+                // располагаются элементы меньше текущего и они могут быть ближе
+                // к искомому значению
+                start = start->left_;
             } else {
-                // Обрабатываем ситуацию, когда дядя слева у деда
-                tree_node *uncle = gparent->left_;
+                // Если текущий узел меньше искомого, то идем вправо, т.к. там
+                // находятся элементы больше текущего
+                start = start->right_;
+            }
+        }
+
+        return iterator(result);
+    }
 
-                if (uncle != nullptr && uncle->color_ == kRed) {
-                    // Случай первый — красный дядя
-                    // Аналогично ситуации, когда дядя справа у деда
-                    parent->color_ = kBlack;
-                    uncle->color_ = kBlack;
-                    gparent->color_ = kRed;
+    /**
+     * @brief Возвращает итератор, указывающий на первый элемент, который больше
+     * key.
+     *
+     * @details Алгоритм в целом аналогичен LowerBound, но типа наоборот (см.
+     * отличия в комментариях по ходу функции).
+     *
+     * @param key ключевое значение, с которым сравниваются элементы
+     * @return iterator Итератор, указывающий на первый элемент, который больше
+     * key. Если такой элемент не найден, возвращается итератор End().
+     */
+    iterator UpperBound(const_reference key) {
+        tree_node *start = Root();
+        tree_node *result = End().node_;
 
-                    node = gparent;
-                    parent = node->parent_;
-                } else {
-                    // Случай второй — чёрный дядя — папа и дед в разных
-                    // сторонах. Аналогично ситуации, когда дядя справа у деда
-                    if (parent->left_ == node) {
-                        RotateRight(parent);
-                        std::swap(parent, node);
-                    }
-                    // Случай третий — чёрный дядя — папа и дед в одной стороне
-                    // Аналогично ситуации, когда дядя справа у деда
-                    RotateLeft(gparent);
-                    gparent->color_ = kRed;
-                    parent->color_ = kBlack;
-                    break;
-                }
-            }
+        while (start != nullptr) {
+            if (cmp_(key, start->key_)) {
+                // Если искомое значение меньше значения узла, то запоминаем
+                // текущий узел, т.к. он больше искомого
+                result = start;
+                // Продолжаем поиски в левой ветви, т.к. там могут быть значения
+                // меньше текущего узла, а нам надо найти самый маленький (т.е.
+                // ближайший к key) узел
+                start = start->left_;
+            } else
+                // В противном случае ищем узлы в правой ветви
+                start = start->right_;
         }
 
-        // Корень всегда должен быть черным после наших поворотов
-        Root()->color_ = kBlack;
+        return iterator(result);
     }
 
     /**
-     * @brief Вращаем дерево вправо относительно node
+     * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
+     * элементы становятся недействительными. Другие ссылки и итераторы не
+     * затрагиваются.
      *
-     * @param node
+     * @param pos
      */
-    void RotateRight(tree_node *node) noexcept {
-        // Выбираем левый узел в качестве опорного
-        tree_node *const pivot = node->left_;
+    void Erase(iterator pos) noexcept {
+        tree_node *result = ExtractNode(pos);
+        delete result;
+    }
 
-        pivot->parent_ = node->parent_;
+    /**
+     * @brief Извлекает узел на позиции pos из дерева, не удаляя его.
+     * @details Узел отцепляется так же, как при Erase() (с перебалансировкой
+     * дерева), но память не освобождается - владение узлом переходит к
+     * возвращаемому дескриптору. Итераторы и ссылки на извлеченный элемент
+     * остаются действительными и после вставки узла в другое дерево.
+     *
+     * @param pos Итератор на извлекаемый элемент
+     * @return node_handle Дескриптор узла (пустой для pos == End())
+     */
+    node_handle Extract(iterator pos) noexcept {
+        return node_handle(ExtractNode(pos));
+    }
 
-        if (node == Root()) {
-            // Опорный элемент становится корнем дерева, если node было корнем
-            Root() = pivot;
-        } else if (node->parent_->left_ == node) {
-            // Если узел был слева у родителя, то опорный элемент становится
-            // слева
-            node->parent_->left_ = pivot;
-        } else {
-            // Если узел была справа у родителя, то опорный элемент становится
-            // справа
-            node->parent_->right_ = pivot;
+    /**
+     * @brief Извлекает узел с элементом, эквивалентным key (см. Find())
+     *
+     * @param key Ключ извлекаемого элемента
+     * @return node_handle Дескриптор узла (пустой, если элемента нет)
+     */
+    node_handle Extract(const_reference key) {
+        return Extract(Find(key));
+    }
+
+    /**
+     * @brief Встраивает узел из дескриптора node в дерево без выделения
+     * памяти. Если в дереве есть элементы с эквивалентным ключом, вставка
+     * выполняется по верхней границе этого диапазона.
+     *
+     * @param node Дескриптор узла, после вставки становится пустым
+     * @return iterator Итератор на вставленный элемент (End() для пустого
+     * дескриптора)
+     */
+    iterator Insert(node_handle &&node) {
+        if (node.empty()) {
+            return End();
         }
+        return Insert(Root(), node.Release(), false).first;
+    }
 
-        node->left_ = pivot->right_;
-        if (pivot->right_ != nullptr) {
-            pivot->right_->parent_ = node;
+    /**
+     * @brief Встраивает узел из дескриптора node в дерево, если в дереве ещё
+     * нет элемента с эквивалентным ключом.
+     *
+     * @param node Дескриптор узла
+     * @return insert_return_type Если вставка не произошла, узел возвращается
+     * в поле node результата
+     */
+    insert_return_type InsertUnique(node_handle &&node) {
+        if (node.empty()) {
+            return {End(), false, node_handle{}};
+        }
+        std::pair<iterator, bool> result = Insert(Root(), node.node_, true);
+        if (result.second) {
+            node.Release();
         }
+        return {result.first, result.second, std::move(node)};
+    }
 
-        node->parent_ = pivot;
-        pivot->right_ = node;
+    /**
+     * @brief Обменяет содержимое контейнера на содержимое other
+     * @details Не вызывает никаких операций перемещения, копирования или замены
+     * отдельных элементов. Все итераторы и ссылки остаются действительными.
+     * Итератор End() становится недействительным.
+     *
+     * Проверка на самосвап бессмысленна, т.к. дерево это переживает, а лишняя
+     * проверка будет всегда вызываться, а реально будет редко нужна.
+     *
+     * @param other
+     */
+    void Swap(tree_type &other) noexcept {
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        std::swap(cmp_, other.cmp_);
     }
 
     /**
-     * @brief Вращаем дерево влево относительно node.
-     * @details В целом аналогично повороту вправо, только в другую сторону
+     * @brief Метод для тестирования красно-черного дерева на корректность.
+     * @details Проверяет все правила, которые должны соблюдаться для дерева
+     * (см. описание в начале файла). Пояснения написаны по ходу метода.
      *
-     * @param node
+     * @return true Дерево корректно
+     * @return false Дерево некорректно
      */
-    void RotateLeft(tree_node *node) noexcept {
-        tree_node *const pivot = node->right_;
+    bool CheckTree() const noexcept {
+        // head дерева должен быть красный.
+        if (head_->color_ == kBlack) {
+            return false;
+        }
 
-        pivot->parent_ = node->parent_;
+        // Пустое дерево корректно всегда
+        if (Root() == nullptr) {
+            return true;
+        }
 
-        if (node == Root()) {
-            Root() = pivot;
-        } else if (node->parent_->left_ == node) {
-            node->parent_->left_ = pivot;
-        } else {
-            node->parent_->right_ = pivot;
+        // Корень дерева должен быть чёрный.
+        if (Root()->color_ == kRed) {
+            return false;
         }
 
-        node->right_ = pivot->left_;
-        if (pivot->left_ != nullptr) {
-            pivot->left_->parent_ = node;
+        // Оба потомка каждого красного узла — чёрные.
+        if (checkRedNodes(Root()) == false) {
+            return false;
         }
 
-        node->parent_ = pivot;
-        pivot->left_ = node;
+        // Любой простой путь от узла-предка до листового узла-потомка содержит
+        // одинаковое число чёрных узлов.
+        if (ComputeBlackHeight(Root()) == -1) {
+            return false;
+        }
+
+        // Если всё ок, то возвращаем true
+        return true;
     }
 
+  private:
     /**
-     * @brief Изымает узел в позиции pos из дерева, при необходимости
-     * осуществляется ребалансировка дерева.
-     *
-     * @details Чтобы удалить узел из красно-черного дерева, мы следуем обычному
-     * процессу удаления BST, который гарантирует, что удаляемый узел является
-     * либо конечным узлом (т.е. не содержит дочерних узлов), либо имеет только
-     * один дочерний узел. Возможные варианты удаляемых узлов:
-     *
-     * 1) К2 — красный узел с двумя детьми.
-     * Задача удаления узла с двумя дочерними элементами сводится к задаче
-     * удаления узла с одним или нулём дочерних элементов. Для этого необходимо
-     * найти ближайший элемент, который меньше или больше удаляемого и поменять
-     * их местами.
-     *
-     * ВАЖНО: Наиболее удобно при обмене элементов местами изменять только
-     * значения в узлах, а цвет оставлять прежним, чтобы не нарушать структуру
-     * дерева и не изменять чёрную высоту. Обычно это быстро, т.к. происходит
-     * обмен только одного поля (значения), даже для сложных классов (если класс
-     * поддерживает move). И это проще реализовать, т.к. не надо делать
-     * фактический обмен узлов с перепривязкой всех указателей на узлы. Однако в
-     * этом случае мы фактический удаляем другой узел, хоть и содержащую нужное
-     * значение. Соответственно в этом случае мы не можем гарантировать, что
-     * указатели/итераторы на другие узлы дерева останутся валидными. Т.к.
-     * оригинальная реализация дерева в STL требует от нас сохранять указатели и
-     * итераторы валидными (References and iterators to the erased elements are
-     * invalidated. Other references and iterators are not affected.), то мы
-     * будем наоборот обменивать узлы целиком, оставляя значение на старом
-     * месте.
-     *
-     * После обмена нужно удалить узел из его нового места. Это будет либо
-     * самый правый элемент в левой ветке (максимальный слева), либо самый левый
-     * в правой (минимальный справа) (см ниже пояснение с *), в любом случае у
-     * него не будет одного дочернего узла слева или справа.
-     *
-     * Таким образом, задача удаления узла с 2 детьми сводится к задаче удаления
-     * элемента с 1 или 0 детьми.
-     *
-     * *) При поиске ближайшего элемента в идеале необходимо просматривать и
-     * левое и правое поддеревья, чтобы выбрать ближайшее значение к удаляемому.
-     * Но мы будем всегда искать справа (если правое поддерево есть, конечно),
-     * т.к. это проще и не оказывает существенного влияния на работу дерева.
-     *
-     * 2) Ч2 — чёрный узел с двумя детьми.
-     * Аналогично предыдущему случаю К2, задача удаления узла с 2 детьми
-     * сводится к задаче удаления элемента с 1 или 0 детьми.
-     *
-     * 3) К1 — красный узел с одним ребёнком.
-     * Если у красного узла одного ребёнка нет, значит, вместо него находится
-     * чёрный NIL-элемент и чёрная высота красного узла равна 1. Следовательно,
-     * с другой стороны чёрная высота также должны быть равна 1. Но так как у
-     * красного узла дочерний элемент не может быть красного цвета, то другой
-     * его ребёнок должен быть чёрного цвета. Так как чёрная высота должна быть
-     * равна 1, то это может быть только чёрный NIL-элемент, так как в случае
-     * обычного чёрного элемента высота будет выше.
-     *
-     * Таким образом, К1 случай не имеет места быть.
-     *
-     * 4) Ч1 — чёрный узел с одним ребёнком.
-     * Если у чёрного элемента нет одного ребёнка, значит, вместо него находится
-     * чёрный NIL-элемент с чёрной высотой 1. Следовательно, с другой стороны
-     * должен быть красный узел без детей. Для удаления такого элемента обменять
-     * значения красного и чёрного узлов и удалить красный узел (аналогично
-     * случаю К2 вместо обмена значений мы будем делать обмен узлов), чёрная
-     * высота при этом сохранится.
-     *
-     * Таким образом, К1 сводится к задаче удаления красного узла без детей (К0)
-     *
-     * 5) К0 — красный узел без детей.
-     * Просто удаляем элемент, чёрная высота при этом сохранится.
+     * @brief Приватный метод для копирования дерева other в this.
      *
-     * 6) Ч0 — чёрный узел без детей. Просто удаляем узел, но при этом чёрная
-     * высота изменится. Соответственно необходимо запустить перебалансировку.
+     * @todo В части кейсов копирование осуществляется медленнее, чем в std.
+     * Связано это с тем, что наша версия Clear() медленнее оригинала, само
+     * копирование сопоставимо по скорости.
+     * @param other Копируемое дерево
+     */
+    void CopyTreeFromOther(const tree_type &other) {
+        tree_node *other_copy_root = CopyTree(other.Root(), nullptr);
+        // Важно, что мы сначала создаем полную копию, а только потом вызываем
+        // очистку текущего дерева. Это необходимо для того, чтобы текущее
+        // дерево не было уничтожено, если при копировании вылетит исключение
+        // (см. тесты "CopyLeaks").
+        Clear();
+        Root() = other_copy_root;
+        Root()->parent_ = head_;
+        MostLeft() = tree_algorithms::SearchMinimum(Root());
+        MostRight() = tree_algorithms::SearchMaximum(Root());
+        size_ = other.size_;
+        cmp_ = other.cmp_;
+    }
+
+    /**
+     * @brief Приватный метод для рекурсивного создания копий узлов и связей
+     * между ними
      *
+     * @param node копируемый узел.
+     * @param parent копия родителя копируемого узла.
+     * @return tree_node* указатель на созданную копию узла.
+     */
+    [[nodiscard]] tree_node *CopyTree(const tree_node *node,
+                                      tree_node *parent) {
+        // Если вылетит исключение при создании самого первого узла, то ничего
+        // страшного, ничего создано не будет
+        tree_node *copy = new tree_node{node->key_, node->color_};
+        // А вот все рекурсивные вызовы оборачиваем в try/catch, чтобы в случае
+        // возникновения исключения удалить все уже скопированные узлы (иначе
+        // будет утечка)
+        try {
+            if (node->left_) {
+                copy->left_ = CopyTree(node->left_, copy);
+            }
+
+            if (node->right_) {
+                copy->right_ = CopyTree(node->right_, copy);
+            }
+        } catch (...) {
+            Destroy(copy);
+            throw;
+        }
+
+        copy->parent_ = parent;
+        return copy;
+    }
+
+    // Какие элементы попадают в результат слияния двух отсортированных
+    // последовательностей в MergeSorted()
+    enum MergeMode {
+        kMergeUnion,
+        kMergeIntersection,
+        kMergeDifference
+    };
+
+    // Минимальное количество элементов, которое имеет смысл обрабатывать в
+    // отдельной задаче пула потоков
+    static constexpr size_type kParallelGrain = 16384;
+
+    /**
+     * @brief Выполняет function(begin, end) для диапазона [0, count) -
+     * параллельно, если передан пул потоков, иначе в текущем потоке
+     */
+    template <typename Function>
+    static void ForEachRange(ThreadPool *pool, size_type count,
+                             const Function &function) {
+        if (pool == nullptr) {
+            function(0, count);
+        } else {
+            ParallelFor(*pool, 0, count, kParallelGrain, function);
+        }
+    }
+
+    /**
+     * @brief Выписывает узлы дерева в порядке обхода (по возрастанию)
      *
-     * P.S. Можно посмотреть картинки, примеры и почитать дополнительные
-     * описания тут: https://habr.com/ru/company/otus/blog/521034/
+     * @return std::vector<tree_node *>
+     */
+    std::vector<tree_node *> CollectNodes() {
+        std::vector<tree_node *> nodes;
+        nodes.reserve(size_);
+        for (iterator it = Begin(), it_end = End(); it != it_end; ++it) {
+            nodes.push_back(it.node_);
+        }
+        return nodes;
+    }
+
+    /**
+     * @brief Версия CollectNodes() для const-объектов
      *
-     * @param pos Итератор, указывающий на извлекаемый узел.
-     * @return tree_node* Извлеченный узел дерева.
+     * @return std::vector<const tree_node *>
      */
-    tree_node *ExtractNode(iterator pos) noexcept {
-        if (pos == End()) {
-            // Запрещаем удалять служебный узел (head_), чтобы сохранить
-            // консистентность нашего класса.
-            return nullptr;
+    std::vector<const tree_node *> CollectNodes() const {
+        std::vector<const tree_node *> nodes;
+        nodes.reserve(size_);
+        for (const_iterator it = Begin(), it_end = End(); it != it_end; ++it) {
+            nodes.push_back(it.node_);
         }
+        return nodes;
+    }
 
-        tree_node *deleted_node = pos.node_;
+    /**
+     * @brief Устойчиво сортирует указатели на элементы по значению элементов.
+     * @details Параллельная версия сортирует части массива в отдельных
+     * задачах, а затем попарно сливает соседние отсортированные части, пока не
+     * останется одна.
+     *
+     * @param order Сортируемые указатели
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     */
+    void SortPointers(std::vector<key_type *> &order, ThreadPool *pool) const {
+        auto less = [this](const key_type *lhs, const key_type *rhs) {
+            return cmp_(*lhs, *rhs);
+        };
 
-        // Обработка К2 и Ч2
-        if (deleted_node->left_ != nullptr && deleted_node->right_ != nullptr) {
-            // Находим самый левый узел в правой ветке (минимальный справа)
-            tree_node *replace = SearchMinimum(deleted_node->right_);
-            // Обмениваем местами удаляемый узел и найденный узел
-            SwapNodesForErase(deleted_node, replace);
+        size_type parts =
+            pool == nullptr ? 1
+                            : std::min(pool->Size(),
+                                       order.size() / kParallelGrain + 1);
+        if (parts <= 1) {
+            std::stable_sort(order.begin(), order.end(), less);
+            return;
         }
 
-        // Обработка К1 — не требуется, т.к. такой случай невозможен
+        std::vector<size_type> bounds(parts + 1);
+        for (size_type part = 0; part <= parts; ++part) {
+            bounds[part] = order.size() * part / parts;
+        }
 
-        // Обработка Ч1
-        if (deleted_node->color_ == kBlack &&
-            ((deleted_node->left_ == nullptr &&
-              deleted_node->right_ != nullptr) ||
-             (deleted_node->left_ != nullptr &&
-              deleted_node->right_ == nullptr))) {
-            // Находим красный узел без детей (К0) для обмена значений с ним
-            tree_node *replace;
-            if (deleted_node->left_ != nullptr) {
-                replace = deleted_node->left_;
-            } else {
-                replace = deleted_node->right_;
+        ParallelFor(*pool, 0, parts, 1, [&](size_type begin, size_type end) {
+            for (size_type part = begin; part < end; ++part) {
+                std::stable_sort(order.begin() + bounds[part],
+                                 order.begin() + bounds[part + 1], less);
             }
-            // Обмениваем местами удаляемый узел и найденный узел
-            SwapNodesForErase(deleted_node, replace);
+        });
+
+        // Попарно сливаем соседние части: [0,1], [2,3], ... затем [0-1, 2-3]
+        // и т.д. Каждое слияние одного уровня выполняется отдельной задачей
+        for (size_type step = 1; step < parts; step *= 2) {
+            TaskGroup group(*pool);
+            for (size_type part = 0; part + step < parts; part += 2 * step) {
+                size_type first = bounds[part];
+                size_type middle = bounds[part + step];
+                size_type last = bounds[std::min(part + 2 * step, parts)];
+                group.Run([&order, &less, first, middle, last] {
+                    std::inplace_merge(order.begin() + first,
+                                       order.begin() + middle,
+                                       order.begin() + last, less);
+                });
+            }
+            group.Wait();
         }
+    }
 
-        // Обработка К0
-        // Дополнительных действий не требуется узел будет просто удален в конце
-        // функции. При таком случае все необходимые переменные для удаления уже
-        // заполнены корректно
-
-        // Обработка Ч0
-        // Самый сложный и интересный случай, нам необходимо перед удалением
-        // перебаласировать дерево таким образом, чтобы черная высота не
-        // нарушилась после удаления узла
-        if (deleted_node->color_ == kBlack && deleted_node->left_ == nullptr &&
-            deleted_node->right_ == nullptr) {
-            EraseBalancing(deleted_node);
+    /**
+     * @brief Создает count новых узлов, i-й узел конструируется из source(i).
+     * @details Если при создании какого-то узла вылетит исключение, то все уже
+     * созданные узлы удаляются, а исключение пробрасывается дальше.
+     *
+     * @param count Количество узлов
+     * @param source Функция, возвращающая значение для i-го узла
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     * @return std::vector<tree_node *> Созданные узлы
+     */
+    template <typename Source>
+    static std::vector<tree_node *> CreateNodes(size_type count,
+                                                const Source &source,
+                                                ThreadPool *pool) {
+        std::vector<tree_node *> nodes(count, nullptr);
+        try {
+            ForEachRange(pool, count, [&](size_type begin, size_type end) {
+                for (size_type i = begin; i < end; ++i) {
+                    nodes[i] = new tree_node(source(i));
+                }
+            });
+        } catch (...) {
+            for (tree_node *node : nodes) {
+                delete node;
+            }
+            throw;
         }
+        return nodes;
+    }
 
-        // Теперь собственно изымаем из дерева узел, который мы удаляем.
-        if (deleted_node == Root()) {
-            // Отдельно обрабатываем случай, когда удаляем корень дерева
-            // Удаление именно корня возможно только в том случае, если он
-            // единственный элемент дерева (в остальных случаях мы сведем задачу
-            // к удалению другого узла). Поэтому в даном случае приводим
-            // состояние служебного узла head_ в соответствие с изначальными
-            // данными для пустого дерева.
-            InitializeHead();
-        } else {
-            // В остальных случаях отцепляем ссылки родителя на нашу удаляемый
-            // узел
-            if (deleted_node == deleted_node->parent_->left_) {
-                deleted_node->parent_->left_ = nullptr;
+    /**
+     * @brief Сливает две отсортированные последовательности узлов a и b.
+     *
+     * @details В зависимости от mode в result попадают:
+     * kMergeUnion - все узлы a и узлы b, ключей которых нет в a (узлы b с
+     * такими ключами попадают в rest, если он передан);
+     * kMergeIntersection - узлы a, ключи которых есть в b;
+     * kMergeDifference - узлы a, ключей которых нет в b.
+     *
+     * Для параллельного слияния a делится на равные части, а границы
+     * соответствующих частей b находятся бинарным поиском (lower_bound по
+     * первому элементу части a). Так элементы с равными ключами всегда
+     * попадают в одну и ту же часть, и части можно сливать независимо.
+     *
+     * @param a Первая последовательность
+     * @param b Вторая последовательность
+     * @param mode Режим слияния
+     * @param result Результат слияния
+     * @param rest Узлы b, не попавшие в результат объединения, или nullptr
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     */
+    template <typename NodePointer>
+    void MergeSorted(const std::vector<NodePointer> &a,
+                     const std::vector<NodePointer> &b, MergeMode mode,
+                     std::vector<NodePointer> &result,
+                     std::vector<NodePointer> *rest, ThreadPool *pool) const {
+        auto less = [this](NodePointer lhs, NodePointer rhs) {
+            return cmp_(lhs->key_, rhs->key_);
+        };
+
+        size_type parts =
+            pool == nullptr
+                ? 1
+                : std::max<size_type>(
+                      std::min(pool->Size(),
+                               (a.size() + b.size()) / kParallelGrain),
+                      1);
+        parts = std::min(parts, std::max<size_type>(a.size(), 1));
+
+        std::vector<size_type> a_bounds(parts + 1);
+        std::vector<size_type> b_bounds(parts + 1);
+        for (size_type part = 0; part <= parts; ++part) {
+            a_bounds[part] = a.size() * part / parts;
+            if (part == 0) {
+                b_bounds[part] = 0;
+            } else if (part == parts) {
+                b_bounds[part] = b.size();
             } else {
-                deleted_node->parent_->right_ = nullptr;
+                b_bounds[part] =
+                    std::lower_bound(b.begin(), b.end(), a[a_bounds[part]],
+                                     less) -
+                    b.begin();
             }
+        }
 
-            // Ищем новый минимум для служебного узла, если мы удаляем старый
-            // минимум
-            if (MostLeft() == deleted_node) {
-                MostLeft() = SearchMinimum(Root());
+        std::vector<std::vector<NodePointer>> part_results(parts);
+        std::vector<std::vector<NodePointer>> part_rests(parts);
+        auto merge_part = [&](size_type part) {
+            auto a_it = a.begin() + a_bounds[part];
+            auto a_end = a.begin() + a_bounds[part + 1];
+            auto b_it = b.begin() + b_bounds[part];
+            auto b_end = b.begin() + b_bounds[part + 1];
+            std::vector<NodePointer> &out = part_results[part];
+            std::vector<NodePointer> &out_rest = part_rests[part];
+
+            while (a_it != a_end && b_it != b_end) {
+                if (less(*a_it, *b_it)) {
+                    if (mode != kMergeIntersection) {
+                        out.push_back(*a_it);
+                    }
+                    ++a_it;
+                } else if (less(*b_it, *a_it)) {
+                    if (mode == kMergeUnion) {
+                        out.push_back(*b_it);
+                    }
+                    ++b_it;
+                } else {
+                    // Ключи равны - всегда оставляем элемент из a
+                    if (mode != kMergeDifference) {
+                        out.push_back(*a_it);
+                    }
+                    if (mode == kMergeUnion && rest != nullptr) {
+                        out_rest.push_back(*b_it);
+                    }
+                    ++a_it;
+                    ++b_it;
+                }
             }
 
-            // Ищем новый максимум для служебного узла, если мы удаляем старый
-            // максимум
-            if (MostRight() == deleted_node) {
-                MostRight() = SearchMaximum(Root());
+            if (mode != kMergeIntersection) {
+                out.insert(out.end(), a_it, a_end);
             }
-        }
-        // И уменьшаем количество элементов дерева, т.к. мы изъяли из него один
-        // узел
-        --size_;
+            if (mode == kMergeUnion) {
+                out.insert(out.end(), b_it, b_end);
+            }
+        };
 
-        // Приводим узел к виду по умолчанию
-        deleted_node->ToDefault();
+        if (parts == 1) {
+            merge_part(0);
+        } else {
+            ParallelFor(*pool, 0, parts, 1,
+                        [&](size_type begin, size_type end) {
+                            for (size_type part = begin; part < end; ++part) {
+                                merge_part(part);
+                            }
+                        });
+        }
+
+        result.clear();
+        for (auto &part_result : part_results) {
+            result.insert(result.end(), part_result.begin(),
+                          part_result.end());
+        }
+        if (rest != nullptr) {
+            rest->clear();
+            for (auto &part_rest : part_rests) {
+                rest->insert(rest->end(), part_rest.begin(), part_rest.end());
+            }
+        }
+    }
 
-        return deleted_node;
+    /**
+     * @brief Общая часть Union(), Intersection() и Difference(): сливает узлы
+     * this и other в режиме mode и строит новое дерево из копий выбранных
+     * элементов.
+     */
+    tree_type CombineWith(const tree_type &other, MergeMode mode,
+                          ThreadPool *pool) const {
+        std::vector<const tree_node *> selected;
+        MergeSorted<const tree_node *>(CollectNodes(), other.CollectNodes(),
+                                       mode, selected, nullptr, pool);
+
+        std::vector<tree_node *> nodes = CreateNodes(
+            selected.size(),
+            [&selected](size_type i) -> const key_type & {
+                return selected[i]->key_;
+            },
+            pool);
+
+        tree_type result;
+        result.cmp_ = cmp_;
+        result.LinkSortedNodes(nodes, pool);
+        return result;
     }
 
     /**
-     * @brief Меняет местами узлы node и other с целью последующего удаления
-     * узла node - это важный момент, т.е. это не универсальный свап узлов, а
-     * только частный случай (универсальный более сложен, но нам не нужны эти
-     * лишние действия)
-     *
-     * Необходимость обмена именно узлов, а не их значений описана в функции
-     * ExtractNode()
-     *
-     * @param node
-     * @param other
+     * @brief Связывает отсортированные узлы nodes в сбалансированное
+     * красно-чёрное дерево и делает его содержимым this.
+     * @details Узлы, которые до этого принадлежали this, должны быть либо
+     * удалены, либо присутствовать в nodes - метод только перепривязывает
+     * указатели и не освобождает память.
+     *
+     * @param nodes Узлы в порядке возрастания ключей
+     * @param pool Пул потоков или nullptr для последовательного выполнения
      */
-    void SwapNodesForErase(tree_node *node, tree_node *other) noexcept {
-        // Меняем ссылку на узел other у родителя other
-        if (other->parent_->left_ == other) {
-            other->parent_->left_ = node;
-        } else {
-            other->parent_->right_ = node;
+    void LinkSortedNodes(std::vector<tree_node *> &nodes,
+                         ThreadPool *pool) noexcept {
+        InitializeHead();
+        size_ = nodes.size();
+        if (nodes.empty()) {
+            return;
         }
 
-        if (node == Root()) {
-            // Если node является корнем дерева, то меняем ссылку на новый
-            // корень
-            Root() = other;
-        } else {
-            // Если node не является корнем, то меняем ссылку на узел node у
-            // родителя node
-            if (node->parent_->left_ == node) {
-                node->parent_->left_ = other;
-            } else {
-                node->parent_->right_ = other;
-            }
+        // Глубина самого нижнего уровня дерева, строящегося делением пополам
+        size_type red_depth = 0;
+        while ((size_type{2} << red_depth) <= nodes.size()) {
+            ++red_depth;
         }
 
-        // Свапаем всё, кроме key_, т.к. ключи должны остаться на своем месте в
-        // дереве, а все остальное должно обменяться (см. описание алгоритма
-        // удаления)
-        std::swap(node->parent_, other->parent_);
-        std::swap(node->left_, other->left_);
-        std::swap(node->right_, other->right_);
-        std::swap(node->color_, other->color_);
-
-        // Меняем родителей у потомков свапаемых узлов
-
-        if (node->left_) {
-            // При текущем алгоритме удаления у нас не может быть left_
-            // заполнен, но в универсальном варианте надо проверять
-            node->left_->parent_ = node;
-        }
+        Root() = LinkBalanced(nodes.data(), nodes.size(), head_, 0, red_depth,
+                              pool);
+        Root()->color_ = kBlack;
+        MostLeft() = nodes.front();
+        MostRight() = nodes.back();
+    }
 
-        if (node->right_) {
-            node->right_->parent_ = node;
+    /**
+     * @brief Рекурсивно строит сбалансированное поддерево из count
+     * отсортированных узлов: средний узел становится корнем, левая и правая
+     * половины - его поддеревьями.
+     *
+     * @details При делении пополам все уровни дерева, кроме самого нижнего
+     * (red_depth), заполнены полностью, а пустые потомки (NIL-элементы)
+     * находятся только на глубине red_depth или red_depth + 1. Поэтому если
+     * покрасить узлы нижнего уровня в красный, а все остальные в чёрный, то
+     * любой путь от корня до NIL-элемента содержит ровно red_depth чёрных
+     * узлов, а у красных узлов нет детей - все правила красно-чёрного дерева
+     * соблюдены без какой-либо балансировки.
+     *
+     * Поддеревья большого размера связываются в отдельных задачах пула.
+     *
+     * @param nodes Первый узел поддерева
+     * @param count Количество узлов поддерева
+     * @param parent Родитель корня поддерева
+     * @param depth Глубина корня поддерева
+     * @param red_depth Глубина самого нижнего уровня всего дерева
+     * @param pool Пул потоков или nullptr для последовательного выполнения
+     * @return tree_node* Корень поддерева
+     */
+    static tree_node *LinkBalanced(tree_node **nodes, size_type count,
+                                   tree_node *parent, size_type depth,
+                                   size_type red_depth,
+                                   ThreadPool *pool) noexcept {
+        if (count == 0) {
+            return nullptr;
         }
 
-        if (other->left_) {
-            other->left_->parent_ = other;
+        size_type middle = count / 2;
+        tree_node *node = nodes[middle];
+        node->parent_ = parent;
+        node->color_ = depth == red_depth ? kRed : kBlack;
+
+        if (pool != nullptr && count > kParallelGrain) {
+            TaskGroup group(*pool);
+            bool forked = true;
+            try {
+                group.Run([=] {
+                    node->left_ = LinkBalanced(nodes, middle, node, depth + 1,
+                                               red_depth, pool);
+                });
+            } catch (...) {
+                // Задачу не удалось поставить в очередь (std::bad_alloc) -
+                // тогда связываем левую половину в текущем потоке
+                forked = false;
+            }
+            node->right_ = LinkBalanced(nodes + middle + 1, count - middle - 1,
+                                        node, depth + 1, red_depth, pool);
+            if (!forked) {
+                node->left_ = LinkBalanced(nodes, middle, node, depth + 1,
+                                           red_depth, pool);
+            }
+            // Задачи связывания не бросают исключений, поэтому Wait() тоже
+            group.Wait();
+        } else {
+            node->left_ = LinkBalanced(nodes, middle, node, depth + 1,
+                                       red_depth, pool);
+            node->right_ = LinkBalanced(nodes + middle + 1, count - middle - 1,
+                                        node, depth + 1, red_depth, pool);
         }
 
-        if (other->right_) {
-            other->right_->parent_ = other;
-        }
+        return node;
     }
 
     /**
-     * @brief Функция для перебалансировки дерева перед удалением узла
-     * deleted_node, чтобы черная высота не нарушилась после удаления узла.
-     *
-     * @details Перебалансировка выполняется в том случае, если удаляется черный
-     * узел без детей, т.к. в этом случае гарантированно нарушается свойство 5
-     * красно-чёрного дерева (свойства описаны в начале файла).
-     *
-     * При перебалансировке возможны 8 различных случаев:
-     * 1) 4 случая, если удаляемый элемент находится слева от родителя (левый
-     * сын).
-     * 2) 4 случая, если удаляемый элемент находится справа от родителя
-     * (правый сын).
-     *
-     * Мы рассмотрим только 4 случая для левого сына. Вторые 4 случая (для
-     * правого сына) зеркально отражают первые четыре случая (это очень наглядно
-     * будет видно по коду).
-     *
-     * Терминология далее:
-     * check_node - элемент, для которого мы хотим восстановить высоту (на
-     * первой итерации является удаляемым элементом) parent - Родитель
-     * check_node sibling - Брат или сестра check_node (второй ребенок parent)
-     *
-     * Возможные случаи для для левого сына:
-     * 6.1) sibling красного цвета.
-     *
-     * В этом случае мы меняем местами цвета sibling и parent, а затем выполняем
-     * поворот налево через parent (при этом изменятся parent и sibling в
-     * текущей итерации алгоритма). Это сводит случай 6.1 к случаям 6.2, 6.3
-     * или 6.4.
-     *
-     * 6.2) sibling черного цвета и оба ребенка sibling черного цвета.
-     *
-     * В этом случае мы меняем цвет sibling на красный.
-     * Если цвет parent красный, то мы меняем его цвет на черный и останавливаем
-     * балансировку (дерево будет сбалансировано).
-     * Если цвет parent черный, мы устанавливаем check_node равной parent и
-     * переходим к следующей итерации балансировки (т.е. начинаем проверять
-     * случаи для нового check_node, начиная с 6.1). Это обусловлено тем, что в
-     * данном случае мы изменили цвет sibling на красный - в результате чёрная
-     * высота всей нашей структуры уменьшилась на 1 и мы должны рекурсивно
-     * вызывать балансировку для parent.
-     *
-     * 6.3) sibling черного цвета, левый ребенок sibling красный, правый ребенок
-     * sibling черный.
+     * @brief Рекурсивно удаляет все узлы дерева и освобождает память, кроме
+     * служебного узла head.
      *
-     * В этом случае мы меняем местами цвета sibling и левого ребенка sibling, а
-     * затем выполняем поворот направо через sibling (при этом изменится sibling
-     * в текущей итерации алгоритма). Это сводит случай 6.3 к случаю 6.4.
+     * @todo map - 199054 элементов: std: 38.626 ms; s21: 65.842 ms;
+     * Отказаться от двойной рекурсии? Или это из-за неудачного механизма
+     * компаратора? set/multiset показывают лучшие результаты, чем map
+     * @param node
+     */
+    void Destroy(tree_node *node) noexcept {
+        if (node == nullptr)
+            return;
+        Destroy(node->left_);
+        Destroy(node->right_);
+        delete node;
+    }
+
+    /**
+     * @brief Приватный метод, который выставляет значения служебного узла head
+     * в значения, необходимые для пустого дерева
+     */
+    void InitializeHead() noexcept {
+        tree_algorithms::InitializeHead(head_);
+    }
+
+    /**
+     * @brief Возвращает ссылку на корень дерева
      *
-     * 6.4) sibling черного цвета, правый ребенок sibling красный.
+     * @return tree_node*&
+     */
+    tree_node *&Root() {
+        return head_->parent_;
+    }
+
+    /**
+     * @brief Возвращает ссылку на корень дерева для const-объектов
      *
-     * В этом случае мы меняем цвет правого ребенка sibling на черный, меняем
-     * цвет sibling на цвет parent, меняем цвет parent на черный, а затем
-     * выполняем поворот налево через sibling. После этого дерево будет
-     * сбалансировано, останавливаем балансировку
+     * @return const tree_node*
+     */
+    const tree_node *Root() const {
+        return head_->parent_;
+    }
+
+    /**
+     * @brief Возвращает ссылку на самый маленький (самый левый) элемент дерева
      *
-     * P.S. Можно посмотреть картинки, примеры и почитать дополнительные
-     * описания тут:
-     * https://algorithmtutor.com/Data-Structures/Tree/Red-Black-Trees/
+     * @return tree_node*&
+     */
+    tree_node *&MostLeft() {
+        return head_->left_;
+    }
+
+    /**
+     * @brief Возвращает ссылку на самый маленький (самый левый) элемент дерева
+     * для const-объектов
      *
-     * @param deleted_node Удаляемый узел
+     * @return tree_node*&
      */
-    void EraseBalancing(tree_node *deleted_node) noexcept {
-        tree_node *check_node = deleted_node;
-        tree_node *parent = deleted_node->parent_;
+    const tree_node *MostLeft() const {
+        return head_->left_;
+    }
 
-        // Проверку осуществляем в цикле, пока проверяемый узел черный
-        // (необходимость зацикливания указана в описании случая 6.2)). Ну или
-        // пока дерево не кончится
-        while (check_node != Root() && check_node->color_ == kBlack) {
-            if (check_node == parent->left_) {
-                // Удаляемый элемент находится слева от родителя
-                tree_node *sibling = parent->right_;
+    /**
+     * @brief Возвращает ссылку на самый большой (самый правый) элемент дерева
+     * @details Версию для const-объектов не реализуем, т.к. в наших функциях
+     * эта версия просто негде вызывать
+     *
+     * @return tree_node*&
+     */
+    tree_node *&MostRight() {
+        return head_->right_;
+    }
 
-                // Случай 6.1
-                if (sibling->color_ == kRed) {
-                    std::swap(sibling->color_, parent->color_);
-                    RotateLeft(parent);
-                    parent = check_node->parent_;
-                    sibling = parent->right_;
-                }
+    /**
+     * @brief Встраивает узел new_node в дерево ниже узла root.
+     * @details Алгоритм стандартен для любого бинарного дерева: если
+     * вставляемый узел меньше текущего, то ищем место для вставки в левой ветви
+     * дерева, если больше (или равен), то ищем место для вставки в правой ветви
+     * дерева, пока не дойдем до пустого узла (nullptr) - в это место и
+     * вставляем.
+     *
+     * Если вставка повторяющихся элементов запрещена (см. параметр
+     * unique_only), то поиск останавливается, если нашли элемент с
+     * эквивалентным ключом.
+     *
+     * @param root Узел, от которого мы начинаем искать место, куда встроить
+     * новый узел
+     * @param new_node Встраиваемый узел
+     * @param unique_only Режим вставки:
+     * true - вставка только уникальных узлов, вставка осуществляется только,
+     * если контейнер ещё не содержит элемент с эквивалентным ключом. false -
+     * вставка любого узла, в т.ч., если контейнер уже содержит элемент с
+     * эквивалентным ключом.
+     * @todo Insert можно ускорить, если сделать разные версии для обычной
+     * вставки и unique, так сейсчас при обычной вставке мы делаем лишние
+     * проверки, которые можно и не делать
+     * @todo подозрительно быстро (особенно с оптимизацией) делается вставка
+     * 200000 одинаковых элементов в set
+     * @return std::pair<iterator, bool> - Пара, состоящая из итератора для
+     * вставленного элемента (или для элемента, который предотвратил вставку) и
+     * логического значения, установленного в true, если вставка произошла
+     * (false, если вставка не произошла
+     */
+    std::pair<iterator, bool> Insert(tree_node *root, tree_node *new_node,
+                                     bool unique_only) {
+        tree_node *node = root;
+        tree_node *parent = nullptr;
 
-                // Случай 6.2
-                if (sibling->color_ == kBlack &&
-                    (sibling->left_ == nullptr ||
-                     sibling->left_->color_ == kBlack) &&
-                    (sibling->right_ == nullptr ||
-                     sibling->right_->color_ == kBlack)) {
-                    sibling->color_ = kRed;
-                    if (parent->color_ == kRed) {
-                        parent->color_ = kBlack;
-                        // Балансировка завершена
-                        break;
-                    }
-                    // Идем балансировать parent
-                    check_node = parent;
-                    parent = check_node->parent_;
-                } else {
-                    if (sibling->left_ != nullptr &&
-                        sibling->left_->color_ == kRed &&
-                        (sibling->right_ == nullptr ||
-                         sibling->right_->color_ == kBlack)) {
-                        // Случай 6.3
-                        std::swap(sibling->color_, sibling->left_->color_);
-                        RotateRight(sibling);
-                        sibling = parent->right_;
-                    }
+        bool to_left = false;
 
-                    // Случай 6.4
-                    sibling->right_->color_ = kBlack;
-                    sibling->color_ = parent->color_;
-                    parent->color_ = kBlack;
-                    RotateLeft(parent);
-                    // Балансировка завершена
-                    break;
-                }
+        // Ищем место для вставки, пока не дойдем до пустого узла
+        while (node != nullptr) {
+            parent = node;
+            to_left = cmp_(new_node->key_, node->key_);
+            if (to_left) {
+                // Если new_node < node
+                node = node->left_;
             } else {
-                // Удаляемый элемент находится справа от родителя
-                tree_node *sibling = parent->left_;
-
-                // Случай 6.1
-                if (sibling->color_ == kRed) {
-                    std::swap(sibling->color_, parent->color_);
-                    RotateRight(parent);
-                    parent = check_node->parent_;
-                    sibling = parent->left_;
-                }
-
-                // Случай 6.2
-                if (sibling->color_ == kBlack &&
-                    (sibling->left_ == nullptr ||
-                     sibling->left_->color_ == kBlack) &&
-                    (sibling->right_ == nullptr ||
-                     sibling->right_->color_ == kBlack)) {
-                    sibling->color_ = kRed;
-                    if (parent->color_ == kRed) {
-                        parent->color_ = kBlack;
-                        // Балансировка завершена
-                        break;
-                    }
-                    // Идем балансировать parent
-                    check_node = parent;
-                    parent = check_node->parent_;
+                // Иначе (т.е. node >= new_node)
+                if (unique_only == false) {
+                    // Если вставка неуникальных элементов разрешена, то всегда
+                    // продолжаем искать дальше в правой ветви (т.к. нам не
+                    // важно, равно ли значение текущего узла вставляемому)
+                    node = node->right_;
                 } else {
-                    if (sibling->right_ != nullptr &&
-                        sibling->right_->color_ == kRed &&
-                        (sibling->left_ == nullptr ||
-                         sibling->left_->color_ == kBlack)) {
-                        // Случай 6.3
-                        std::swap(sibling->color_, sibling->right_->color_);
-                        RotateLeft(sibling);
-                        sibling = parent->left_;
+                    // Если вставка неуникальных элементов не разрешена, то
+                    // выясняем node > new_node или node == new_node
+                    if (cmp_(node->key_, new_node->key_)) {
+                        // Если node > new_node, то продолжаем поиски в правой
+                        // ветви
+                        node = node->right_;
+                    } else {
+                        // Если node == new_node то возвращаем результат о
+                        // невозможности вставки элемента
+                        return {iterator(node), false};
                     }
-                    // Случай 6.4
-                    sibling->left_->color_ = kBlack;
-                    sibling->color_ = parent->color_;
-                    parent->color_ = kBlack;
-                    RotateRight(parent);
-                    // Балансировка завершена
-                    break;
                 }
             }
         }
+
+        // После окончания цикла parent буден указывать на узел, потомком
+        // которого станет new_node. При этом parent может быть равен nullptr,
+        // если в дереве не окажется узлов (пустое дерево), если мы даже не
+        // зашли в цикл выше
+        LinkNode(parent, to_left, new_node);
+
+        return {iterator(new_node), true};
     }
 
     /**
-     * @brief Находит среди потомков node самый маленький (самый левый) элемент
-     * дерева и возвращает указатель на него.
+     * @brief Встраивает new_node в дерево потомком parent (слева, если
+     * to_left) и выполняет балансировку (см. RedBlackTreeAlgorithms::Link())
      *
-     * @param node
-     * @return tree_node*
+     * @param parent Будущий родитель нового узла или nullptr для пустого
+     * дерева
+     * @param to_left Новый узел становится левым потомком parent
+     * @param new_node Встраиваемый узел
      */
-    tree_node *SearchMinimum(tree_node *node) const noexcept {
-        while (node->left_ != nullptr) {
-            node = node->left_;
-        };
-        return node;
+    void LinkNode(tree_node *parent, bool to_left,
+                  tree_node *new_node) noexcept {
+        ++size_;
+        tree_algorithms::Link(head_, parent, to_left, new_node);
     }
 
     /**
-     * @brief Находит среди потомков node самый большой (самый правый) элемент
-     * дерева и возвращает указатель на него.
+     * @brief Изымает узел в позиции pos из дерева, при необходимости
+     * осуществляется ребалансировка дерева (алгоритм описан в
+     * RedBlackTreeAlgorithms::Extract()).
      *
-     * @param node
-     * @return tree_node*
+     * @param pos Итератор, указывающий на извлекаемый узел.
+     * @return tree_node* Извлеченный узел дерева (nullptr для End()).
      */
-    tree_node *SearchMaximum(tree_node *node) const noexcept {
-        while (node->right_ != nullptr) {
-            node = node->right_;
-        };
-        return node;
+    tree_node *ExtractNode(iterator pos) noexcept {
+        if (pos == End()) {
+            // Запрещаем удалять служебный узел (head_), чтобы сохранить
+            // консистентность нашего класса.
+            return nullptr;
+        }
+
+        tree_node *deleted_node = pos.node_;
+        tree_algorithms::Extract(head_, deleted_node);
+        // И уменьшаем количество элементов дерева, т.к. мы изъяли из него один
+        // узел
+        --size_;
+
+        // Приводим узел к виду по умолчанию
+        deleted_node->ToDefault();
+
+        return deleted_node;
     }
 
     /**
@@ -1619,6 +2447,18 @@ class RedBlackTree {
               key_(std::move(key)), color_(kRed) {
         }
 
+        /**
+         * @brief Конструктор, создающий значение узла прямо на месте из
+         * аргументов args (см. FindOrEmplace())
+         *
+         * @param args аргументы конструктора значения узла
+         */
+        template <typename... Args>
+        explicit RedBlackTreeNode(std::in_place_t, Args &&...args)
+            : parent_(nullptr), left_(nullptr), right_(nullptr),
+              key_(std::forward<Args>(args)...), color_(kRed) {
+        }
+
         /**
          * @brief Конструктор, создающий узел дерева, инициализированный
          * значением key и цветом color
@@ -1631,6 +2471,15 @@ class RedBlackTree {
               color_(color) {
         }
 
+        /**
+         * @brief Значение узла (используется дескриптором узла)
+         *
+         * @return key_type&
+         */
+        key_type &Value() noexcept {
+            return key_;
+        }
+
         /**
          * @brief Приводим узел к виду по умолчанию. Т.е. все указатели узла
          * делаем nullptr, а цвет красным. Именно в таком виде вставляются новые
@@ -1644,103 +2493,22 @@ class RedBlackTree {
         }
 
         /**
-         * @brief Возвращает следующий относительно this узел дерева.
-         * @details Реализация описана по ходу функции. В реализации учитывается
-         * наличие служебного узла (головы), через которую реализуется
-         * зацикливание при обходе элементов.
+         * @brief Возвращает следующий относительно this узел дерева (см.
+         * RedBlackTreeAlgorithms::NextNode()).
          *
          * @return tree_node*
          */
         tree_node *NextNode() const noexcept {
-            // Мы не меняем текущий узел в этой функции, поэтому со спокойной
-            // совестью делаем const_cast
-            tree_node *node = const_cast<tree_node *>(this);
-            if (node->color_ == kRed &&
-                (node->parent_ == nullptr || node->parent_->parent_ == node)) {
-                // Если мы находимся в End(), то сдвигаем итератор в left, чтобы
-                // оказаться на самом маленьком элементе дерева (указатель на
-                // который и хранится в left в End()) Критерии, что текущий узел
-                // является End(): 1) Цвет текущего узла красный (Т.к. корень
-                // всегда черный, а End() всегда красный). AND 2) Родитель
-                // текущего узла равен nullptr - только у End() parent может
-                // быть nullptr для пустого дерева (и это надо проверять, чтобы
-                // не словить segmentation fault для пустого дерева). OR 3)
-                // Родитель родителя текущего узла равен текущему узлу. Это
-                // выполняется и для корня дерева и для End(), поэтому нужно еще
-                // первое условие с проверкой цвета.
-                node = node->left_;
-            } else if (node->right_ != nullptr) {
-                // Если мы находимся не в End() и правая ветвь непустая, то в
-                // первую очередь идем в неё, т.к. ближайший больший элемента
-                // будет именно в правой ветви
-                node = node->right_;
-
-                // Далее сдвигаемся полностью влево (while left_ != nullptr), до
-                // самого маленького элемента в левых ветвях, он и будет самым
-                // маленьким следующим элементом. Если левых ветвей вообще не
-                // будет, то самым маленьким останется правая ветвь, в которую
-                // мы зашли в начале блока
-                while (node->left_ != nullptr) {
-                    node = node->left_;
-                }
-            } else {
-                // В остальных случаях сдвигаемся к родительскому элементу до
-                // тех пор, пока правая ветвь родителя будет содержать узел,
-                // отличный от текущего
-                tree_node *parent = node->parent_;
-
-                while (node == parent->right_) {
-                    node = parent;
-                    parent = parent->parent_;
-                }
-                // Если в дереве у корня нет правого элемента, то при инкременте
-                // мы будем каждый раз попадать на него: Указатель находится  на
-                // корне. Т.к. right пустой, то идем в parent (который является
-                // служебным узлом End(). У parent-right указывает на самый
-                // большой элемент дерева, т.е. на нашу единственный узел,
-                // поэтому мы опять поднимаемся в parent, который указывает на
-                // нашу единственный узел (parent у End() указывает на корень
-                // дерева). Чтобы этого не происходило, добавляем проверку
-                // node->right_ != parent, т.е. находясь в End(), мы не будем
-                // уходить в parent
-                if (node->right_ != parent) {
-                    node = parent;
-                }
-            }
-
-            return node;
+            return tree_algorithms::NextNode(this);
         }
 
         /**
          * @brief Возвращает предыдущий относительно this узел дерева.
-         * @details Работает идентично NextNode, только двигаемся в обратную
-         * сторону, поэтому всё наоборот.
          *
          * @return tree_node*
          */
         tree_node *PrevNode() const noexcept {
-            tree_node *node = const_cast<tree_node *>(this);
-
-            if (node->color_ == kRed &&
-                (node->parent_ == nullptr || node->parent_->parent_ == node)) {
-                node = node->right_;
-            } else if (node->left_ != nullptr) {
-                node = node->left_;
-                while (node->right_ != nullptr) {
-                    node = node->right_;
-                }
-            } else {
-                tree_node *parent = node->parent_;
-                while (node == parent->left_) {
-                    node = parent;
-                    parent = parent->parent_;
-                }
-                if (node->left_ != parent) {
-                    node = parent;
-                }
-            }
-
-            return node;
+            return tree_algorithms::PrevNode(this);
         }
         // Указатель на родителя узла дерева
         tree_node *parent_;
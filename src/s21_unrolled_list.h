@@ -0,0 +1,746 @@
+/**
+ * @file s21_unrolled_list.h
+ * @brief s21::unrolled_list (развернутый список) - двусвязный список блоков,
+ * каждый из которых хранит несколько подряд идущих элементов.
+ *
+ * @details Узел s21::list хранит одно значение и два указателя, поэтому для
+ * s21::list<int> на каждый элемент приходится отдельное выделение памяти и
+ * отдельная кэш-линия при обходе, а служебные данные в несколько раз больше
+ * самих данных. В развернутом списке элементы лежат в блоках размером около
+ * ChunkBytes байт: обход идет по непрерывной памяти, а указатели и счетчик
+ * расходуются на блок, а не на элемент.
+ *
+ * Вставка и удаление по итератору выполняются за O(chunk_capacity), т.е. за
+ * константу, не зависящую от размера списка: элементы сдвигаются только внутри
+ * одного блока. Переполненный блок делится пополам, почти пустой блок
+ * сливается с соседним.
+ *
+ * В отличие от s21::list, вставка и удаление делают недействительными
+ * итераторы и ссылки на элементы затронутого блока (и соседнего, если блоки
+ * делятся или сливаются). Итераторы на элементы других блоков остаются
+ * действительными.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+/**
+ * @brief Развернутый список
+ *
+ * @tparam Type Тип элемента
+ * @tparam ChunkBytes Желаемый размер блока в байтах (вместе со служебными
+ * полями). В блок помещается не меньше двух элементов
+ */
+template <typename Type, std::size_t ChunkBytes = 256>
+class unrolled_list {
+  private:
+    struct ChunkBase;
+    struct Chunk;
+    struct UnrolledListIterator;
+    struct UnrolledListIteratorConst;
+
+  public:
+    // Тип элемента (Type — параметр шаблона)
+    using value_type = Type;
+    // Тип ссылки на элемент
+    using reference = Type &;
+    // Тип константной ссылки на элемент
+    using const_reference = const Type &;
+    // Внутренний класс для итератора
+    using iterator = UnrolledListIterator;
+    // Внутренний класс для константного итератора
+    using const_iterator = UnrolledListIteratorConst;
+    // Тип для размера контейнера
+    using size_type = std::size_t;
+
+  private:
+    // Служебная часть блока: ссылки на соседей и количество элементов
+    struct ChunkBase {
+        ChunkBase *next_ = this;
+        ChunkBase *prev_ = this;
+        size_type count_ = 0;
+    };
+
+  public:
+    // Количество элементов в одном блоке
+    static constexpr size_type chunk_capacity =
+        ChunkBytes >= sizeof(ChunkBase) + 2 * sizeof(value_type)
+            ? (ChunkBytes - sizeof(ChunkBase)) / sizeof(value_type)
+            : 2;
+
+  private:
+    // Удаление сдвигает элементы блока, а слияние и деление блоков переносят
+    // их, поэтому удаление не бросает исключений, только если не бросают
+    // перенос элементов
+    static constexpr bool kNothrowMove =
+        std::is_nothrow_move_constructible_v<value_type> &&
+        std::is_nothrow_move_assignable_v<value_type>;
+
+  public:
+
+    /**
+     * @brief Конструктор по умолчанию, создает пустой список
+     */
+    unrolled_list() : head_(new ChunkBase), size_(0U) {
+    }
+
+    /**
+     * @brief Создает список из n элементов, инициализированных по умолчанию
+     *
+     * @param n Размер создаваемого списка
+     */
+    explicit unrolled_list(size_type n) : unrolled_list() {
+        while (n > 0) {
+            emplace_back();
+            --n;
+        }
+    }
+
+    /**
+     * @brief Конструктор списка инициализаторов
+     *
+     * @param items Список создаваемых элементов
+     */
+    unrolled_list(std::initializer_list<value_type> const &items)
+        : unrolled_list() {
+        for (const auto &item : items) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Конструктор копирования
+     *
+     * @param other копируемый объект
+     */
+    unrolled_list(const unrolled_list &other) : unrolled_list() {
+        for (const auto &item : other) {
+            push_back(item);
+        }
+    }
+
+    /**
+     * @brief Конструктор переноса. other остается пустым
+     *
+     * @param other переносимый объект
+     */
+    unrolled_list(unrolled_list &&other) noexcept : unrolled_list() {
+        swap(other);
+    }
+
+    /**
+     * @brief Оператор присваивания копированием
+     *
+     * @param other Копируемый список
+     * @return unrolled_list&
+     */
+    unrolled_list &operator=(const unrolled_list &other) {
+        if (this != &other) {
+            unrolled_list copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Оператор присваивания переносом
+     *
+     * @param other Перемещаемый список
+     * @return unrolled_list&
+     */
+    unrolled_list &operator=(unrolled_list &&other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Деструктор
+     */
+    ~unrolled_list() {
+        clear();
+        delete head_;
+        head_ = nullptr;
+    }
+
+    /**
+     * @brief Доступ к первому элементу. На пустом контейнере - UB
+     *
+     * @return reference
+     */
+    reference front() noexcept {
+        return AsChunk(head_->next_)->Data()[0];
+    }
+
+    const_reference front() const noexcept {
+        return AsChunk(head_->next_)->Data()[0];
+    }
+
+    /**
+     * @brief Доступ к последнему элементу. На пустом контейнере - UB
+     *
+     * @return reference
+     */
+    reference back() noexcept {
+        Chunk *last = AsChunk(head_->prev_);
+        return last->Data()[last->count_ - 1];
+    }
+
+    const_reference back() const noexcept {
+        const Chunk *last = AsChunk(head_->prev_);
+        return last->Data()[last->count_ - 1];
+    }
+
+    iterator begin() noexcept {
+        return iterator(head_->next_, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(head_->next_, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(head_, 0);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(head_, 0);
+    }
+
+    /**
+     * @brief Проверяет, пустой ли контейнер
+     *
+     * @return true контейнер пустой
+     * @return false в контейнере есть элементы
+     */
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Количество элементов в контейнере
+     *
+     * @return size_type
+     */
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Максимально возможное количество элементов
+     *
+     * @return size_type
+     */
+    size_type max_size() const noexcept {
+        return std::numeric_limits<size_type>::max() / sizeof(Chunk) *
+               chunk_capacity;
+    }
+
+    /**
+     * @brief Удаляет все элементы и освобождает все блоки
+     */
+    void clear() noexcept {
+        ChunkBase *chunk = head_->next_;
+        while (chunk != head_) {
+            ChunkBase *next = chunk->next_;
+            DestroyChunk(AsChunk(chunk));
+            chunk = next;
+        }
+        head_->next_ = head_;
+        head_->prev_ = head_;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Вставляет value перед pos
+     * @details Итераторы на элементы блока, в который попал элемент,
+     * становятся недействительными
+     *
+     * @param pos
+     * @param value
+     * @return iterator Итератор на вставленный элемент
+     */
+    iterator insert(const_iterator pos, const_reference value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type &&value) {
+        return emplace(pos, std::move(value));
+    }
+
+    /**
+     * @brief Создает элемент из args... перед pos
+     * @details Если блок pos заполнен, он делится пополам. Вставка в начало
+     * блока использует свободное место в конце предыдущего блока.
+     *
+     * @param pos
+     * @param args Аргументы конструктора элемента
+     * @return iterator Итератор на вставленный элемент
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args) {
+        ChunkBase *chunk = const_cast<ChunkBase *>(pos.chunk_);
+        size_type index = pos.index_;
+
+        // Вставка в начало блока (или в конец списка) - дописываем в конец
+        // предыдущего блока, если там есть место
+        if (index == 0 && chunk->prev_ != head_ &&
+            chunk->prev_->count_ < chunk_capacity) {
+            chunk = chunk->prev_;
+            index = chunk->count_;
+        } else if (chunk == head_ || chunk->count_ == chunk_capacity) {
+            if (chunk == head_) {
+                chunk = LinkChunk(NewChunk(), head_);
+                index = 0;
+            } else {
+                // Значение создается до деления: args могут ссылаться на
+                // элементы, которые переедут в новый блок
+                value_type value(std::forward<Args>(args)...);
+                Chunk *upper = Split(AsChunk(chunk));
+                if (index > chunk->count_) {
+                    index -= chunk->count_;
+                    chunk = upper;
+                }
+                AsChunk(chunk)->Emplace(index, std::move(value));
+                ++size_;
+                return iterator(chunk, index);
+            }
+        }
+
+        AsChunk(chunk)->Emplace(index, std::forward<Args>(args)...);
+        ++size_;
+        return iterator(chunk, index);
+    }
+
+    /**
+     * @brief Удаляет элемент на позиции pos
+     * @details Пустой блок освобождается. Если блок заполнен меньше чем на
+     * четверть и помещается вместе со следующим в один блок - они сливаются
+     *
+     * @param pos Удаляемый элемент (не end())
+     * @return iterator Итератор на элемент, следовавший за удаленным
+     */
+    iterator erase(const_iterator pos) noexcept(kNothrowMove) {
+        Chunk *chunk = AsChunk(const_cast<ChunkBase *>(pos.chunk_));
+        size_type index = pos.index_;
+        chunk->Erase(index);
+        --size_;
+
+        if (chunk->count_ == 0) {
+            ChunkBase *next = chunk->next_;
+            UnlinkChunk(chunk);
+            DestroyChunk(chunk);
+            return iterator(next, 0);
+        }
+
+        ChunkBase *next = chunk->next_;
+        if (next != head_ && chunk->count_ < chunk_capacity / 4 &&
+            chunk->count_ + next->count_ <= chunk_capacity) {
+            chunk->Absorb(AsChunk(next));
+            UnlinkChunk(next);
+            DestroyChunk(AsChunk(next));
+        }
+
+        if (index < chunk->count_) {
+            return iterator(chunk, index);
+        }
+        return iterator(chunk->next_, 0);
+    }
+
+    /**
+     * @brief Добавляет элемент в конец списка
+     *
+     * @param value
+     */
+    void push_back(const_reference value) {
+        emplace(end(), value);
+    }
+
+    void push_back(value_type &&value) {
+        emplace(end(), std::move(value));
+    }
+
+    /**
+     * @brief Создает элемент в конце списка
+     *
+     * @param args Аргументы конструктора элемента
+     * @return reference Ссылка на созданный элемент
+     */
+    template <typename... Args>
+    reference emplace_back(Args &&...args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Удаляет последний элемент. На пустом контейнере - UB
+     */
+    void pop_back() noexcept(kNothrowMove) {
+        Chunk *last = AsChunk(head_->prev_);
+        erase(const_iterator(last, last->count_ - 1));
+    }
+
+    /**
+     * @brief Добавляет элемент в начало списка
+     *
+     * @param value
+     */
+    void push_front(const_reference value) {
+        emplace(begin(), value);
+    }
+
+    void push_front(value_type &&value) {
+        emplace(begin(), std::move(value));
+    }
+
+    /**
+     * @brief Создает элемент в начале списка
+     *
+     * @param args Аргументы конструктора элемента
+     * @return reference Ссылка на созданный элемент
+     */
+    template <typename... Args>
+    reference emplace_front(Args &&...args) {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Удаляет первый элемент. На пустом контейнере - UB
+     */
+    void pop_front() noexcept(kNothrowMove) {
+        erase(begin());
+    }
+
+    /**
+     * @brief Обменивает содержимое двух списков без копирования элементов
+     *
+     * @param other
+     */
+    void swap(unrolled_list &other) noexcept {
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+  private:
+    /**
+     * @brief Блок с элементами. Элементы занимают первые count_ ячеек
+     * storage_
+     */
+    struct Chunk : ChunkBase {
+        Chunk() noexcept {
+            this->next_ = nullptr;
+            this->prev_ = nullptr;
+        }
+
+        value_type *Data() noexcept {
+            return std::launder(reinterpret_cast<value_type *>(storage_));
+        }
+
+        const value_type *Data() const noexcept {
+            return std::launder(reinterpret_cast<const value_type *>(storage_));
+        }
+
+        /**
+         * @brief Создает элемент в ячейке index, сдвигая последующие вправо.
+         * В блоке должно быть свободное место
+         */
+        template <typename... Args>
+        void Emplace(size_type index, Args &&...args) {
+            value_type *data = Data();
+            if (index == this->count_) {
+                ::new (static_cast<void *>(data + index))
+                    value_type(std::forward<Args>(args)...);
+            } else {
+                // Значение создается до сдвига: args могут ссылаться на
+                // элементы этого же блока
+                value_type value(std::forward<Args>(args)...);
+                ::new (static_cast<void *>(data + this->count_))
+                    value_type(std::move(data[this->count_ - 1]));
+                std::move_backward(data + index, data + this->count_ - 1,
+                                   data + this->count_);
+                data[index] = std::move(value);
+            }
+            ++this->count_;
+        }
+
+        /**
+         * @brief Удаляет элемент в ячейке index, сдвигая последующие влево
+         */
+        void Erase(size_type index) noexcept(kNothrowMove) {
+            value_type *data = Data();
+            std::move(data + index + 1, data + this->count_, data + index);
+            --this->count_;
+            data[this->count_].~value_type();
+        }
+
+        /**
+         * @brief Переносит все элементы блока other в конец этого блока
+         */
+        void Absorb(Chunk *other) noexcept(kNothrowMove) {
+            MoveTail(other, 0, this);
+        }
+
+        /**
+         * @brief Переносит элементы from[first, count_) в конец блока to.
+         * Если перенос элемента бросает исключение, уже созданные в to
+         * элементы уничтожаются, а from сохраняет все свои элементы
+         */
+        static void MoveTail(Chunk *from, size_type first,
+                             Chunk *to) noexcept(kNothrowMove) {
+            if constexpr (kNothrowMove) {
+                AppendMoved(from, first, to);
+            } else {
+                size_type old_count = to->count_;
+                try {
+                    AppendMoved(from, first, to);
+                } catch (...) {
+                    value_type *target = to->Data();
+                    for (size_type i = old_count; i < to->count_; ++i) {
+                        target[i].~value_type();
+                    }
+                    to->count_ = old_count;
+                    throw;
+                }
+            }
+            value_type *source = from->Data();
+            for (size_type i = first; i < from->count_; ++i) {
+                source[i].~value_type();
+            }
+            from->count_ = first;
+        }
+
+        /**
+         * @brief Создает в конце блока to элементы, перенесенные из
+         * from[first, count_). Исходные элементы не уничтожаются
+         */
+        static void AppendMoved(Chunk *from, size_type first,
+                                Chunk *to) noexcept(kNothrowMove) {
+            value_type *source = from->Data();
+            value_type *target = to->Data();
+            for (size_type i = first; i < from->count_; ++i) {
+                ::new (static_cast<void *>(target + to->count_))
+                    value_type(std::move(source[i]));
+                ++to->count_;
+            }
+        }
+
+        alignas(value_type) unsigned char storage_[chunk_capacity *
+                                                   sizeof(value_type)];
+    };
+
+    static Chunk *AsChunk(ChunkBase *chunk) noexcept {
+        return static_cast<Chunk *>(chunk);
+    }
+
+    static const Chunk *AsChunk(const ChunkBase *chunk) noexcept {
+        return static_cast<const Chunk *>(chunk);
+    }
+
+    static Chunk *NewChunk() {
+        return new Chunk;
+    }
+
+    static void DestroyChunk(Chunk *chunk) noexcept {
+        value_type *data = chunk->Data();
+        for (size_type i = 0; i < chunk->count_; ++i) {
+            data[i].~value_type();
+        }
+        delete chunk;
+    }
+
+    /**
+     * @brief Встраивает блок chunk перед блоком position
+     *
+     * @return ChunkBase* Встроенный блок
+     */
+    static ChunkBase *LinkChunk(Chunk *chunk, ChunkBase *position) noexcept {
+        chunk->next_ = position;
+        chunk->prev_ = position->prev_;
+        position->prev_->next_ = chunk;
+        position->prev_ = chunk;
+        return chunk;
+    }
+
+    static void UnlinkChunk(ChunkBase *chunk) noexcept {
+        chunk->prev_->next_ = chunk->next_;
+        chunk->next_->prev_ = chunk->prev_;
+    }
+
+    /**
+     * @brief Делит заполненный блок пополам: вторая половина элементов
+     * переезжает в новый блок, встроенный сразу после chunk
+     *
+     * @return Chunk* Новый блок
+     */
+    static Chunk *Split(Chunk *chunk) {
+        Chunk *upper = NewChunk();
+        try {
+            Chunk::MoveTail(chunk, chunk->count_ / 2, upper);
+        } catch (...) {
+            delete upper;
+            throw;
+        }
+        LinkChunk(upper, chunk->next_);
+        return upper;
+    }
+
+    /**
+     * @brief Итератор развернутого списка: блок и номер элемента в блоке.
+     * end() - это служебный блок head_ с номером 0
+     */
+    struct UnrolledListIterator {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = unrolled_list::value_type;
+        using pointer = value_type *;
+        using reference = value_type &;
+
+        UnrolledListIterator() = delete;
+
+        UnrolledListIterator(ChunkBase *chunk, size_type index) noexcept
+            : chunk_(chunk), index_(index) {
+        }
+
+        reference operator*() const noexcept {
+            return AsChunk(chunk_)->Data()[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return AsChunk(chunk_)->Data() + index_;
+        }
+
+        iterator &operator++() noexcept {
+            if (++index_ == chunk_->count_) {
+                chunk_ = chunk_->next_;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        iterator operator++(int) noexcept {
+            iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+
+        iterator &operator--() noexcept {
+            if (index_ == 0) {
+                chunk_ = chunk_->prev_;
+                index_ = chunk_->count_;
+            }
+            --index_;
+            return *this;
+        }
+
+        iterator operator--(int) noexcept {
+            iterator tmp{*this};
+            --(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const iterator &it1,
+                               const iterator &it2) noexcept {
+            return it1.chunk_ == it2.chunk_ && it1.index_ == it2.index_;
+        }
+
+        friend bool operator!=(const iterator &it1,
+                               const iterator &it2) noexcept {
+            return !(it1 == it2);
+        }
+
+        ChunkBase *chunk_;
+        size_type index_;
+    };
+
+    /**
+     * @brief Константный итератор развернутого списка
+     */
+    struct UnrolledListIteratorConst {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = unrolled_list::value_type;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        UnrolledListIteratorConst() = delete;
+
+        UnrolledListIteratorConst(const ChunkBase *chunk,
+                                  size_type index) noexcept
+            : chunk_(chunk), index_(index) {
+        }
+
+        UnrolledListIteratorConst(const iterator &it) noexcept
+            : chunk_(it.chunk_), index_(it.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return AsChunk(chunk_)->Data()[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return AsChunk(chunk_)->Data() + index_;
+        }
+
+        const_iterator &operator++() noexcept {
+            if (++index_ == chunk_->count_) {
+                chunk_ = chunk_->next_;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp{*this};
+            ++(*this);
+            return tmp;
+        }
+
+        const_iterator &operator--() noexcept {
+            if (index_ == 0) {
+                chunk_ = chunk_->prev_;
+                index_ = chunk_->count_;
+            }
+            --index_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp{*this};
+            --(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return it1.chunk_ == it2.chunk_ && it1.index_ == it2.index_;
+        }
+
+        friend bool operator!=(const const_iterator &it1,
+                               const const_iterator &it2) noexcept {
+            return !(it1 == it2);
+        }
+
+        const ChunkBase *chunk_;
+        size_type index_;
+    };
+
+    // Служебный блок без элементов: next_ - первый блок, prev_ - последний
+    ChunkBase *head_;
+    // Количество элементов в списке
+    size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_UNROLLED_LIST_H_
@@ -3,7 +3,12 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace s21 {
@@ -11,10 +16,21 @@ namespace s21 {
 /**
  * @brief s21::vector - STL like std::vector implementation
  *
+ * @details With Alignment above alignof(T) the buffer is allocated with the
+ * aligned operator new, so data() is Alignment-aligned: e.g. 64 for AVX-512
+ * loads or to keep the buffer off other data's cache lines.
+ *
  * @tparam T containers type
+ * @tparam Alignment alignment of the buffer, a power of two not below
+ * alignof(T)
  */
-template <typename T>
+template <typename T, std::size_t Alignment = alignof(T)>
 class vector {
+    static_assert(Alignment >= alignof(T) &&
+                      (Alignment & (Alignment - 1)) == 0,
+                  "s21::vector alignment must be a power of two not below "
+                  "alignof(T)");
+
   public:
     using value_type = T;
     using reference = T &;
@@ -41,10 +57,7 @@ class vector {
     explicit vector(size_type size) {
         size_ = size;
         capacity_ = size;
-        buffer_ = nullptr;
-        if (size > 0) {
-            buffer_ = new value_type[capacity_];
-        }
+        buffer_ = Allocate(capacity_);
     }
 
     /**
@@ -54,7 +67,7 @@ class vector {
      */
     explicit vector(std::initializer_list<value_type> const &init)
         : size_{init.size()},
-          capacity_(init.size()), buffer_{new value_type[capacity_]} {
+          capacity_(init.size()), buffer_{Allocate(capacity_)} {
         std::copy(init.begin(), init.end(), buffer_);
     }
 
@@ -66,10 +79,7 @@ class vector {
     vector(const vector &rhs) {
         size_ = rhs.size_;
         capacity_ = rhs.capacity_;
-        buffer_ = nullptr;
-        if (size_ > 0) {
-            buffer_ = new value_type[capacity_];
-        }
+        buffer_ = Allocate(capacity_);
         std::copy(rhs.begin(), rhs.end(), buffer_);
     }
 
@@ -88,7 +98,7 @@ class vector {
      * @brief Destructor - cleans up the memory used
      */
     ~vector() {
-        delete[] buffer_;
+        Deallocate(buffer_, capacity_);
     }
 
     /**
@@ -99,6 +109,7 @@ class vector {
      */
     constexpr vector &operator=(vector &&rhs) noexcept {
         if (this != &rhs) {
+            Deallocate(buffer_, capacity_);
             size_ = std::exchange(rhs.size_, 0);
             capacity_ = std::exchange(rhs.capacity_, 0);
             buffer_ = std::exchange(rhs.buffer_, nullptr);
@@ -115,12 +126,11 @@ class vector {
      */
     constexpr vector &operator=(const vector &rhs) {
         if (this != &rhs) {
-            delete[] buffer_;
+            iterator buffer = Allocate(rhs.capacity_);
+            std::copy(rhs.begin(), rhs.end(), buffer);
+            Deallocate(buffer_, capacity_);
 
-            if (rhs.size_ > 0) {
-                buffer_ = new value_type[rhs.capacity_];
-                std::copy(rhs.begin(), rhs.end(), buffer_);
-            }
+            buffer_ = buffer;
             size_ = rhs.size_;
             capacity_ = rhs.capacity_;
         }
@@ -388,7 +398,7 @@ class vector {
         if (size_ == capacity_)
             ReallocVector(size_ ? size_ * 2 : 1);
 
-        std::copy(begin() + index, end(), begin() + index + 1);
+        std::move_backward(begin() + index, end(), end() + 1);
         *(buffer_ + index) = std::move(value);
 
         ++size_;
@@ -413,7 +423,7 @@ class vector {
         if (size_ == capacity_)
             ReallocVector(size_ ? size_ * 2 : 1);
 
-        std::copy(begin() + index, end(), begin() + index + 1);
+        std::move_backward(begin() + index, end(), end() + 1);
         *(buffer_ + index) = value;
 
         ++size_;
@@ -479,6 +489,34 @@ class vector {
         --size_;
     }
 
+    /**
+     * @brief Appends the elements of [first, last). With forward iterators
+     * the buffer grows at most once
+     *
+     * @param first, last Range of elements to append
+     */
+    template <typename InputIt>
+    constexpr void append_range(InputIt first, InputIt last) {
+        using category =
+            typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        category>) {
+            auto count = static_cast<size_type>(std::distance(first, last));
+            if (size_ + count > capacity_)
+                reserve(std::max(size_ + count, size_ * 2));
+        }
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    /**
+     * @brief Removes the last count elements of the container.
+     * @details count > size() results in UB.
+     */
+    constexpr void pop_back_n(size_type count) noexcept {
+        size_ -= count;
+    }
+
     /**
      * @brief Exchanges the contents of the container with those of other. Does
      * not invoke any move, copy, or swap operations on individual elements.
@@ -532,14 +570,53 @@ class vector {
     iterator buffer_ = nullptr;
 
     void ReallocVector(size_type new_capacity) {
-        iterator tmp = new value_type[new_capacity];
+        iterator tmp = Allocate(new_capacity);
         for (size_type i = 0; i < size_; ++i)
             tmp[i] = std::move(buffer_[i]);
 
-        delete[] buffer_;
+        Deallocate(buffer_, capacity_);
         buffer_ = tmp;
         capacity_ = new_capacity;
     }
+
+    // new[] already honours alignof(T), only a stricter alignment needs the
+    // aligned operator new
+    static constexpr bool kOverAligned = Alignment > alignof(T);
+
+    /**
+     * @brief Allocates a buffer of count default-initialized elements, nullptr
+     * for 0
+     */
+    static iterator Allocate(size_type count) {
+        if (count == 0)
+            return nullptr;
+        if constexpr (!kOverAligned) {
+            return new value_type[count];
+        } else {
+            void *raw = ::operator new[](count * sizeof(value_type),
+                                         std::align_val_t(Alignment));
+            iterator buffer = static_cast<iterator>(raw);
+            try {
+                std::uninitialized_default_construct_n(buffer, count);
+            } catch (...) {
+                ::operator delete[](raw, std::align_val_t(Alignment));
+                throw;
+            }
+            return buffer;
+        }
+    }
+
+    /**
+     * @brief Destroys and frees a buffer of count elements from Allocate()
+     */
+    static void Deallocate(iterator buffer, size_type count) noexcept {
+        if constexpr (!kOverAligned) {
+            delete[] buffer;
+        } else if (buffer != nullptr) {
+            std::destroy_n(buffer, count);
+            ::operator delete[](buffer, std::align_val_t(Alignment));
+        }
+    }
 };
 
 }  // namespace s21
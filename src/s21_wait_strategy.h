@@ -0,0 +1,176 @@
+/**
+ * @file s21_wait_strategy.h
+ * @brief Стратегии ожидания для блокирующих операций lock-free контейнеров.
+ *
+ * @details Стратегия - это объект-событие с двумя операциями:
+ * - Wait(ready) - ждет, пока предикат ready() не вернет true. После первого
+ * true предикат больше не вызывается, поэтому он может сам захватывать ресурс
+ * (например, ячейку очереди);
+ * - Notify() - вызывается после каждого изменения, которое может сделать
+ * ready() истинным у ожидающего потока.
+ *
+ * Стратегии различаются ценой ожидания и уведомления:
+ * - spin_wait - активное ожидание с инструкцией pause. Минимальная задержка,
+ * но ожидающий поток занимает ядро целиком. Notify() ничего не делает;
+ * - yield_wait - после короткого активного ожидания отдает квант времени
+ * (std::this_thread::yield()). Notify() ничего не делает;
+ * - futex_wait - после короткого активного ожидания поток засыпает в ядре
+ * (futex на Linux). Notify() стоит один барьер памяти, а системный вызов
+ * делается, только если кто-то собирается заснуть или спит. На других
+ * платформах ведет себя как yield_wait.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_WAIT_STRATEGY_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_WAIT_STRATEGY_H_
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+
+/**
+ * @brief Подсказка процессору, что поток крутится в цикле ожидания: снижает
+ * энергопотребление и не мешает второму гиперпотоку ядра
+ */
+inline void CpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Активное ожидание
+ */
+struct spin_wait {
+    template <typename Ready>
+    void Wait(Ready ready) noexcept(noexcept(ready())) {
+        while (!ready()) {
+            CpuRelax();
+        }
+    }
+
+    void Notify() noexcept {
+    }
+};
+
+/**
+ * @brief Активное ожидание, затем уступка процессора другим потокам
+ */
+struct yield_wait {
+    // Количество итераций активного ожидания перед первым yield()
+    static constexpr int kSpins = 64;
+
+    template <typename Ready>
+    void Wait(Ready ready) noexcept(noexcept(ready())) {
+        for (int i = 0; i < kSpins; ++i) {
+            if (ready()) {
+                return;
+            }
+            CpuRelax();
+        }
+        while (!ready()) {
+            std::this_thread::yield();
+        }
+    }
+
+    void Notify() noexcept {
+    }
+};
+
+/**
+ * @brief Активное ожидание, затем сон в ядре до уведомления
+ *
+ * @details Протокол (eventcount): ожидающий поток запоминает epoch_, взводит
+ * флаг sleeping_ и еще раз проверяет условие; уведомляющий поток после
+ * изменения данных сбрасывает флаг и, если он был взведен, увеличивает epoch_
+ * и будит все потоки. Барьеры seq_cst с обеих сторон гарантируют, что либо
+ * ожидающий увидит изменение данных, либо уведомляющий увидит флаг (или его
+ * сброс другим уведомляющим, который тоже увеличит epoch_). Если epoch_
+ * изменилась после чтения, futex возвращается сразу, поэтому уведомление не
+ * теряется. epoch_ читается до взведения флага: иначе флаг мог бы сбросить
+ * уведомляющий, чье увеличение epoch_ ожидающий уже успел прочитать.
+ *
+ * Флаг, а не счетчик ожидающих, нужен, чтобы системный вызов делался один раз
+ * на засыпание: пока разбуженный поток не получил процессор, следующие
+ * уведомления видят сброшенный флаг и ничего не стоят.
+ */
+class futex_wait {
+  public:
+    // Количество итераций активного ожидания перед засыпанием
+    static constexpr int kSpins = 128;
+
+    template <typename Ready>
+    void Wait(Ready ready) noexcept(noexcept(ready())) {
+        for (int i = 0; i < kSpins; ++i) {
+            if (ready()) {
+                return;
+            }
+            CpuRelax();
+        }
+        for (;;) {
+            std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ready()) {
+                return;
+            }
+            Sleep(epoch);
+        }
+    }
+
+    void Notify() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed) &&
+            sleeping_.exchange(false, std::memory_order_relaxed)) {
+            epoch_.fetch_add(1, std::memory_order_release);
+            WakeAll();
+        }
+    }
+
+  private:
+#if defined(__linux__)
+    void Sleep(std::uint32_t epoch) noexcept {
+        // Ложные пробуждения (EINTR, EAGAIN) обрабатываются циклом в Wait()
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&epoch_),
+                FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+    }
+
+    void WakeAll() noexcept {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&epoch_),
+                FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+#else
+    void Sleep(std::uint32_t) noexcept {
+        std::this_thread::yield();
+    }
+
+    void WakeAll() noexcept {
+    }
+#endif
+
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                  "futex requires a plain 32-bit word");
+
+    // Счетчик уведомлений, на нем засыпают ожидающие потоки
+    std::atomic<std::uint32_t> epoch_{0};
+    // Взведен, если кто-то собирается заснуть или спит
+    std::atomic<bool> sleeping_{false};
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_WAIT_STRATEGY_H_
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_algorithm.h"
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr auto kPorts = s21::sorted(
+    s21::array<int, 20>{443, 22,   80,   25,  8080, 3306, 5432, 6379, 53, 21,
+                        110, 143, 993, 995, 587, 465,  123,  161,  389, 636});
+
+static_assert(kPorts.front() == 21 && kPorts.back() == 8080);
+static_assert(s21::binary_search(kPorts.begin(), kPorts.end(), 5432));
+static_assert(!s21::binary_search(kPorts.begin(), kPorts.end(), 5433));
+static_assert(*s21::lower_bound(kPorts.begin(), kPorts.end(), 100) == 110);
+
+constexpr auto kDescending =
+    s21::sorted(s21::array<int, 5>{3, 1, 4, 1, 5}, std::greater<>());
+static_assert(kDescending[0] == 5 && kDescending[4] == 1);
+
+}  // namespace
+
+TEST(Algorithm, sort_matches_std) {
+    std::mt19937 gen(5);
+    for (int size : {0, 1, 2, 15, 16, 17, 100, 5000}) {
+        for (int range : {3, 1000000}) {
+            std::vector<int> values(size);
+            for (auto &value : values) {
+                value = static_cast<int>(gen() % range);
+            }
+            std::vector<int> expected = values;
+            std::sort(expected.begin(), expected.end());
+            s21::sort(values.begin(), values.end());
+            ASSERT_EQ(values, expected);
+        }
+    }
+}
+
+TEST(Algorithm, sort_worst_cases_and_comparator) {
+    std::vector<int> ascending(3000);
+    for (int i = 0; i < 3000; ++i) {
+        ascending[i] = i;
+    }
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+    s21::sort(descending.begin(), descending.end());
+    ASSERT_EQ(descending, ascending);
+
+    std::vector<std::string> words{"pear", "fig", "apple", "kiwi", "banana"};
+    s21::sort(words.begin(), words.end(),
+              [](const std::string &lhs, const std::string &rhs) {
+                  return lhs.size() < rhs.size();
+              });
+    ASSERT_EQ(words.front(), "fig");
+    ASSERT_EQ(words.back(), "banana");
+}
+
+TEST(Algorithm, binary_search_on_sorted_range) {
+    std::vector<int> values{1, 3, 3, 7, 9};
+    ASSERT_TRUE(s21::binary_search(values.begin(), values.end(), 3));
+    ASSERT_FALSE(s21::binary_search(values.begin(), values.end(), 4));
+    ASSERT_FALSE(s21::binary_search(values.begin(), values.begin(), 1));
+    ASSERT_EQ(s21::lower_bound(values.begin(), values.end(), 3),
+              values.begin() + 1);
+    ASSERT_EQ(s21::lower_bound(values.begin(), values.end(), 10),
+              values.end());
+}
@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
 
+#include "../s21_cache_line.h"
 #include "../s21_containers.h"
 
 class ArrayTest : public ::testing::Test {
@@ -196,9 +202,100 @@ TEST(Array, test_all_const) {
 }
 
 TEST(Array, exception) {
-    ASSERT_ANY_THROW((s21::array<int, 5>{1, 2, 3, 4, 5, 6, 7}));
-    ASSERT_ANY_THROW((s21::array<int, 1>{1, 2, 3, 4, 5, 6, 7}));
-    ASSERT_ANY_THROW((s21::array<int, 2>{1, 2, 3, 4, 5, 6, 7}));
-    ASSERT_ANY_THROW((s21::array<int, 3>{1, 2, 3, 4, 5, 6, 7}));
+    // Too many initializers no longer compile (s21::array is an aggregate),
+    // missing ones are value-initialized
     ASSERT_NO_THROW((s21::array<int, 7>{1, 2, 3, 4, 5, 6, 7}));
+    s21::array<int, 5> partial{1, 2};
+    ASSERT_EQ(partial[1], 2);
+    ASSERT_EQ(partial[4], 0);
+    s21::array<std::string, 2> strings{"a"};
+    ASSERT_EQ(strings[1], "");
+}
+
+namespace {
+
+constexpr s21::array<int, 4> MakeSquares() {
+    s21::array<int, 4> squares;
+    for (std::size_t i = 0; i < squares.size(); ++i) {
+        squares.at(i) = static_cast<int>(i * i);
+    }
+    return squares;
+}
+
+constexpr int SumAfterCopyFillSwap() {
+    s21::array<int, 4> a = MakeSquares();
+    s21::array<int, 4> b(a);
+    s21::array<int, 4> c;
+    c = std::move(b);
+    c.fill(2);
+    a.swap(c);
+    return a.front() + a.back() + c[3] + *c.data();
+}
+
+}  // namespace
+
+TEST(Array, usable_in_constant_expressions) {
+    constexpr s21::array<int, 4> squares = MakeSquares();
+    static_assert(squares[3] == 9);
+    static_assert(squares.at(2) == 4);
+    static_assert(squares.size() == 4 && !squares.empty());
+    static_assert(SumAfterCopyFillSwap() == 2 + 2 + 9 + 0);
+    constexpr s21::array<char, 3> letters{'a', 'b', 'c'};
+    static_assert(letters.back() == 'c');
+    ASSERT_EQ(squares[1], 1);
+}
+
+TEST(Array, aggregate_and_trivially_copyable) {
+    static_assert(std::is_aggregate_v<s21::array<int, 4>>);
+    static_assert(std::is_trivially_copyable_v<s21::array<int, 4>>);
+    static_assert(
+        std::is_trivially_copyable_v<s21::array<s21::array<double, 3>, 3>>);
+    static_assert(!std::is_trivially_copyable_v<s21::array<std::string, 2>>);
+    static_assert(sizeof(s21::array<int, 4>) == 4 * sizeof(int));
+
+    s21::array<s21::array<int, 3>, 2> matrix{{{1, 2, 3}, {4, 5, 6}}};
+    s21::array<s21::array<int, 3>, 2> copy;
+    std::memcpy(&copy, &matrix, sizeof(matrix));
+    ASSERT_EQ(copy[1][2], 6);
+    ASSERT_EQ(copy[0][0], 1);
+
+    s21::array<int, 3> list_initialized = {7, 8, 9};
+    ASSERT_EQ(list_initialized.back(), 9);
+}
+
+TEST(Array, over_aligned_storage) {
+    using aligned = s21::array<float, 3, 64>;
+    static_assert(alignof(aligned) == 64);
+    static_assert(sizeof(aligned) == 64);
+    static_assert(std::is_aggregate_v<aligned>);
+    static_assert(std::is_trivially_copyable_v<aligned>);
+
+    aligned lanes[2] = {{1.0F, 2.0F, 3.0F}, {4.0F}};
+    for (const auto &item : lanes) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(item.data()) % 64, 0U);
+    }
+    ASSERT_EQ(lanes[0][2], 3.0F);
+    ASSERT_EQ(lanes[1][1], 0.0F);
+}
+
+TEST(Array, cache_padded_elements) {
+    using counter = s21::cache_padded<std::atomic<long>>;
+    static_assert(alignof(counter) == s21::kCacheLineSize);
+    static_assert(sizeof(counter) == s21::kCacheLineSize);
+    static_assert(sizeof(s21::cache_padded<char[100]>) ==
+                  2 * s21::kCacheLineSize);
+
+    s21::array<counter, 4> counters{};
+    for (std::size_t i = 0; i < counters.size(); ++i) {
+        counters[i]->fetch_add(static_cast<long>(i) + 1);
+    }
+    ASSERT_EQ(counters[0]->load(), 1);
+    ASSERT_EQ(counters[3].get().load(), 4);
+    ASSERT_EQ(reinterpret_cast<char *>(&counters[1]) -
+                  reinterpret_cast<char *>(&counters[0]),
+              static_cast<std::ptrdiff_t>(s21::kCacheLineSize));
+
+    const s21::cache_padded<std::string> word("padded");
+    ASSERT_EQ(*word, "padded");
+    ASSERT_EQ(word->size(), 6U);
 }
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+std::vector<bool> ToStd(const s21::bitset_vector &bits) {
+    return std::vector<bool>(bits.begin(), bits.end());
+}
+
+}  // namespace
+
+TEST(BitsetVector, push_back_and_access) {
+    s21::bitset_vector bits;
+    ASSERT_TRUE(bits.empty());
+    ASSERT_EQ(bits.find_first(), s21::bitset_vector::npos);
+
+    for (int i = 0; i < 200; ++i) {
+        bits.push_back(i % 3 == 0);
+    }
+    ASSERT_EQ(bits.size(), 200U);
+    ASSERT_EQ(bits.word_count(), 4U);
+    ASSERT_GE(bits.capacity(), 200U);
+    ASSERT_TRUE(bits[0]);
+    ASSERT_FALSE(bits[1]);
+    ASSERT_TRUE(bits.test(198));
+    ASSERT_FALSE(bits.at(199));
+    ASSERT_THROW(bits.at(200), std::out_of_range);
+    ASSERT_THROW(bits.test(200), std::out_of_range);
+    ASSERT_EQ(bits.count(), 67U);
+
+    bits[1] = true;
+    bits.at(0) = false;
+    bits[2] = bits[1];
+    ASSERT_FALSE(bits.front());
+    ASSERT_TRUE(bits[1] && bits[2]);
+    bits[2].flip();
+    ASSERT_FALSE(bits[2]);
+    ASSERT_TRUE(~bits[2]);
+
+    bits.pop_back();
+    ASSERT_EQ(bits.size(), 199U);
+    ASSERT_TRUE(bits.back());
+    ASSERT_EQ(bits.data()[3] >> (199 % 64), 0U);
+
+    s21::bitset_vector none;
+    ASSERT_THROW(none.pop_back(), std::length_error);
+}
+
+TEST(BitsetVector, matches_std_vector_bool) {
+    std::mt19937 gen(7);
+    s21::bitset_vector bits;
+    std::vector<bool> expected;
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(gen() % 10);
+        if (op < 5 || expected.empty()) {
+            bool value = gen() % 2 != 0;
+            bits.push_back(value);
+            expected.push_back(value);
+        } else if (op < 7) {
+            bits.pop_back();
+            expected.pop_back();
+        } else {
+            std::size_t pos = gen() % expected.size();
+            bits.flip(pos);
+            expected[pos] = !expected[pos];
+        }
+    }
+    ASSERT_EQ(ToStd(bits), expected);
+    ASSERT_EQ(bits.count(), static_cast<std::size_t>(std::count(
+                                expected.begin(), expected.end(), true)));
+}
+
+TEST(BitsetVector, resize_set_reset_flip) {
+    s21::bitset_vector bits(70, true);
+    ASSERT_EQ(bits.count(), 70U);
+    ASSERT_TRUE(bits.all());
+
+    bits.resize(130);
+    ASSERT_EQ(bits.count(), 70U);
+    ASSERT_FALSE(bits.all());
+    bits.resize(140, true);
+    ASSERT_EQ(bits.count(), 80U);
+    ASSERT_TRUE(bits[135] && !bits[129]);
+    bits.resize(65);
+    ASSERT_EQ(bits.count(), 65U);
+    ASSERT_EQ(bits.word_count(), 2U);
+    bits.resize(100);
+    ASSERT_EQ(bits.count(), 65U);
+
+    bits.set(99).reset(0);
+    ASSERT_TRUE(bits[99]);
+    ASSERT_FALSE(bits[0]);
+    ASSERT_THROW(bits.set(100), std::out_of_range);
+    ASSERT_THROW(bits.reset(100), std::out_of_range);
+    ASSERT_THROW(bits.flip(100), std::out_of_range);
+
+    bits.flip();
+    ASSERT_EQ(bits.count(), 100U - 65U);
+    bits.set();
+    ASSERT_EQ(bits.count(), 100U);
+    ASSERT_TRUE(bits.all());
+    bits.reset();
+    ASSERT_TRUE(bits.none());
+    ASSERT_FALSE(bits.any());
+
+    bits.clear();
+    ASSERT_TRUE(bits.empty());
+    ASSERT_TRUE(bits.all());
+}
+
+TEST(BitsetVector, find_first_and_next) {
+    s21::bitset_vector bits(1000);
+    std::vector<std::size_t> positions{3, 63, 64, 200, 511, 512, 999};
+    for (std::size_t pos : positions) {
+        bits.set(pos);
+    }
+    std::vector<std::size_t> found;
+    for (auto i = bits.find_first(); i != bits.npos; i = bits.find_next(i)) {
+        found.push_back(i);
+    }
+    ASSERT_EQ(found, positions);
+    ASSERT_EQ(bits.find_next(999), s21::bitset_vector::npos);
+    ASSERT_EQ(bits.find_next(5000), s21::bitset_vector::npos);
+    ASSERT_EQ(bits.find_next(64), 200U);
+
+    bits.reset(3);
+    ASSERT_EQ(bits.find_first(), 63U);
+}
+
+TEST(BitsetVector, word_level_and_or_xor) {
+    s21::bitset_vector a{true, true, false, false, true};
+    s21::bitset_vector b{true, false, true, false, true};
+    ASSERT_EQ(a & b, (s21::bitset_vector{true, false, false, false, true}));
+    ASSERT_EQ(a | b, (s21::bitset_vector{true, true, true, false, true}));
+    ASSERT_EQ(a ^ b, (s21::bitset_vector{false, true, true, false, false}));
+    ASSERT_EQ(~a, (s21::bitset_vector{false, false, true, true, false}));
+    ASSERT_EQ((~a).count(), 2U);
+
+    a &= b;
+    ASSERT_EQ(a, (s21::bitset_vector{true, false, false, false, true}));
+    ASSERT_NE(a, b);
+    a |= b;
+    ASSERT_EQ(a, b);
+    a ^= b;
+    ASSERT_TRUE(a.none());
+
+    s21::bitset_vector shorter(4);
+    ASSERT_THROW(a &= shorter, std::invalid_argument);
+    ASSERT_THROW(a |= shorter, std::invalid_argument);
+    ASSERT_THROW(a ^ shorter, std::invalid_argument);
+    ASSERT_NE(a, shorter);
+}
+
+TEST(BitsetVector, iterators_copy_and_swap) {
+    s21::bitset_vector bits{true, false, true, true};
+    for (auto bit : bits) {
+        bit = !bit;
+    }
+    ASSERT_EQ(bits, (s21::bitset_vector{false, true, false, false}));
+
+    auto it = bits.begin();
+    it += 1;
+    ASSERT_TRUE(*it);
+    ASSERT_EQ(bits.end() - it, 3);
+    ASSERT_FALSE(it[1]);
+    s21::bitset_vector::const_iterator cit = it;
+    ASSERT_TRUE(*cit);
+    ASSERT_EQ(std::count(bits.begin(), bits.end(), true), 1);
+
+    s21::bitset_vector copy(bits);
+    copy.push_back(true);
+    ASSERT_EQ(bits.size(), 4U);
+    s21::bitset_vector moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 5U);
+    bits.swap(moved);
+    ASSERT_EQ(bits.size(), 5U);
+    ASSERT_EQ(moved.size(), 4U);
+    moved = bits;
+    ASSERT_EQ(moved, bits);
+}
@@ -0,0 +1,179 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_map.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Считает удаления, чтобы проверить отложенное освобождение памяти
+struct Tracked {
+    static inline std::atomic<int> destroyed{0};
+    ~Tracked() {
+        ++destroyed;
+    }
+};
+
+// Выровнен сильнее, чем гарантирует обычный operator new; запоминает,
+// если его создали по невыровненному адресу. Конструктора по умолчанию
+// нет: голова списка не создает значение
+struct alignas(64) Wide {
+    static inline std::atomic<bool> misaligned{false};
+
+    explicit Wide(int value) : value(value) {
+        Check();
+    }
+    Wide(const Wide &other) : value(other.value) {
+        Check();
+    }
+    Wide &operator=(const Wide &) = default;
+
+    void Check() const {
+        if (reinterpret_cast<std::uintptr_t>(this) % alignof(Wide) != 0) {
+            misaligned = true;
+        }
+    }
+
+    int value = 0;
+};
+
+}  // namespace
+
+TEST(ConcurrentMap, single_thread) {
+    s21::concurrent_map<int, int> m{{5, 50}, {1, 10}, {3, 30}};
+
+    ASSERT_EQ(m.size(), 3U);
+    ASSERT_FALSE(m.insert(3, 0));
+    ASSERT_TRUE(m.insert(4, 40));
+    ASSERT_EQ(m.find(3), 30);
+    ASSERT_EQ(m.find(2), std::nullopt);
+    ASSERT_TRUE(m.contains(4));
+
+    auto bound = m.lower_bound(2);
+    ASSERT_TRUE(bound.has_value());
+    ASSERT_EQ(bound->first, 3);
+    ASSERT_EQ(m.lower_bound(6), std::nullopt);
+
+    ASSERT_TRUE(m.erase(3));
+    ASSERT_FALSE(m.erase(3));
+    ASSERT_EQ(m.lower_bound(2)->first, 4);
+    ASSERT_EQ(m.size(), 3U);
+}
+
+TEST(ConcurrentMap, over_aligned_values) {
+    {
+        s21::concurrent_map<int, Wide> m;
+        for (int i = 0; i < 200; ++i) {
+            ASSERT_TRUE(m.insert(i, Wide(i)));
+        }
+        ASSERT_EQ(m.find(150)->value, 150);
+        for (int i = 0; i < 200; i += 2) {
+            ASSERT_TRUE(m.erase(i));
+        }
+        ASSERT_EQ(m.size(), 100U);
+    }
+    ASSERT_FALSE(Wide::misaligned);
+}
+
+TEST(ConcurrentMap, concurrent_writers_and_readers) {
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 5000;
+    s21::concurrent_map<int, int> m;
+    std::atomic<bool> done{false};
+
+    std::thread reader([&] {
+        while (!done) {
+            for (int key = 0; key < kThreads * kPerThread; key += 97) {
+                auto value = m.find(key);
+                if (value.has_value()) {
+                    ASSERT_EQ(*value, key * 2);
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kThreads; ++t) {
+        writers.emplace_back([&m, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                int key = i * kThreads + t;
+                m.insert(key, key * 2);
+            }
+            // Удаляем нечетные ключи, пока соседние потоки ещё вставляют
+            for (int i = 0; i < kPerThread; ++i) {
+                int key = i * kThreads + t;
+                if (key % 2 == 1) {
+                    ASSERT_TRUE(m.erase(key));
+                }
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(m.size(), static_cast<std::size_t>(kThreads * kPerThread / 2));
+    for (int key = 0; key < kThreads * kPerThread; ++key) {
+        ASSERT_EQ(m.contains(key), key % 2 == 0);
+    }
+}
+
+TEST(ConcurrentMap, racing_erase_removes_once) {
+    s21::concurrent_map<int, int> m;
+    for (int key = 0; key < 2000; ++key) {
+        m.insert(key, key);
+    }
+
+    std::atomic<int> erased{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int key = 0; key < 2000; ++key) {
+                if (m.erase(key)) {
+                    ++erased;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(erased, 2000);
+    ASSERT_TRUE(m.empty());
+}
+
+TEST(EpochDomain, retired_objects_wait_for_pinned_threads) {
+    s21::EpochDomain &domain = s21::EpochDomain::Global();
+    int before = Tracked::destroyed;
+
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+    std::thread reader([&] {
+        s21::EpochDomain::Guard guard;
+        pinned = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+    while (!pinned) {
+        std::this_thread::yield();
+    }
+
+    domain.Retire(new Tracked);
+    for (int i = 0; i < 5; ++i) {
+        domain.Collect();
+    }
+    // Читатель закреплен - объект нельзя удалять
+    ASSERT_EQ(Tracked::destroyed, before);
+
+    release = true;
+    reader.join();
+    for (int i = 0; i < 5; ++i) {
+        domain.Collect();
+    }
+    ASSERT_EQ(Tracked::destroyed, before + 1);
+}
@@ -0,0 +1,107 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_stack.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Считает живые объекты, чтобы проверить удаление элементов стека
+struct Counted {
+    static inline std::atomic<int> alive{0};
+    Counted() noexcept {
+        ++alive;
+    }
+    Counted(const Counted &) noexcept {
+        ++alive;
+    }
+    Counted &operator=(const Counted &) noexcept = default;
+    ~Counted() {
+        --alive;
+    }
+};
+
+// Потоки кладут и снимают числа вперемешку; в итоге каждое число должно быть
+// снято ровно один раз
+void PushPopOnce(std::size_t elimination_slots) {
+    constexpr int kThreads = 6;
+    constexpr int kPerThread = 20000;
+    s21::concurrent_stack<int> stack(elimination_slots);
+    std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&stack, &seen, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                stack.push(t * kPerThread + i);
+                int value = -1;
+                if (stack.try_pop(value)) {
+                    seen[value].fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    int value = -1;
+    while (stack.try_pop(value)) {
+        seen[value].fetch_add(1);
+    }
+    for (auto &count : seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+}  // namespace
+
+TEST(ConcurrentStack, single_thread) {
+    s21::concurrent_stack<std::string> stack;
+    ASSERT_TRUE(stack.empty());
+    std::string value = "unchanged";
+    ASSERT_FALSE(stack.try_pop(value));
+    ASSERT_EQ(value, "unchanged");
+
+    stack.push("a");
+    std::string b = "b";
+    stack.push(b);
+    stack.emplace(3, 'c');
+    ASSERT_FALSE(stack.empty());
+
+    ASSERT_TRUE(stack.try_pop(value));
+    ASSERT_EQ(value, "ccc");
+    ASSERT_TRUE(stack.try_pop(value));
+    ASSERT_EQ(value, "b");
+    ASSERT_TRUE(stack.try_pop(value));
+    ASSERT_EQ(value, "a");
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(ConcurrentStack, move_only_elements) {
+    s21::concurrent_stack<std::unique_ptr<int>> stack;
+    stack.push(std::make_unique<int>(7));
+    std::unique_ptr<int> out;
+    ASSERT_TRUE(stack.try_pop(out));
+    ASSERT_EQ(*out, 7);
+}
+
+TEST(ConcurrentStack, destroys_remaining_elements) {
+    {
+        s21::concurrent_stack<Counted> stack;
+        Counted item;
+        stack.push(item);
+        stack.push(item);
+        ASSERT_EQ(Counted::alive.load(), 3);
+    }
+    ASSERT_EQ(Counted::alive.load(), 0);
+}
+
+TEST(ConcurrentStack, concurrent_push_pop) {
+    PushPopOnce(4);
+}
+
+TEST(ConcurrentStack, concurrent_push_pop_without_elimination) {
+    PushPopOnce(0);
+}
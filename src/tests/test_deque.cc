@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Throws from the copy constructor once the counter runs out
+struct Fragile {
+    static inline int copies_left = 0;
+
+    explicit Fragile(std::shared_ptr<int> owner) : owner(std::move(owner)) {
+    }
+    Fragile(const Fragile &other) : owner(other.owner) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("Fragile copy");
+        }
+    }
+    Fragile &operator=(const Fragile &) = default;
+
+    std::shared_ptr<int> owner;
+};
+
+struct alignas(256) Wide {
+    int value = 0;
+};
+
+bool IsAligned(const void *pointer, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(Deque, push_pop_both_ends) {
+    s21::deque<int> d;
+    ASSERT_TRUE(d.empty());
+    ASSERT_EQ(d.capacity(), 0U);
+
+    for (int i = 0; i < 5; ++i) {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    ASSERT_EQ(d.size(), 10U);
+    ASSERT_EQ(d.front(), -5);
+    ASSERT_EQ(d.back(), 4);
+    ASSERT_EQ(std::vector<int>(d.begin(), d.end()),
+              (std::vector<int>{-5, -4, -3, -2, -1, 0, 1, 2, 3, 4}));
+    ASSERT_EQ(d[5], 0);
+    ASSERT_EQ(d.at(9), 4);
+    ASSERT_THROW(d.at(10), std::out_of_range);
+
+    d.pop_front();
+    d.pop_back();
+    ASSERT_EQ(d.front(), -4);
+    ASSERT_EQ(d.back(), 3);
+    ASSERT_EQ(d.size(), 8U);
+}
+
+TEST(Deque, wraps_around_without_reallocating) {
+    s21::deque<std::string> d;
+    d.reserve(8);
+    ASSERT_EQ(d.capacity(), 8U);
+    for (int round = 0; round < 100; ++round) {
+        d.push_back(std::to_string(round));
+        if (d.size() > 5) {
+            ASSERT_EQ(d.front(), std::to_string(round - 5));
+            d.pop_front();
+        }
+    }
+    ASSERT_EQ(d.capacity(), 8U);
+    ASSERT_EQ(d.front(), "95");
+    ASSERT_EQ(d.back(), "99");
+}
+
+TEST(Deque, matches_std_deque) {
+    std::mt19937 generator(3);
+    s21::deque<std::string> d;
+    std::deque<std::string> expected;
+    for (int step = 0; step < 20000; ++step) {
+        int action = static_cast<int>(generator() % 6);
+        std::string value = std::to_string(step);
+        if (action < 2) {
+            d.push_back(value);
+            expected.push_back(value);
+        } else if (action < 4) {
+            d.push_front(value);
+            expected.push_front(value);
+        } else if (!expected.empty() && action == 4) {
+            d.pop_back();
+            expected.pop_back();
+        } else if (!expected.empty()) {
+            d.pop_front();
+            expected.pop_front();
+        }
+        ASSERT_EQ(d.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(d.front(), expected.front());
+            ASSERT_EQ(d.back(), expected.back());
+        }
+    }
+    ASSERT_TRUE(std::equal(d.begin(), d.end(), expected.begin(),
+                           expected.end()));
+}
+
+TEST(Deque, copy_move_and_iterators) {
+    s21::deque<int> d{3, 1, 2};
+    d.push_front(5);
+
+    s21::deque<int> copy(d);
+    std::sort(copy.begin(), copy.end());
+    ASSERT_EQ(std::vector<int>(copy.begin(), copy.end()),
+              (std::vector<int>{1, 2, 3, 5}));
+    ASSERT_EQ(d.front(), 5);
+
+    s21::deque<int>::const_iterator it = d.begin();
+    ASSERT_EQ(d.end() - it, 4);
+    ASSERT_EQ(it[2], 1);
+    ASSERT_TRUE(it + 4 == d.end());
+
+    s21::deque<int> moved(std::move(d));
+    ASSERT_TRUE(d.empty());
+    ASSERT_EQ(moved.size(), 4U);
+    d = moved;
+    ASSERT_EQ(d.size(), 4U);
+    ASSERT_EQ(d.back(), 2);
+
+    // Pushing an element of the deque itself while the buffer grows
+    s21::deque<std::string> strings(8);
+    strings.front() = "x";
+    strings.push_back(strings.front());
+    ASSERT_EQ(strings.back(), "x");
+    ASSERT_EQ(strings.capacity(), 16U);
+}
+
+TEST(Deque, emplace_constructs_one_element) {
+    s21::deque<std::string> d;
+    std::string &back = d.emplace_back(3, 'b');
+    ASSERT_EQ(back, "bbb");
+    ASSERT_EQ(d.emplace_front("a"), "a");
+    // Enough to reallocate while constructing from an own element
+    for (int i = 0; i < 20; ++i) {
+        d.emplace_back(d.front(), 0, 1);
+    }
+    ASSERT_EQ(d.size(), 22U);
+    ASSERT_EQ(d.back(), "a");
+    ASSERT_EQ(d[1], "bbb");
+}
+
+TEST(Deque, throwing_constructor_releases_elements) {
+    auto shared = std::make_shared<int>(1);
+    Fragile::copies_left = 1000;
+    s21::deque<Fragile> items;
+    for (int i = 0; i < 20; ++i) {
+        items.push_back(Fragile(shared));
+    }
+    ASSERT_EQ(shared.use_count(), 21);
+
+    Fragile::copies_left = 10;
+    ASSERT_THROW(s21::deque<Fragile> copy(items), std::runtime_error);
+    ASSERT_EQ(shared.use_count(), 21);
+
+    // The first element is copied into the deque, the second copy throws
+    Fragile::copies_left = 1;
+    using Items = s21::deque<Fragile>;
+    ASSERT_THROW(Items({Fragile(shared), Fragile(shared)}),
+                 std::runtime_error);
+    ASSERT_EQ(shared.use_count(), 21);
+}
+
+TEST(Deque, over_aligned_elements) {
+    s21::deque<Wide> wide;
+    for (int i = 0; i < 100; ++i) {
+        wide.push_back(Wide{i});
+        ASSERT_TRUE(IsAligned(&wide.back(), alignof(Wide)));
+    }
+    ASSERT_EQ(wide[99].value, 99);
+
+    s21::queue<s21::cache_padded<long>> counters;
+    for (int i = 0; i < 40; ++i) {
+        counters.emplace(i);
+        ASSERT_TRUE(IsAligned(&counters.back(), s21::kCacheLineSize));
+    }
+    ASSERT_EQ(*counters.front(), 0);
+}
@@ -0,0 +1,126 @@
+#include <utility>
+#include <vector>
+
+#include "../s21_intrusive_list.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Объект арены, который одновременно состоит в двух списках: через базовый
+// хук и через хук-поле
+struct Job : s21::intrusive_list_hook {
+    explicit Job(int id) : id(id) {
+    }
+
+    int id;
+    s21::intrusive_list_hook by_owner;
+};
+
+using OwnerList = s21::intrusive_list<
+    Job, s21::intrusive_member_hook<Job, s21::intrusive_list_hook,
+                                    &Job::by_owner>>;
+
+template <typename List>
+std::vector<int> Ids(const List &l) {
+    std::vector<int> ids;
+    for (const Job &job : l) {
+        ids.push_back(job.id);
+    }
+    return ids;
+}
+
+}  // namespace
+
+TEST(IntrusiveList, link_objects_without_copies) {
+    std::vector<Job> arena;
+    for (int id = 0; id < 5; ++id) {
+        arena.emplace_back(id);
+    }
+
+    s21::intrusive_list<Job> queue;
+    OwnerList owned;
+    for (Job &job : arena) {
+        queue.push_back(job);
+        owned.push_front(job);
+    }
+    ASSERT_EQ(queue.size(), 5U);
+    ASSERT_EQ(Ids(queue), (std::vector<int>{0, 1, 2, 3, 4}));
+    ASSERT_EQ(Ids(owned), (std::vector<int>{4, 3, 2, 1, 0}));
+    ASSERT_EQ(&queue.front(), &arena[0]);
+
+    // Удаление по объекту за O(1), второй список не затрагивается
+    queue.erase(arena[2]);
+    ASSERT_FALSE(arena[2].is_linked());
+    ASSERT_TRUE(arena[2].by_owner.is_linked());
+    ASSERT_EQ(Ids(queue), (std::vector<int>{0, 1, 3, 4}));
+    ASSERT_EQ(owned.size(), 5U);
+
+    // LRU: объект в конец очереди
+    queue.splice(queue.end(), queue, queue.iterator_to(arena[0]));
+    ASSERT_EQ(Ids(queue), (std::vector<int>{1, 3, 4, 0}));
+
+    queue.pop_front();
+    queue.pop_back();
+    ASSERT_EQ(Ids(queue), (std::vector<int>{3, 4}));
+    ASSERT_FALSE(arena[0].is_linked());
+
+    owned.clear();
+    for (const Job &job : arena) {
+        ASSERT_FALSE(job.by_owner.is_linked());
+    }
+}
+
+TEST(IntrusiveList, move_and_swap) {
+    Job a(1), b(2), c(3);
+    s21::intrusive_list<Job> l1;
+    l1.push_back(a);
+    l1.push_back(b);
+
+    s21::intrusive_list<Job> l2(std::move(l1));
+    ASSERT_TRUE(l1.empty());
+    ASSERT_EQ(Ids(l2), (std::vector<int>{1, 2}));
+
+    l1.push_back(c);
+    l1.swap(l2);
+    ASSERT_EQ(Ids(l1), (std::vector<int>{1, 2}));
+    ASSERT_EQ(Ids(l2), (std::vector<int>{3}));
+
+    l2.splice(l2.begin(), l1);
+    ASSERT_EQ(Ids(l2), (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(l2.size(), 3U);
+    ASSERT_EQ(l2.back().id, 3);
+
+    // Копия объекта не связана ни с каким списком
+    Job copy = b;
+    ASSERT_FALSE(copy.is_linked());
+}
+
+TEST(IntrusiveList, splice_element_onto_itself) {
+    Job a(1), b(2), c(3);
+    s21::intrusive_list<Job> l;
+    l.push_back(a);
+    l.push_back(b);
+    l.push_back(c);
+
+    // pos == it и pos == next(it) - ничего не меняется, как в std::list
+    l.splice(l.begin(), l, l.begin());
+    l.splice(l.iterator_to(c), l, l.iterator_to(b));
+    ASSERT_EQ(Ids(l), (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(l.size(), 3U);
+
+    l.splice(l.begin(), l, l.iterator_to(c));
+    ASSERT_EQ(Ids(l), (std::vector<int>{3, 1, 2}));
+    l.clear();
+    ASSERT_FALSE(a.is_linked());
+}
+
+TEST(IntrusiveList, member_hook_maps_back_to_object) {
+    using Traits = s21::intrusive_member_hook<Job, s21::intrusive_list_hook,
+                                              &Job::by_owner>;
+    Job job(7);
+    s21::intrusive_list_hook *hook = Traits::ToHook(job);
+    ASSERT_EQ(hook, &job.by_owner);
+    ASSERT_EQ(Traits::ToValue(hook), &job);
+    const s21::intrusive_list_hook *const_hook = hook;
+    ASSERT_EQ(Traits::ToValue(const_hook)->id, 7);
+}
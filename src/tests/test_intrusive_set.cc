@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../s21_intrusive_tree.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+struct Timer : s21::intrusive_set_hook {
+    Timer(int deadline, int id) : deadline(deadline), id(id) {
+    }
+
+    int deadline;
+    int id;
+    s21::intrusive_set_hook by_id;
+};
+
+struct ByDeadline {
+    bool operator()(const Timer &lhs, const Timer &rhs) const {
+        return lhs.deadline < rhs.deadline;
+    }
+};
+
+struct ById {
+    bool operator()(const Timer &lhs, const Timer &rhs) const {
+        return lhs.id < rhs.id;
+    }
+};
+
+// Поиск по сроку без создания объекта Timer
+struct DeadlineKey {
+    bool operator()(const Timer &timer, int deadline) const {
+        return timer.deadline < deadline;
+    }
+    bool operator()(int deadline, const Timer &timer) const {
+        return deadline < timer.deadline;
+    }
+};
+
+using TimersById = s21::intrusive_set<
+    Timer, ById,
+    s21::intrusive_member_hook<Timer, s21::intrusive_set_hook, &Timer::by_id>>;
+
+}  // namespace
+
+TEST(IntrusiveSet, two_indexes_over_one_arena) {
+    std::vector<Timer> arena;
+    for (int id = 0; id < 6; ++id) {
+        arena.emplace_back((id * 7) % 5, id);
+    }
+
+    s21::intrusive_multiset<Timer, ByDeadline> by_deadline;
+    TimersById by_id;
+    for (Timer &timer : arena) {
+        by_deadline.insert(timer);
+        ASSERT_TRUE(by_id.insert(timer).second);
+    }
+    Timer twin(9, 3);
+    auto duplicate = by_id.insert(twin);
+    ASSERT_FALSE(duplicate.second);
+    ASSERT_EQ(&*duplicate.first, &arena[3]);
+    ASSERT_FALSE(twin.by_id.is_linked());
+
+    // Равные сроки идут в порядке вставки
+    std::vector<std::pair<int, int>> order;
+    for (const Timer &timer : by_deadline) {
+        order.emplace_back(timer.deadline, timer.id);
+    }
+    ASSERT_EQ(order, (std::vector<std::pair<int, int>>{
+                         {0, 0}, {0, 5}, {1, 3}, {2, 1}, {3, 4}, {4, 2}}));
+
+    auto found = by_id.find(Timer(0, 4));
+    ASSERT_NE(found, by_id.end());
+    ASSERT_EQ(&*found, &arena[4]);
+    ASSERT_EQ(by_deadline.lower_bound(Timer(2, 0))->id, 1);
+    ASSERT_EQ(by_deadline.upper_bound(Timer(0, 0))->id, 3);
+
+    by_deadline.erase(arena[0]);
+    ASSERT_FALSE(arena[0].is_linked());
+    ASSERT_TRUE(arena[0].by_id.is_linked());
+    ASSERT_EQ(by_deadline.begin()->id, 5);
+    ASSERT_EQ(by_deadline.size(), 5U);
+}
+
+TEST(IntrusiveSet, const_lookup_by_key) {
+    std::vector<Timer> arena;
+    for (int id = 0; id < 10; ++id) {
+        arena.emplace_back(id * 10, id);
+    }
+    s21::intrusive_multiset<Timer, ByDeadline> timers;
+    for (Timer &timer : arena) {
+        timers.insert(timer);
+    }
+
+    const auto &view = timers;
+    ASSERT_EQ(&*view.find(30, DeadlineKey{}), &arena[3]);
+    ASSERT_EQ(view.find(35, DeadlineKey{}), view.end());
+    ASSERT_TRUE(view.contains(90, DeadlineKey{}));
+    ASSERT_FALSE(view.contains(Timer(91, 0)));
+    ASSERT_EQ(view.lower_bound(35, DeadlineKey{})->id, 4);
+    ASSERT_EQ(view.upper_bound(40, DeadlineKey{})->id, 5);
+    ASSERT_EQ(view.upper_bound(90, DeadlineKey{}), view.end());
+    ASSERT_EQ(view.find(Timer(60, 0))->id, 6);
+    ASSERT_EQ(view.lower_bound(Timer(0, 0)), view.begin());
+
+    auto it = timers.find(20, DeadlineKey{});
+    timers.erase(it);
+    ASSERT_FALSE(arena[2].is_linked());
+    ASSERT_EQ(timers.lower_bound(15, DeadlineKey{})->id, 3);
+}
+
+TEST(IntrusiveSet, matches_std_multiset) {
+    std::mt19937 generator(5);
+    std::vector<Timer> arena;
+    for (int id = 0; id < 3000; ++id) {
+        arena.emplace_back(static_cast<int>(generator() % 500), id);
+    }
+
+    s21::intrusive_multiset<Timer, ByDeadline> timers;
+    std::multiset<std::pair<int, int>> expected;
+    for (int round = 0; round < 3; ++round) {
+        for (Timer &timer : arena) {
+            if (!timer.is_linked()) {
+                timers.insert(timer);
+                expected.emplace(timer.deadline, timer.id);
+            } else if (generator() % 2 == 0) {
+                timers.erase(timer);
+                expected.erase({timer.deadline, timer.id});
+            }
+        }
+        ASSERT_EQ(timers.size(), expected.size());
+
+        std::vector<int> deadlines;
+        for (const Timer &timer : timers) {
+            deadlines.push_back(timer.deadline);
+        }
+        ASSERT_TRUE(std::is_sorted(deadlines.begin(), deadlines.end()));
+        std::vector<int> expected_deadlines;
+        for (const auto &item : expected) {
+            expected_deadlines.push_back(item.first);
+        }
+        ASSERT_EQ(deadlines, expected_deadlines);
+    }
+
+    auto it = timers.begin();
+    while (it != timers.end()) {
+        it = timers.erase(it);
+    }
+    ASSERT_TRUE(timers.empty());
+    ASSERT_EQ(timers.begin(), timers.end());
+}
+
+TEST(IntrusiveSet, move_and_clear) {
+    Timer a(3, 0), b(1, 1), c(2, 2);
+    s21::intrusive_set<Timer, ByDeadline> s1;
+    s1.insert(a);
+    s1.insert(b);
+
+    s21::intrusive_set<Timer, ByDeadline> s2(std::move(s1));
+    ASSERT_TRUE(s1.empty());
+    ASSERT_EQ(s2.size(), 2U);
+    ASSERT_EQ(s2.begin()->id, 1);
+    ASSERT_EQ((--s2.end())->id, 0);
+
+    s1.insert(c);
+    s1.swap(s2);
+    ASSERT_EQ(s1.size(), 2U);
+    ASSERT_EQ(s2.begin()->id, 2);
+
+    s1.clear();
+    ASSERT_FALSE(a.is_linked());
+    ASSERT_FALSE(b.is_linked());
+    ASSERT_TRUE(c.is_linked());
+}
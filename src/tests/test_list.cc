@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_list.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+template <typename List>
+std::vector<typename List::value_type> ToVector(const List &l) {
+    return std::vector<typename List::value_type>(l.begin(), l.end());
+}
+
+// Counts its copies; constructible from several arguments
+struct Tracked {
+    Tracked() = default;
+    Tracked(int a, int b) : value(a * 10 + b) {
+    }
+    Tracked(const Tracked &other) : value(other.value) {
+        ++copies;
+    }
+    Tracked(Tracked &&other) noexcept : value(other.value) {
+    }
+    Tracked &operator=(const Tracked &other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    Tracked &operator=(Tracked &&other) noexcept {
+        value = other.value;
+        return *this;
+    }
+
+    int value = 0;
+    static inline int copies = 0;
+};
+
+}  // namespace
+
+TEST(List, extract_and_insert_node) {
+    s21::list<std::string> l1{"a", "b", "c"};
+    s21::list<std::string> l2{"x"};
+    const std::string *address = &*(++l1.begin());
+
+    auto node = l1.extract(++l1.begin());
+    ASSERT_EQ(node.value(), "b");
+    ASSERT_EQ(l1.size(), 2U);
+
+    auto it = l2.insert(l2.begin(), std::move(node));
+    ASSERT_TRUE(node.empty());
+    ASSERT_EQ(&*it, address);
+    ASSERT_EQ(ToVector(l2), (std::vector<std::string>{"b", "x"}));
+
+    // Перенос в конец того же списка (LRU): без выделения памяти
+    l1.insert(l1.end(), l1.extract(l1.begin()));
+    ASSERT_EQ(ToVector(l1), (std::vector<std::string>{"c", "a"}));
+
+    ASSERT_TRUE(l1.extract(l1.end()).empty());
+    it = l1.insert(l1.begin(), s21::list<std::string>::node_handle{});
+    ASSERT_EQ(it, l1.begin());
+    ASSERT_EQ(l1.size(), 2U);
+}
+
+TEST(List, sort_matches_std_stable_sort) {
+    std::mt19937 generator(7);
+    for (int size : {0, 1, 2, 3, 17, 1000, 4099}) {
+        std::uniform_int_distribution<int> value(0, size / 4 + 1);
+        std::vector<std::pair<int, int>> items;
+        for (int i = 0; i < size; ++i) {
+            items.emplace_back(value(generator), i);
+        }
+
+        s21::list<std::pair<int, int>> l;
+        for (const auto &item : items) {
+            l.push_back(item);
+        }
+        auto by_first = [](const auto &lhs, const auto &rhs) {
+            return lhs.first < rhs.first;
+        };
+        l.sort(by_first);
+        std::stable_sort(items.begin(), items.end(), by_first);
+
+        ASSERT_EQ(ToVector(l), items);
+        ASSERT_EQ(l.size(), items.size());
+        // Обратный обход тоже корректен (восстановлены ссылки prev_)
+        std::vector<std::pair<int, int>> reversed;
+        for (auto it = l.end(); it != l.begin();) {
+            reversed.push_back(*--it);
+        }
+        ASSERT_TRUE(std::equal(reversed.rbegin(), reversed.rend(),
+                               items.begin(), items.end()));
+    }
+}
+
+TEST(List, sort_keeps_nodes) {
+    s21::list<int> l{5, 3, 9, 1};
+    const int *address = &l.front();
+    l.sort();
+    ASSERT_EQ(ToVector(l), (std::vector<int>{1, 3, 5, 9}));
+    ASSERT_EQ(&*(++(++l.begin())), address);
+
+    l.sort(std::greater<int>());
+    ASSERT_EQ(ToVector(l), (std::vector<int>{9, 5, 3, 1}));
+}
+
+TEST(List, sort_throwing_comparator_keeps_elements) {
+    std::mt19937 gen(11);
+    std::vector<int> items(1000);
+    for (int &item : items) {
+        item = static_cast<int>(gen() % 300);
+    }
+    std::vector<int> expected(items);
+    std::sort(expected.begin(), expected.end());
+
+    for (int throw_at : {1, 7, 500, 5000}) {
+        s21::list<int> l;
+        l.append_range(items.begin(), items.end());
+        int calls = 0;
+        auto comp = [&calls, throw_at](int a, int b) {
+            if (++calls == throw_at) {
+                throw std::runtime_error("comparator");
+            }
+            return a < b;
+        };
+        ASSERT_THROW(l.sort(comp), std::runtime_error);
+        ASSERT_EQ(l.size(), items.size());
+
+        std::vector<int> forward = ToVector(l);
+        std::vector<int> backward;
+        for (auto it = l.end(); it != l.begin();) {
+            backward.push_back(*--it);
+        }
+        std::reverse(backward.begin(), backward.end());
+        ASSERT_EQ(forward, backward);
+        std::sort(forward.begin(), forward.end());
+        ASSERT_EQ(forward, expected);
+
+        l.sort();
+        ASSERT_EQ(ToVector(l), expected);
+    }
+}
+
+TEST(List, merge_with_comparator) {
+    s21::list<int> l1{9, 5, 1};
+    s21::list<int> l2{8, 5, 2};
+    l1.merge(l2, std::greater<int>());
+    ASSERT_EQ(ToVector(l1), (std::vector<int>{9, 8, 5, 5, 2, 1}));
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 6U);
+}
+
+TEST(List, unique_with_predicate) {
+    s21::list<int> l{1, 2, 4, 5, 7, 10, 11, 12, 20};
+    // Удаляются элементы, отличающиеся от оставленного меньше чем на 3
+    auto removed = l.unique([](int kept, int x) { return x - kept < 3; });
+    ASSERT_EQ(removed, 4U);
+    ASSERT_EQ(ToVector(l), (std::vector<int>{1, 4, 7, 10, 20}));
+    ASSERT_EQ(l.size(), 5U);
+
+    s21::list<int> repeated{1, 1, 2, 2, 1, 2, 2};
+    ASSERT_EQ(repeated.unique(), 3U);
+    ASSERT_EQ(ToVector(repeated), (std::vector<int>{1, 2, 1, 2}));
+}
+
+TEST(List, remove_if_unlinks_runs) {
+    s21::list<int> l{2, 4, 1, 6, 8, 10, 3, 5, 12};
+    const int *kept = &*(++(++l.begin()));
+    auto removed = l.remove_if([](int x) { return x % 2 == 0; });
+    ASSERT_EQ(removed, 6U);
+    ASSERT_EQ(ToVector(l), (std::vector<int>{1, 3, 5}));
+    ASSERT_EQ(l.size(), 3U);
+    ASSERT_EQ(&l.front(), kept);
+    ASSERT_EQ(*--l.end(), 5);
+
+    ASSERT_EQ(l.remove_if([](int) { return true; }), 3U);
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(l.begin(), l.end());
+    ASSERT_EQ(l.remove_if([](int) { return true; }), 0U);
+}
+
+TEST(List, remove_value_from_own_element) {
+    s21::list<std::string> l{"a", "b", "a", "a", "c", "a"};
+    // Аргумент ссылается на удаляемый элемент списка
+    ASSERT_EQ(l.remove(l.front()), 4U);
+    ASSERT_EQ(ToVector(l), (std::vector<std::string>{"b", "c"}));
+}
+
+TEST(List, remove_if_throwing_predicate) {
+    s21::list<int> l{1, 2, 3, 4, 5};
+    ASSERT_THROW(l.remove_if([](int x) {
+        if (x == 4) {
+            throw std::runtime_error("stop");
+        }
+        return x < 3;
+    }),
+                 std::runtime_error);
+    ASSERT_EQ(ToVector(l), (std::vector<int>{3, 4, 5}));
+    ASSERT_EQ(l.size(), 3U);
+}
+
+TEST(List, splice_single_node) {
+    s21::list<int> l1{1, 2, 3};
+    s21::list<int> l2{10, 20};
+    const int *address = &*(++l1.begin());
+
+    l2.splice(l2.end(), l1, ++l1.begin());
+    ASSERT_EQ(ToVector(l1), (std::vector<int>{1, 3}));
+    ASSERT_EQ(ToVector(l2), (std::vector<int>{10, 20, 2}));
+    ASSERT_EQ(l1.size(), 2U);
+    ASSERT_EQ(l2.size(), 3U);
+    ASSERT_EQ(&*(--l2.end()), address);
+
+    // Перестановка внутри одного списка (LRU: в начало)
+    l2.splice(l2.begin(), l2, --l2.end());
+    ASSERT_EQ(ToVector(l2), (std::vector<int>{2, 10, 20}));
+    l2.splice(l2.begin(), l2, l2.begin());
+    l2.splice(++l2.begin(), l2, l2.begin());
+    ASSERT_EQ(ToVector(l2), (std::vector<int>{2, 10, 20}));
+    ASSERT_EQ(l2.size(), 3U);
+}
+
+TEST(List, splice_range) {
+    s21::list<int> l1{1, 2, 3, 4, 5};
+    s21::list<int> l2{10, 20};
+
+    auto first = ++l1.begin();
+    auto last = first;
+    std::advance(last, 3);
+    l2.splice(++l2.begin(), l1, first, last);
+    ASSERT_EQ(ToVector(l1), (std::vector<int>{1, 5}));
+    ASSERT_EQ(ToVector(l2), (std::vector<int>{10, 2, 3, 4, 20}));
+    ASSERT_EQ(l1.size(), 2U);
+    ASSERT_EQ(l2.size(), 5U);
+
+    // Известное количество - без обхода диапазона
+    l1.splice(l1.end(), l2, l2.begin(), l2.end(), 5);
+    ASSERT_EQ(ToVector(l1), (std::vector<int>{1, 5, 10, 2, 3, 4, 20}));
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 7U);
+
+    // Диапазон внутри одного списка: [10, 2] в начало
+    first = l1.begin();
+    std::advance(first, 2);
+    last = first;
+    std::advance(last, 2);
+    l1.splice(l1.begin(), l1, first, last);
+    ASSERT_EQ(ToVector(l1), (std::vector<int>{10, 2, 1, 5, 3, 4, 20}));
+    ASSERT_EQ(l1.size(), 7U);
+    l1.splice(l1.end(), l1, l1.end(), l1.end());
+    std::vector<int> backward;
+    for (auto it = l1.end(); it != l1.begin();) {
+        backward.push_back(*--it);
+    }
+    ASSERT_EQ(backward, (std::vector<int>{20, 4, 3, 5, 1, 2, 10}));
+}
+
+TEST(List, rvalue_push_and_emplace_do_not_copy) {
+    Tracked::copies = 0;
+    s21::list<Tracked> l;
+    l.push_back(Tracked(1, 2));
+    l.push_front(Tracked(0, 1));
+    Tracked &back = l.emplace_back(3, 4);
+    Tracked &front = l.emplace_front(0, 0);
+    l.insert(++l.begin(), Tracked(5, 5));
+    ASSERT_EQ(Tracked::copies, 0);
+    ASSERT_EQ(back.value, 34);
+    ASSERT_EQ(front.value, 0);
+    ASSERT_EQ(l.size(), 5U);
+
+    auto it = l.emplace(l.end(), 9, 9);
+    ASSERT_EQ((*it).value, 99);
+    std::vector<int> values;
+    for (const auto &item : l) {
+        values.push_back(item.value);
+    }
+    ASSERT_EQ(values, (std::vector<int>{0, 55, 1, 12, 34, 99}));
+
+    Tracked lvalue(7, 7);
+    l.push_back(lvalue);
+    ASSERT_EQ(Tracked::copies, 1);
+}
+
+TEST(List, append_range_and_pop_n) {
+    s21::list<int> l{1, 2};
+    std::vector<int> more{3, 4, 5, 6};
+    l.append_range(more.begin(), more.end());
+    ASSERT_EQ(ToVector(l), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+    l.pop_front_n(2);
+    l.pop_back_n(1);
+    l.pop_front_n(0);
+    ASSERT_EQ(ToVector(l), (std::vector<int>{3, 4, 5}));
+    ASSERT_EQ(l.size(), 3U);
+    l.pop_back_n(3);
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(l.begin(), l.end());
+}
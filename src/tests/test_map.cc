@@ -0,0 +1,141 @@
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_map.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+template <typename Map>
+std::vector<std::pair<int, std::string>> ToVector(const Map &m) {
+    std::vector<std::pair<int, std::string>> result;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+        result.emplace_back((*it).first, (*it).second);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(Map, range_constructor_keeps_first) {
+    std::vector<std::pair<int, std::string>> items{
+        {3, "three"}, {1, "one"}, {3, "drei"}, {2, "two"}, {1, "eins"}};
+    s21::map<int, std::string> m(items.begin(), items.end());
+
+    ASSERT_EQ(m.size(), 3U);
+    ASSERT_EQ(m.at(1), "one");
+    ASSERT_EQ(m.at(2), "two");
+    ASSERT_EQ(m.at(3), "three");
+}
+
+TEST(Map, range_constructor_parallel) {
+    s21::ThreadPool pool(4);
+    std::vector<std::pair<int, std::string>> items;
+    std::map<int, std::string> expected;
+    for (int i = 0; i < 100000; ++i) {
+        int key = (i * 7919) % 65536;
+        items.emplace_back(key, std::to_string(i));
+        expected.emplace(key, std::to_string(i));
+    }
+    s21::map<int, std::string> m(items.begin(), items.end(),
+                                 s21::parallel_policy(pool));
+    ASSERT_EQ(ToVector(m), ToVector(expected));
+}
+
+TEST(Map, merge_parallel) {
+    s21::ThreadPool pool(3);
+    s21::map<int, std::string> m1{{1, "a"}, {3, "c"}};
+    s21::map<int, std::string> m2{{2, "b"}, {3, "x"}, {4, "d"}};
+    m1.merge(m2, s21::parallel_policy(pool));
+
+    ASSERT_EQ(ToVector(m1), (std::vector<std::pair<int, std::string>>{
+                                {1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}}));
+    ASSERT_EQ(ToVector(m2),
+              (std::vector<std::pair<int, std::string>>{{3, "x"}}));
+}
+
+TEST(Map, set_algebra) {
+    s21::ThreadPool pool(2);
+    s21::map<int, std::string> m1{{1, "a"}, {2, "b"}, {3, "c"}};
+    s21::map<int, std::string> m2{{2, "x"}, {4, "y"}};
+    using items = std::vector<std::pair<int, std::string>>;
+
+    ASSERT_EQ(ToVector(m1.set_union(m2)),
+              (items{{1, "a"}, {2, "b"}, {3, "c"}, {4, "y"}}));
+    ASSERT_EQ(ToVector(m1.set_intersection(m2, s21::parallel_policy(pool))),
+              (items{{2, "b"}}));
+    ASSERT_EQ(ToVector(m1.set_difference(m2)), (items{{1, "a"}, {3, "c"}}));
+}
+
+TEST(Map, extract_rekey_without_allocation) {
+    s21::map<int, std::string> m{{1, "a"}, {2, "b"}, {3, "c"}};
+    const std::string *address = &m.at(1);
+
+    auto node = m.extract(1);
+    ASSERT_EQ(node.key(), 1);
+    ASSERT_EQ(node.mapped(), "a");
+    node.key() = 10;
+    node.mapped() += "!";
+    auto result = m.insert(std::move(node));
+
+    ASSERT_TRUE(result.inserted);
+    ASSERT_EQ(&m.at(10), address);
+    ASSERT_EQ(ToVector(m), (std::vector<std::pair<int, std::string>>{
+                               {2, "b"}, {3, "c"}, {10, "a!"}}));
+
+    s21::map<int, std::string> other{{2, "x"}};
+    result = other.insert(m.extract(m.begin()));
+    ASSERT_FALSE(result.inserted);
+    ASSERT_EQ(result.node.mapped(), "b");
+    ASSERT_EQ((*result.position).second, "x");
+    ASSERT_TRUE(m.extract(42).empty());
+}
+
+TEST(Map, try_emplace_constructs_only_on_miss) {
+    s21::map<int, std::unique_ptr<int>> m;
+    auto value = std::make_unique<int>(5);
+
+    auto result = m.try_emplace(1, std::move(value));
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(*(*result.first).second, 5);
+    ASSERT_EQ(value, nullptr);
+
+    // При попадании аргументы не перемещаются
+    value = std::make_unique<int>(7);
+    result = m.try_emplace(1, std::move(value));
+    ASSERT_FALSE(result.second);
+    ASSERT_NE(value, nullptr);
+    ASSERT_EQ(*(*result.first).second, 5);
+
+    s21::map<std::string, std::string> strings;
+    strings.try_emplace("key", 3, 'x');
+    ASSERT_EQ(strings.at("key"), "xxx");
+}
+
+TEST(Map, upsert_single_descent) {
+    s21::map<int, std::string> m;
+    for (int i = 0; i < 1000; ++i) {
+        m[i % 100] += "a";
+    }
+    ASSERT_EQ(m.size(), 100U);
+    ASSERT_EQ(m.at(42), std::string(10, 'a'));
+
+    auto result = m.insert_or_assign(42, "b");
+    ASSERT_FALSE(result.second);
+    ASSERT_EQ((*result.first).second, "b");
+    result = m.insert_or_assign(1000, "c");
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(m.at(1000), "c");
+    ASSERT_TRUE(m.contains(1000));
+    ASSERT_FALSE(m.contains(1001));
+    ASSERT_THROW(m.at(1001), std::out_of_range);
+
+    std::string key = "moved";
+    s21::map<std::string, int> counts;
+    ++counts[std::move(key)];
+    ++counts["moved"];
+    ASSERT_EQ(counts.at("moved"), 2);
+}
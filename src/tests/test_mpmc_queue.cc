@@ -0,0 +1,151 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_mpmc_queue.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Считает живые объекты, чтобы проверить удаление элементов очереди
+struct Counted {
+    static inline int alive = 0;
+    Counted() noexcept {
+        ++alive;
+    }
+    Counted(const Counted &) noexcept {
+        ++alive;
+    }
+    Counted &operator=(const Counted &) noexcept = default;
+    ~Counted() {
+        --alive;
+    }
+};
+
+// Конструктор может бросить исключение - элемент создается вне очереди
+struct MayThrow {
+    explicit MayThrow(int value) : value(value) {
+        if (value < 0) {
+            throw std::invalid_argument("negative");
+        }
+    }
+    int value;
+};
+
+// producers потоков кладут по count чисел, consumers потоков их забирают;
+// каждое число должно быть получено ровно один раз
+template <typename Wait>
+void TransferOnce(std::size_t capacity, int producers, int consumers,
+                  int count) {
+    s21::mpmc_queue<int, Wait> q(capacity);
+    std::vector<std::atomic<int>> seen(producers * count);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, p, count] {
+            for (int i = 0; i < count; ++i) {
+                q.push(p * count + i);
+            }
+        });
+    }
+    int total = producers * count;
+    for (int c = 0; c < consumers; ++c) {
+        int share = total / consumers + (c < total % consumers ? 1 : 0);
+        threads.emplace_back([&q, &seen, share] {
+            for (int i = 0; i < share; ++i) {
+                int value = -1;
+                q.pop(value);
+                seen[value].fetch_add(1);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &flag : seen) {
+        ASSERT_EQ(flag.load(), 1);
+    }
+    ASSERT_TRUE(q.empty());
+}
+
+}  // namespace
+
+TEST(MpmcQueue, single_thread) {
+    s21::mpmc_queue<std::string> q(3);
+    ASSERT_EQ(q.capacity(), 4U);
+    ASSERT_TRUE(q.empty());
+
+    std::string value = "unchanged";
+    ASSERT_FALSE(q.try_pop(value));
+    ASSERT_EQ(value, "unchanged");
+
+    q.push("a");
+    ASSERT_TRUE(q.try_push("b"));
+    ASSERT_TRUE(q.try_emplace(3, 'c'));
+    q.emplace("d");
+    ASSERT_FALSE(q.try_push("e"));
+    ASSERT_EQ(q.size_approx(), 4U);
+
+    ASSERT_TRUE(q.try_pop(value));
+    ASSERT_EQ(value, "a");
+    q.pop(value);
+    ASSERT_EQ(value, "b");
+    ASSERT_EQ(q.size_approx(), 2U);
+}
+
+TEST(MpmcQueue, wraps_around) {
+    s21::mpmc_queue<int> q(1);
+    ASSERT_EQ(q.capacity(), 2U);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(q.try_push(i));
+        ASSERT_TRUE(q.try_push(i + 1));
+        ASSERT_FALSE(q.try_push(0));
+        int value = 0;
+        q.pop(value);
+        ASSERT_EQ(value, i);
+        q.pop(value);
+        ASSERT_EQ(value, i + 1);
+        ASSERT_TRUE(q.empty());
+    }
+}
+
+TEST(MpmcQueue, throwing_constructor_leaves_queue_usable) {
+    s21::mpmc_queue<MayThrow> q(2);
+    ASSERT_THROW(q.emplace(-1), std::invalid_argument);
+    ASSERT_THROW(q.try_emplace(-1), std::invalid_argument);
+    ASSERT_TRUE(q.empty());
+    q.emplace(5);
+    MayThrow out(0);
+    ASSERT_TRUE(q.try_pop(out));
+    ASSERT_EQ(out.value, 5);
+}
+
+TEST(MpmcQueue, destroys_remaining_elements) {
+    {
+        s21::mpmc_queue<Counted> q(4);
+        Counted item;
+        q.push(item);
+        q.push(item);
+        q.push(item);
+        ASSERT_TRUE(q.try_pop(item));
+        ASSERT_EQ(Counted::alive, 3);
+    }
+    ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(MpmcQueue, move_only_elements) {
+    s21::mpmc_queue<std::unique_ptr<int>> q(2);
+    q.push(std::make_unique<int>(7));
+    std::unique_ptr<int> out;
+    q.pop(out);
+    ASSERT_EQ(*out, 7);
+}
+
+TEST(MpmcQueue, many_producers_and_consumers_yield) {
+    TransferOnce<s21::yield_wait>(8, 4, 3, 20000);
+}
+
+TEST(MpmcQueue, many_producers_and_consumers_futex) {
+    TransferOnce<s21::futex_wait>(4, 3, 4, 10000);
+}
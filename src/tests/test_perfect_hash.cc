@@ -0,0 +1,65 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr std::pair<std::string_view, int> kRoutes[] = {
+    {"/users", 1},     {"/users/me", 2}, {"/orders", 3},  {"/orders/new", 4},
+    {"/health", 5},    {"/metrics", 6},  {"/login", 7},   {"/logout", 8},
+    {"/cart", 9},      {"/checkout", 10}, {"/search", 11}, {"/", 12}};
+
+constexpr auto kRouteTable = s21::make_perfect_hash_map(kRoutes);
+
+static_assert(kRouteTable.size() == 12);
+static_assert(*kRouteTable.find("/orders/new") == 4);
+static_assert(kRouteTable.at("/") == 12);
+static_assert(!kRouteTable.contains("/admin"));
+
+enum class Status : std::uint16_t { kOk = 200, kNotFound = 404, kTeapot = 418 };
+
+constexpr std::pair<Status, std::string_view> kReasons[] = {
+    {Status::kOk, "OK"},
+    {Status::kNotFound, "Not Found"},
+    {Status::kTeapot, "I'm a teapot"}};
+
+constexpr auto kReasonTable = s21::make_perfect_hash_map(kReasons);
+
+static_assert(kReasonTable.at(Status::kTeapot) == "I'm a teapot");
+static_assert(!kReasonTable.contains(static_cast<Status>(500)));
+
+}  // namespace
+
+TEST(PerfectHashMap, finds_every_key_and_nothing_else) {
+    for (const auto &[path, id] : kRoutes) {
+        ASSERT_TRUE(kRouteTable.contains(path));
+        ASSERT_EQ(kRouteTable.at(path), id);
+    }
+    ASSERT_EQ(kRouteTable.find("/user"), nullptr);
+    ASSERT_THROW(kRouteTable.at("/missing"), std::out_of_range);
+}
+
+TEST(PerfectHashMap, many_integer_keys_built_at_run_time) {
+    s21::array<std::pair<std::uint32_t, std::uint32_t>, 500> items;
+    for (std::uint32_t i = 0; i < 500; ++i) {
+        items[i] = {i * 7919U, i};
+    }
+    s21::perfect_hash_map<std::uint32_t, std::uint32_t, 500> table(items);
+    for (std::uint32_t i = 0; i < 500; ++i) {
+        ASSERT_EQ(table.at(i * 7919U), i);
+        ASSERT_FALSE(table.contains(i * 7919U + 1));
+    }
+}
+
+TEST(PerfectHashMap, duplicate_keys_throw) {
+    s21::array<std::pair<int, int>, 3> items;
+    items[0] = {1, 10};
+    items[1] = {2, 20};
+    items[2] = {1, 30};
+    using Table = s21::perfect_hash_map<int, int, 3>;
+    ASSERT_THROW(Table table(items), std::invalid_argument);
+}
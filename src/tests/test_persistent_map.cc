@@ -0,0 +1,150 @@
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../s21_persistent_map.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+template <typename Map>
+std::vector<std::pair<int, std::string>> ToVector(const Map &m) {
+    std::vector<std::pair<int, std::string>> result;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+        result.emplace_back(it->first, it->second);
+    }
+    return result;
+}
+
+// Has no default constructor
+struct Weight {
+    explicit Weight(int grams) : grams(grams) {
+    }
+
+    int grams;
+};
+
+}  // namespace
+
+TEST(PersistentMap, insert_returns_new_version) {
+    s21::persistent_map<int, std::string> empty;
+    auto m1 = empty.insert(2, "two");
+    auto m2 = m1.insert({1, "one"});
+    auto m3 = m2.insert(2, "zwei");
+
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(m1.size(), 1U);
+    ASSERT_EQ(m2.size(), 2U);
+    ASSERT_EQ(m3.size(), 2U);
+    ASSERT_EQ(m3.at(2), "two");
+    ASSERT_FALSE(m1.contains(1));
+    ASSERT_TRUE(m2.contains(1));
+    ASSERT_THROW(m1.at(1), std::out_of_range);
+}
+
+TEST(PersistentMap, insert_or_assign_and_erase) {
+    s21::persistent_map<int, std::string> m{{1, "a"}, {2, "b"}, {3, "c"}};
+    auto assigned = m.insert_or_assign(2, "x").insert_or_assign(4, "d");
+    auto erased = assigned.erase(1).erase(10);
+
+    using items = std::vector<std::pair<int, std::string>>;
+    ASSERT_EQ(ToVector(m), (items{{1, "a"}, {2, "b"}, {3, "c"}}));
+    ASSERT_EQ(ToVector(assigned),
+              (items{{1, "a"}, {2, "x"}, {3, "c"}, {4, "d"}}));
+    ASSERT_EQ(ToVector(erased), (items{{2, "x"}, {3, "c"}, {4, "d"}}));
+    ASSERT_EQ(erased.find(1), erased.end());
+    ASSERT_EQ(erased.find(3)->second, "c");
+}
+
+TEST(PersistentMap, versions_match_std_map) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> key(0, 500);
+    std::bernoulli_distribution do_erase(0.4);
+
+    s21::PersistentRedBlackTree<int> tree;
+    std::map<int, int> expected;
+    std::vector<std::pair<s21::PersistentRedBlackTree<int>, std::vector<int>>>
+        history;
+
+    for (int i = 0; i < 3000; ++i) {
+        int value = key(generator);
+        if (do_erase(generator)) {
+            tree = tree.Erase(value);
+            expected.erase(value);
+        } else {
+            tree = tree.Insert(value);
+            expected.emplace(value, value);
+        }
+        ASSERT_TRUE(tree.CheckTree());
+        if (i % 100 == 0) {
+            std::vector<int> keys;
+            for (const auto &item : expected) {
+                keys.push_back(item.first);
+            }
+            history.emplace_back(tree, keys);
+        }
+    }
+
+    // Старые версии не изменились после всех последующих операций
+    for (const auto &[version, keys] : history) {
+        ASSERT_TRUE(version.CheckTree());
+        ASSERT_EQ(std::vector<int>(version.Begin(), version.End()), keys);
+    }
+}
+
+TEST(PersistentMap, lookup_by_key_only) {
+    s21::persistent_map<std::string, Weight> m;
+    m = m.insert("apple", Weight(150)).insert("plum", Weight(30));
+    ASSERT_EQ(m.at("apple").grams, 150);
+    ASSERT_EQ(m.find("plum")->second.grams, 30);
+    ASSERT_EQ(m.find("pear"), m.end());
+    ASSERT_TRUE(m.contains("plum"));
+
+    auto erased = m.erase("apple").erase("pear");
+    ASSERT_EQ(erased.size(), 1U);
+    ASSERT_FALSE(erased.contains("apple"));
+    ASSERT_TRUE(m.contains("apple"));
+}
+
+TEST(PersistentMap, lower_bound_iterates_tail) {
+    s21::PersistentRedBlackTree<int> tree;
+    for (int i = 0; i < 100; i += 2) {
+        tree = tree.Insert(i);
+    }
+    ASSERT_EQ(std::vector<int>(tree.LowerBound(91), tree.End()),
+              (std::vector<int>{92, 94, 96, 98}));
+    ASSERT_EQ(*tree.Find(40), 40);
+    ASSERT_EQ(tree.Find(41), tree.End());
+    ASSERT_EQ(tree.LowerBound(99), tree.End());
+}
+
+TEST(PersistentMap, snapshot_read_by_other_thread) {
+    s21::persistent_map<int, std::string> m;
+    for (int i = 0; i < 1000; ++i) {
+        m = m.insert(i, std::to_string(i));
+    }
+
+    auto snapshot = m;
+    std::thread reader([snapshot] {
+        for (int round = 0; round < 20; ++round) {
+            std::size_t count = 0;
+            for (auto it = snapshot.begin(); it != snapshot.end(); ++it) {
+                ASSERT_EQ(it->second, std::to_string(it->first));
+                ++count;
+            }
+            ASSERT_EQ(count, 1000U);
+        }
+    });
+    for (int i = 0; i < 1000; i += 2) {
+        m = m.erase(i).insert_or_assign(i + 1, "changed");
+    }
+    reader.join();
+
+    ASSERT_EQ(m.size(), 500U);
+    ASSERT_EQ(snapshot.size(), 1000U);
+    ASSERT_EQ(snapshot.at(1), "1");
+    ASSERT_EQ(m.at(1), "changed");
+}
@@ -0,0 +1,252 @@
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Random pushes and pops, checked step by step against std::priority_queue
+template <typename Queue, typename Compare = std::less<int>>
+void CompareWithStd(unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> value(0, 1000);
+    Queue q;
+    std::priority_queue<int, std::vector<int>, Compare> expected;
+    for (int step = 0; step < 5000; ++step) {
+        if (expected.empty() || gen() % 3 != 0) {
+            int v = value(gen);
+            q.push(v);
+            expected.push(v);
+        } else {
+            q.pop();
+            expected.pop();
+        }
+        ASSERT_EQ(q.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(q.top(), expected.top());
+        }
+    }
+}
+
+// A value whose copy throws while fail_copies is set
+struct Brittle {
+    static inline bool fail_copies = false;
+
+    explicit Brittle(int key = 0) : key(key) {
+    }
+    Brittle(const Brittle &other) : key(other.key) {
+        if (fail_copies) {
+            throw std::runtime_error("Brittle copy");
+        }
+    }
+    Brittle &operator=(const Brittle &other) {
+        if (fail_copies) {
+            throw std::runtime_error("Brittle copy");
+        }
+        key = other.key;
+        return *this;
+    }
+
+    bool operator<(const Brittle &other) const {
+        return key < other.key;
+    }
+
+    int key;
+};
+
+}  // namespace
+
+TEST(PriorityQueueTest, matches_std_for_each_arity) {
+    CompareWithStd<s21::priority_queue<int, s21::vector<int>,
+                                       std::less<int>, 2>>(1);
+    CompareWithStd<s21::priority_queue<int>>(2);
+    CompareWithStd<s21::priority_queue<int, s21::vector<int>,
+                                       std::less<int>, 8>>(3);
+    CompareWithStd<s21::priority_queue<int, s21::deque<int>>>(4);
+    CompareWithStd<s21::priority_queue<int, s21::vector<int>,
+                                       std::greater<int>, 3>,
+                   std::greater<int>>(5);
+}
+
+TEST(PriorityQueueTest, initializer_list_and_push_range) {
+    s21::priority_queue<int> q{5, 1, 9, 3, 7};
+    ASSERT_EQ(q.size(), 5);
+    ASSERT_EQ(q.top(), 9);
+
+    // Few new elements: sifted up one by one
+    std::vector<int> few{4, 10};
+    q.push_range(few.begin(), few.end());
+    ASSERT_EQ(q.top(), 10);
+
+    // Many new elements: the heap is rebuilt
+    std::vector<int> many;
+    for (int i = 0; i < 100; ++i) {
+        many.push_back((i * 37) % 101);
+    }
+    q.push_range(many.begin(), many.end());
+    ASSERT_EQ(q.size(), 107);
+
+    std::multiset<int, std::greater<int>> expected{5, 1, 9, 3, 7, 4, 10};
+    expected.insert(many.begin(), many.end());
+    for (int v : expected) {
+        ASSERT_EQ(q.top(), v);
+        q.pop();
+    }
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, emplace_and_swap) {
+    s21::priority_queue<std::string> q1;
+    q1.emplace(3, 'b');
+    q1.emplace("a");
+    ASSERT_EQ(q1.top(), "bbb");
+    s21::priority_queue<std::string> q2;
+    q2.push("z");
+    q1.swap(q2);
+    ASSERT_EQ(q1.size(), 1);
+    ASSERT_EQ(q1.top(), "z");
+    ASSERT_EQ(q2.size(), 2);
+}
+
+TEST(IndexedPriorityQueueTest, decrease_key_update_erase) {
+    s21::indexed_priority_queue<int, std::greater<int>> q;
+    auto a = q.push(50);
+    auto b = q.push(20);
+    auto c = q.push(30);
+    auto d = q.push(40);
+    ASSERT_EQ(q.top(), 20);
+    ASSERT_EQ(q.top_handle(), b);
+
+    q.decrease_key(d, 10);
+    ASSERT_EQ(q.top_handle(), d);
+    ASSERT_THROW(q.decrease_key(c, 35), std::invalid_argument);
+
+    q.update(d, 60);
+    ASSERT_EQ(q.top_handle(), b);
+    ASSERT_EQ(q.value(d), 60);
+
+    q.erase(b);
+    ASSERT_FALSE(q.contains(b));
+    ASSERT_THROW(q.erase(b), std::out_of_range);
+    ASSERT_THROW(q.value(b), std::out_of_range);
+    ASSERT_EQ(q.top_handle(), c);
+
+    // The freed handle is reused
+    ASSERT_EQ(q.push(5), b);
+    ASSERT_EQ(q.top(), 5);
+
+    std::vector<int> order;
+    while (!q.empty()) {
+        order.push_back(q.top());
+        q.pop();
+    }
+    ASSERT_EQ(order, (std::vector<int>{5, 30, 50, 60}));
+    ASSERT_FALSE(q.contains(a));
+}
+
+TEST(IndexedPriorityQueueTest, erase_releases_value) {
+    auto by_value = [](const std::shared_ptr<int> &lhs,
+                       const std::shared_ptr<int> &rhs) {
+        return *lhs < *rhs;
+    };
+    s21::indexed_priority_queue<std::shared_ptr<int>, decltype(by_value)> q(
+        by_value);
+    auto first = std::make_shared<int>(1);
+    auto second = std::make_shared<int>(2);
+    auto h1 = q.push(first);
+    q.push(second);
+    ASSERT_EQ(first.use_count(), 2);
+
+    q.erase(h1);
+    ASSERT_EQ(first.use_count(), 1);
+    q.pop();
+    ASSERT_EQ(second.use_count(), 1);
+    ASSERT_TRUE(q.empty());
+
+    // The freed handles are reused
+    auto third = std::make_shared<int>(3);
+    auto h3 = q.push(third);
+    ASSERT_LT(h3, 2U);
+    ASSERT_EQ(*q.top(), 3);
+}
+
+TEST(IndexedPriorityQueueTest, throwing_push_leaves_queue_unchanged) {
+    s21::indexed_priority_queue<Brittle> q;
+    Brittle one(1), two(2);
+
+    // A fresh handle
+    Brittle::fail_copies = true;
+    ASSERT_THROW(q.push(one), std::runtime_error);
+    Brittle::fail_copies = false;
+    ASSERT_TRUE(q.empty());
+    auto h1 = q.push(one);
+    ASSERT_EQ(h1, 0U);
+
+    // A reused handle
+    q.erase(h1);
+    Brittle::fail_copies = true;
+    ASSERT_THROW(q.push(two), std::runtime_error);
+    Brittle::fail_copies = false;
+    ASSERT_TRUE(q.empty());
+    ASSERT_FALSE(q.contains(h1));
+
+    for (int key = 0; key < 10; ++key) {
+        q.push(Brittle(key));
+    }
+    ASSERT_EQ(q.size(), 10U);
+    for (int key = 9; key >= 0; --key) {
+        ASSERT_EQ(q.top().key, key);
+        q.pop();
+    }
+}
+
+TEST(IndexedPriorityQueueTest, random_operations) {
+    std::mt19937 gen(7);
+    s21::indexed_priority_queue<int, std::less<int>, 3> q;
+    std::vector<int> values;
+    std::vector<bool> alive;
+    for (int step = 0; step < 5000; ++step) {
+        unsigned op = gen() % 4;
+        if (op == 0 || q.empty()) {
+            int v = static_cast<int>(gen() % 1000);
+            auto handle = q.push(v);
+            if (handle >= values.size()) {
+                values.resize(handle + 1);
+                alive.resize(handle + 1);
+            }
+            values[handle] = v;
+            alive[handle] = true;
+        } else {
+            std::size_t handle = gen() % values.size();
+            if (!alive[handle]) {
+                continue;
+            }
+            if (op == 1) {
+                q.erase(handle);
+                alive[handle] = false;
+            } else if (op == 2) {
+                values[handle] += static_cast<int>(gen() % 100);
+                q.decrease_key(handle, values[handle]);
+            } else {
+                values[handle] = static_cast<int>(gen() % 1000);
+                q.update(handle, values[handle]);
+            }
+        }
+        if (!q.empty()) {
+            int best = -1;
+            for (std::size_t h = 0; h < values.size(); ++h) {
+                if (alive[h] && values[h] > best) {
+                    best = values[h];
+                }
+            }
+            ASSERT_EQ(q.top(), best);
+        }
+    }
+}
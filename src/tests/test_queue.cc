@@ -1,4 +1,7 @@
+#include <iterator>
 #include <queue>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -472,3 +475,68 @@ TEST(Queue, back) {
     s0.pop();
     ASSERT_TRUE(s0.empty());
 }
+
+TEST(Queue, emplace_forwards_to_the_container) {
+    s21::queue<std::string, s21::list<std::string>> q;
+    ASSERT_EQ(q.emplace(3, 'a'), "aaa");
+    std::string long_string(100, 'x');
+    const char *buffer = long_string.data();
+    q.push(std::move(long_string));
+    q.emplace_back(std::string(200, 'y'), std::string("z"));
+    ASSERT_EQ(q.size(), 4U);
+    ASSERT_EQ(q.back(), "z");
+    q.pop();
+    // Moved all the way into the list node, not copied
+    ASSERT_EQ(q.front().data(), buffer);
+
+    s21::queue<std::string> d;
+    d.emplace(2, 'q');
+    ASSERT_EQ(d.front(), "qq");
+}
+
+template <typename Container>
+void CheckQueueBatches() {
+    s21::queue<int, Container> q;
+    std::vector<int> input{1, 2, 3, 4, 5, 6, 7};
+    q.push_range(input.begin(), input.end());
+    q.push(8);
+    ASSERT_EQ(q.size(), 8U);
+    ASSERT_EQ(q.front(), 1);
+
+    std::vector<int> out;
+    q.pop_n(std::back_inserter(out), 3);
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(q.front(), 4);
+
+    // More than there is: pops everything left
+    q.pop_n(std::back_inserter(out), 100);
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+    ASSERT_TRUE(q.empty());
+
+    q.push_range(input.begin(), input.end());
+    int sum = 0;
+    ASSERT_EQ(q.drain([&sum](int &&value) { sum = sum * 10 + value; }), 7U);
+    ASSERT_EQ(sum, 1234567);
+    ASSERT_TRUE(q.empty());
+    ASSERT_EQ(q.drain([](int &&) {}), 0U);
+}
+
+TEST(Queue, push_range_pop_n_drain) {
+    CheckQueueBatches<s21::deque<int>>();
+    CheckQueueBatches<s21::list<int>>();
+}
+
+TEST(Queue, drain_keeps_unconsumed_elements_on_throw) {
+    s21::queue<std::string> q{"a", "b", "c", "d"};
+    std::vector<std::string> seen;
+    auto consume = [&seen](std::string &&value) {
+        if (value == "c") {
+            throw std::runtime_error("stop");
+        }
+        seen.push_back(std::move(value));
+    };
+    ASSERT_THROW(q.drain(consume), std::runtime_error);
+    ASSERT_EQ(seen, (std::vector<std::string>{"a", "b"}));
+    ASSERT_EQ(q.size(), 2U);
+    ASSERT_EQ(q.front(), "c");
+}
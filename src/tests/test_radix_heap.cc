@@ -0,0 +1,140 @@
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+TEST(RadixHeapTest, pops_in_key_order) {
+    s21::radix_heap<unsigned> q{7, 3, 3, 100, 0};
+    ASSERT_EQ(q.size(), 5);
+    std::vector<unsigned> order;
+    while (!q.empty()) {
+        order.push_back(q.top());
+        q.pop();
+    }
+    ASSERT_EQ(order, (std::vector<unsigned>{0, 3, 3, 7, 100}));
+    ASSERT_EQ(q.last_key(), 100);
+}
+
+TEST(RadixHeapTest, monotone_keys) {
+    s21::radix_heap<std::uint8_t> q;
+    q.push(10);
+    q.push(255);
+    ASSERT_EQ(q.top(), 10);
+    q.pop();
+    ASSERT_EQ(q.last_key(), 10);
+    ASSERT_THROW(q.push(9), std::invalid_argument);
+    // Below the current top but not below the last popped key
+    q.push(10);
+    q.push(11);
+    ASSERT_EQ(q.top(), 10);
+    q.pop();
+    ASSERT_EQ(q.top(), 11);
+
+    q.clear();
+    ASSERT_TRUE(q.empty());
+    ASSERT_EQ(q.last_key(), 0);
+    q.push(0);
+    ASSERT_EQ(q.top(), 0);
+}
+
+TEST(RadixHeapTest, keyed_elements_and_swap) {
+    s21::radix_heap<std::uint64_t, std::string> q;
+    q.emplace(1ULL << 40, "late");
+    q.emplace(5, "early");
+    q.push({~0ULL, "last"});
+    ASSERT_EQ(q.top_key(), 5);
+    ASSERT_EQ(q.top().second, "early");
+
+    s21::radix_heap<std::uint64_t, std::string> other;
+    other.swap(q);
+    ASSERT_TRUE(q.empty());
+    ASSERT_EQ(other.size(), 3);
+    other.pop();
+    ASSERT_EQ(other.top().second, "late");
+    other.pop();
+    ASSERT_EQ(other.top_key(), ~0ULL);
+}
+
+// Timer workload: every popped timer reschedules itself at a later time,
+// checked step by step against std::priority_queue
+TEST(RadixHeapTest, matches_std_on_timers) {
+    std::mt19937 gen(3);
+    s21::radix_heap<std::uint32_t> q;
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>,
+                        std::greater<std::uint32_t>>
+        expected;
+    for (int i = 0; i < 1000; ++i) {
+        std::uint32_t key = gen() % 100000;
+        q.push(key);
+        expected.push(key);
+    }
+    for (int step = 0; step < 20000; ++step) {
+        ASSERT_EQ(q.top(), expected.top());
+        std::uint32_t now = q.top();
+        q.pop();
+        expected.pop();
+        int pushes = static_cast<int>(gen() % 3);
+        for (int i = 0; i < pushes; ++i) {
+            std::uint32_t key = now + gen() % 5000;
+            q.push(key);
+            expected.push(key);
+        }
+        if (expected.empty()) {
+            q.push(now);
+            expected.push(now);
+        }
+        ASSERT_EQ(q.size(), expected.size());
+    }
+}
+
+TEST(RadixHeapTest, top_does_not_raise_the_bound) {
+    s21::radix_heap<unsigned> q;
+    q.push(10);
+    q.push(40);
+    ASSERT_EQ(q.top(), 10U);
+    ASSERT_EQ(q.last_key(), 0U);
+    // Nothing was popped, so 5 is still a valid key
+    q.push(5);
+    ASSERT_EQ(q.top(), 5U);
+    q.push(7);
+    ASSERT_EQ(q.top(), 5U);
+    q.pop();
+    ASSERT_EQ(q.last_key(), 5U);
+    ASSERT_EQ(q.top(), 7U);
+    q.push(5);
+    ASSERT_EQ(q.top(), 5U);
+
+    std::vector<unsigned> order;
+    while (!q.empty()) {
+        order.push_back(q.top());
+        q.pop();
+    }
+    ASSERT_EQ(order, (std::vector<unsigned>{5, 7, 10, 40}));
+}
+
+TEST(RadixHeapTest, interleaved_top_push_pop) {
+    std::mt19937 gen(11);
+    s21::radix_heap<std::uint32_t> q;
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>,
+                        std::greater<std::uint32_t>>
+        expected;
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(gen() % 3);
+        if (op == 0 || expected.empty()) {
+            std::uint32_t key = q.last_key() + gen() % 1000;
+            q.push(key);
+            expected.push(key);
+        } else if (op == 1) {
+            ASSERT_EQ(q.top(), expected.top());
+        } else {
+            ASSERT_EQ(q.top(), expected.top());
+            q.pop();
+            expected.pop();
+        }
+    }
+}
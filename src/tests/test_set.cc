@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_multiset.h"
+#include "../s21_set.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+std::vector<int> RandomValues(std::size_t count, int max_value,
+                              unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, max_value);
+    std::vector<int> values(count);
+    for (auto &value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+template <typename Set>
+std::vector<int> ToVector(const Set &s) {
+    return std::vector<int>(s.begin(), s.end());
+}
+
+}  // namespace
+
+TEST(Set, range_constructor) {
+    std::vector<int> values = RandomValues(1000, 300, 1);
+    s21::set<int> s(values.begin(), values.end());
+    std::set<int> expected(values.begin(), values.end());
+
+    ASSERT_EQ(s.size(), expected.size());
+    ASSERT_EQ(ToVector(s), ToVector(expected));
+}
+
+TEST(Set, range_constructor_parallel) {
+    s21::ThreadPool pool(4);
+    std::vector<int> values = RandomValues(200000, 150000, 2);
+    s21::set<int> s(values.begin(), values.end(), s21::parallel_policy(pool));
+    std::set<int> expected(values.begin(), values.end());
+
+    ASSERT_EQ(s.size(), expected.size());
+    ASSERT_EQ(ToVector(s), ToVector(expected));
+}
+
+TEST(Set, build_keeps_red_black_properties) {
+    s21::ThreadPool pool(3);
+    for (int count = 0; count < 130; ++count) {
+        std::vector<int> values(count);
+        for (int i = 0; i < count; ++i) {
+            values[i] = count - i;
+        }
+        s21::RedBlackTree<int> tree;
+        tree.Build(values.begin(), values.end(), true);
+        ASSERT_TRUE(tree.CheckTree());
+        ASSERT_EQ(tree.Size(), static_cast<std::size_t>(count));
+        if (count > 0) {
+            ASSERT_EQ(*tree.Begin(), 1);
+            ASSERT_EQ(*--tree.End(), count);
+        }
+    }
+
+    std::vector<int> values = RandomValues(100000, 1000, 3);
+    s21::RedBlackTree<int> tree;
+    tree.Build(values.begin(), values.end(), false, &pool);
+    ASSERT_TRUE(tree.CheckTree());
+    ASSERT_EQ(tree.Size(), values.size());
+    ASSERT_TRUE(std::is_sorted(tree.Begin(), tree.End()));
+
+    // После массового построения дерево остается обычным деревом
+    tree.Insert(5000);
+    tree.Erase(tree.Begin());
+    ASSERT_TRUE(tree.CheckTree());
+}
+
+TEST(Set, merge_parallel) {
+    s21::ThreadPool pool(4);
+    std::vector<int> values1 = RandomValues(100000, 200000, 4);
+    std::vector<int> values2 = RandomValues(80000, 200000, 5);
+
+    s21::set<int> s1(values1.begin(), values1.end());
+    s21::set<int> s2(values2.begin(), values2.end());
+    std::set<int> expected1(values1.begin(), values1.end());
+    std::set<int> expected2(values2.begin(), values2.end());
+
+    auto it = s2.find(values2.front());
+    const int *address = &*it;
+
+    s1.merge(s2, s21::parallel_policy(pool));
+    expected1.merge(expected2);
+
+    ASSERT_EQ(ToVector(s1), ToVector(expected1));
+    ASSERT_EQ(ToVector(s2), ToVector(expected2));
+    // Узлы не пересоздаются - ссылки остаются действительными
+    ASSERT_TRUE(&*s1.find(values2.front()) == address ||
+                &*s2.find(values2.front()) == address);
+}
+
+TEST(Set, merge_parallel_small) {
+    s21::ThreadPool pool(2);
+    s21::set<int> s1{1, 3, 5};
+    s21::set<int> s2{2, 3, 4};
+    s1.merge(s2, s21::parallel_policy(pool));
+    ASSERT_EQ(ToVector(s1), (std::vector<int>{1, 2, 3, 4, 5}));
+    ASSERT_EQ(ToVector(s2), (std::vector<int>{3}));
+
+    s21::set<int> empty;
+    s1.merge(empty, s21::parallel_policy(pool));
+    empty.merge(s1, s21::parallel_policy(pool));
+    ASSERT_TRUE(s1.empty());
+    ASSERT_EQ(empty.size(), 5U);
+}
+
+TEST(Set, set_algebra) {
+    s21::set<int> s1{1, 2, 3, 4, 5};
+    s21::set<int> s2{4, 5, 6, 7};
+
+    ASSERT_EQ(ToVector(s1.set_union(s2)),
+              (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+    ASSERT_EQ(ToVector(s1.set_intersection(s2)), (std::vector<int>{4, 5}));
+    ASSERT_EQ(ToVector(s1.set_difference(s2)), (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(ToVector(s2.set_difference(s1)), (std::vector<int>{6, 7}));
+    ASSERT_EQ(s1.size(), 5U);
+    ASSERT_EQ(s2.size(), 4U);
+}
+
+TEST(Set, set_algebra_parallel) {
+    s21::ThreadPool pool(4);
+    std::vector<int> values1 = RandomValues(120000, 300000, 6);
+    std::vector<int> values2 = RandomValues(90000, 300000, 7);
+    s21::set<int> s1(values1.begin(), values1.end());
+    s21::set<int> s2(values2.begin(), values2.end());
+    std::set<int> e1(values1.begin(), values1.end());
+    std::set<int> e2(values2.begin(), values2.end());
+    s21::parallel_policy policy(pool);
+
+    std::vector<int> expected;
+    std::set_union(e1.begin(), e1.end(), e2.begin(), e2.end(),
+                   std::back_inserter(expected));
+    ASSERT_EQ(ToVector(s1.set_union(s2, policy)), expected);
+
+    expected.clear();
+    std::set_intersection(e1.begin(), e1.end(), e2.begin(), e2.end(),
+                          std::back_inserter(expected));
+    ASSERT_EQ(ToVector(s1.set_intersection(s2, policy)), expected);
+
+    expected.clear();
+    std::set_difference(e1.begin(), e1.end(), e2.begin(), e2.end(),
+                        std::back_inserter(expected));
+    ASSERT_EQ(ToVector(s1.set_difference(s2, policy)), expected);
+}
+
+TEST(Set, thread_pool_nested_groups) {
+    s21::ThreadPool pool(4);
+    std::atomic<int> counter{0};
+    s21::TaskGroup outer(pool);
+    for (int i = 0; i < 8; ++i) {
+        outer.Run([&pool, &counter] {
+            s21::TaskGroup inner(pool);
+            for (int j = 0; j < 8; ++j) {
+                inner.Run([&counter] { ++counter; });
+            }
+            inner.Wait();
+        });
+    }
+    outer.Wait();
+    ASSERT_EQ(counter, 64);
+
+    s21::TaskGroup failing(pool);
+    failing.Run([] { throw std::runtime_error("task failed"); });
+    ASSERT_THROW(failing.Wait(), std::runtime_error);
+}
+
+TEST(Set, extract_and_insert_node) {
+    s21::set<int> s1{1, 2, 3};
+    s21::set<int> s2{3, 4};
+    const int *address = &*s1.find(2);
+
+    s21::set<int>::node_handle node = s1.extract(2);
+    ASSERT_FALSE(node.empty());
+    ASSERT_EQ(node.value(), 2);
+    ASSERT_EQ(s1.size(), 2U);
+
+    auto result = s2.insert(std::move(node));
+    ASSERT_TRUE(result.inserted);
+    ASSERT_TRUE(result.node.empty());
+    ASSERT_EQ(&*result.position, address);
+    ASSERT_EQ(ToVector(s2), (std::vector<int>{2, 3, 4}));
+
+    // Элемент с таким ключом уже есть - узел возвращается обратно
+    result = s2.insert(s1.extract(s1.find(3)));
+    ASSERT_FALSE(result.inserted);
+    ASSERT_EQ(result.node.value(), 3);
+    ASSERT_EQ(*result.position, 3);
+
+    ASSERT_TRUE(s1.extract(100).empty());
+    ASSERT_FALSE(s2.insert(s21::set<int>::node_handle{}).inserted);
+}
+
+TEST(Multiset, extract_and_insert_node) {
+    s21::multiset<int> ms{5, 1, 5, 3};
+    auto node = ms.extract(5);
+    node.value() = 2;
+    ms.insert(std::move(node));
+    ms.insert(ms.extract(ms.find(5)));
+
+    std::vector<int> values(ms.begin(), ms.end());
+    ASSERT_EQ(values, (std::vector<int>{1, 2, 3, 5}));
+}
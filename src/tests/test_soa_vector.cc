@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+using Orders = s21::soa_vector<std::uint64_t, double, std::int32_t>;
+
+bool IsAligned(const void *pointer, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+// Throws from the copy constructor once the counter runs out
+struct Fragile {
+    static int copies_left;
+    int value = 0;
+
+    Fragile() = default;
+    explicit Fragile(int v) : value(v) {
+    }
+    Fragile(const Fragile &other) : value(other.value) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("Fragile copy");
+        }
+    }
+    Fragile &operator=(const Fragile &) = default;
+};
+
+int Fragile::copies_left = 0;
+
+}  // namespace
+
+TEST(SoaVector, push_back_and_records) {
+    Orders orders;
+    ASSERT_TRUE(orders.empty());
+    ASSERT_EQ(orders.capacity(), 0U);
+
+    orders.push_back({1, 9.5, 3});
+    std::tuple<std::uint64_t, double, std::int32_t> order{2, 0.5, 7};
+    orders.push_back(order);
+    auto [id, price, qty] = orders.emplace_back(3U, 1.25, 2);
+    ASSERT_EQ(id, 3U);
+    ASSERT_EQ(price, 1.25);
+    ASSERT_EQ(qty, 2);
+
+    ASSERT_EQ(orders.size(), 3U);
+    ASSERT_EQ(std::get<0>(orders.front()), 1U);
+    ASSERT_EQ(std::get<2>(orders.back()), 2);
+    ASSERT_EQ(std::get<1>(orders[1]), 0.5);
+    ASSERT_EQ(orders.at(1), order);
+    ASSERT_THROW(orders.at(3), std::out_of_range);
+
+    std::get<1>(orders[0]) = 10.0;
+    ASSERT_EQ(orders.column<1>()[0], 10.0);
+
+    orders.pop_back();
+    ASSERT_EQ(orders.size(), 2U);
+    ASSERT_EQ(std::get<0>(orders.back()), 2U);
+}
+
+TEST(SoaVector, columns_are_contiguous_and_aligned) {
+    Orders orders;
+    for (int i = 0; i < 1000; ++i) {
+        orders.emplace_back(static_cast<std::uint64_t>(i), i * 0.5, -i);
+        ASSERT_TRUE(IsAligned(orders.data<0>(), Orders::kColumnAlignment));
+        ASSERT_TRUE(IsAligned(orders.data<1>(), Orders::kColumnAlignment));
+        ASSERT_TRUE(IsAligned(orders.data<2>(), Orders::kColumnAlignment));
+    }
+    static_assert(Orders::kColumnAlignment == s21::kCacheLineSize);
+
+    s21::column_span<double> prices = orders.column<1>();
+    ASSERT_EQ(prices.size(), 1000U);
+    ASSERT_EQ(prices.data(), orders.data<1>());
+    ASSERT_EQ(std::accumulate(prices.begin(), prices.end(), 0.0),
+              0.5 * 999 * 1000 / 2);
+    for (auto &price : prices) {
+        price *= 2;
+    }
+    ASSERT_EQ(prices.back(), 999.0);
+
+    const Orders &view = orders;
+    s21::column_span<const std::int32_t> quantities = view.column<2>();
+    ASSERT_EQ(quantities.front(), 0);
+    ASSERT_EQ(quantities[10], -10);
+    ASSERT_EQ(*std::min_element(quantities.begin(), quantities.end()), -999);
+}
+
+TEST(SoaVector, zipped_iterator) {
+    s21::soa_vector<int, std::string> items{{3, "c"}, {1, "a"}, {2, "b"}};
+    std::string names;
+    for (auto [key, name] : items) {
+        names += name + std::to_string(key);
+        name += "!";
+    }
+    ASSERT_EQ(names, "c3a1b2");
+    ASSERT_EQ(items.column<1>()[0], "c!");
+
+    auto it = items.begin();
+    ASSERT_EQ(items.end() - it, 3);
+    ASSERT_EQ(std::get<0>(it[2]), 2);
+    ++it;
+    ASSERT_EQ(std::get<0>(*it), 1);
+    it += 2;
+    ASSERT_TRUE(it == items.end());
+    ASSERT_TRUE(items.begin() < it);
+
+    const auto &view = items;
+    s21::soa_vector<int, std::string>::const_iterator cit = items.begin();
+    ASSERT_TRUE(cit == view.begin());
+    auto found = std::find_if(view.begin(), view.end(), [](auto record) {
+        return std::get<1>(record) == "b!";
+    });
+    ASSERT_EQ(found - view.begin(), 2);
+}
+
+TEST(SoaVector, copy_move_and_resize) {
+    s21::soa_vector<std::string, int> words;
+    for (int i = 0; i < 100; ++i) {
+        words.emplace_back(std::string(20, static_cast<char>('a' + i % 26)),
+                           i);
+    }
+    s21::soa_vector<std::string, int> copy(words);
+    ASSERT_EQ(copy.size(), 100U);
+    ASSERT_EQ(copy[27], words[27]);
+    ASSERT_NE(copy.data<0>(), words.data<0>());
+
+    s21::soa_vector<std::string, int> moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 100U);
+    ASSERT_TRUE(copy.empty());
+
+    copy = moved;
+    ASSERT_EQ(std::get<0>(copy.back()), std::string(20, 'v'));
+    moved = std::move(copy);
+    ASSERT_EQ(std::get<1>(moved.back()), 99);
+
+    moved.resize(120);
+    ASSERT_EQ(moved.size(), 120U);
+    ASSERT_EQ(moved[110], std::make_tuple(std::string(), 0));
+    moved.resize(10);
+    ASSERT_EQ(moved.size(), 10U);
+    ASSERT_EQ(std::get<1>(moved.back()), 9);
+
+    moved.clear();
+    ASSERT_TRUE(moved.empty());
+    ASSERT_GE(moved.capacity(), 120U);
+    moved.shrink_to_fit();
+    ASSERT_EQ(moved.capacity(), 0U);
+
+    s21::soa_vector<double, char> sized(5);
+    ASSERT_EQ(sized.size(), 5U);
+    ASSERT_EQ(sized.column<0>()[4], 0.0);
+    ASSERT_THROW(sized.reserve(sized.max_size() + 1), std::length_error);
+}
+
+TEST(SoaVector, emplace_back_from_own_record) {
+    s21::soa_vector<std::string, int> items;
+    items.emplace_back("first", 1);
+    while (items.size() != items.capacity()) {
+        items.emplace_back("filler", 0);
+    }
+    // Growing must not read the arguments after the columns moved
+    auto [name, value] = items.front();
+    items.emplace_back(name, value);
+    ASSERT_EQ(std::get<0>(items.back()), "first");
+    ASSERT_EQ(std::get<1>(items.back()), 1);
+}
+
+TEST(SoaVector, throwing_field_leaves_container_unchanged) {
+    s21::soa_vector<std::shared_ptr<int>, Fragile> items;
+    auto shared = std::make_shared<int>(5);
+    Fragile fragile(1);
+
+    Fragile::copies_left = 0;
+    ASSERT_THROW(items.emplace_back(shared, fragile), std::runtime_error);
+    ASSERT_TRUE(items.empty());
+    // The first column's field was rolled back
+    ASSERT_EQ(shared.use_count(), 1);
+
+    Fragile::copies_left = 100;
+    for (int i = 0; i < 16; ++i) {
+        items.emplace_back(shared, Fragile(i));
+    }
+    ASSERT_EQ(items.size(), items.capacity());
+    // Growing copies Fragile, which may throw: the old columns stay intact
+    Fragile::copies_left = 3;
+    ASSERT_THROW(items.emplace_back(shared, fragile), std::runtime_error);
+    ASSERT_EQ(items.size(), 16U);
+    ASSERT_EQ(std::get<1>(items[15]).value, 15);
+    ASSERT_EQ(shared.use_count(), 17);
+}
+
+TEST(SoaVector, throwing_constructor_releases_records) {
+    auto shared = std::make_shared<int>(5);
+    Fragile::copies_left = 100;
+    s21::soa_vector<std::shared_ptr<int>, Fragile> items;
+    for (int i = 0; i < 10; ++i) {
+        items.emplace_back(shared, Fragile(i));
+    }
+    ASSERT_EQ(shared.use_count(), 11);
+
+    Fragile::copies_left = 4;
+    using Items = s21::soa_vector<std::shared_ptr<int>, Fragile>;
+    ASSERT_THROW(Items copy(items), std::runtime_error);
+    // The records copied before the throw were destroyed
+    ASSERT_EQ(shared.use_count(), 11);
+
+    // Two copies build the list, the second record's copy throws
+    Fragile::copies_left = 3;
+    ASSERT_THROW(Items({{shared, Fragile(1)}, {shared, Fragile(2)}}),
+                 std::runtime_error);
+    ASSERT_EQ(shared.use_count(), 11);
+}
@@ -0,0 +1,175 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_spsc_queue.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Считает живые объекты, чтобы проверить удаление элементов очереди
+struct Counted {
+    static inline int alive = 0;
+    Counted() {
+        ++alive;
+    }
+    Counted(const Counted &) {
+        ++alive;
+    }
+    Counted &operator=(const Counted &) = default;
+    ~Counted() {
+        --alive;
+    }
+};
+
+// Один производитель и один потребитель передают count чисел по порядку
+template <typename Wait>
+void TransferInOrder(std::size_t capacity, int count) {
+    s21::spsc_queue<int, Wait> q(capacity);
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            q.push(i);
+        }
+    });
+    for (int i = 0; i < count; ++i) {
+        int value = -1;
+        q.pop(value);
+        ASSERT_EQ(value, i);
+    }
+    producer.join();
+    ASSERT_TRUE(q.empty());
+}
+
+}  // namespace
+
+TEST(SpscQueue, single_thread) {
+    s21::spsc_queue<std::string> q(3);
+    ASSERT_EQ(q.capacity(), 4U);
+    ASSERT_TRUE(q.empty());
+
+    std::string value = "unchanged";
+    ASSERT_FALSE(q.try_pop(value));
+    ASSERT_EQ(value, "unchanged");
+
+    q.push("a");
+    ASSERT_TRUE(q.try_push("b"));
+    ASSERT_TRUE(q.try_emplace(3, 'c'));
+    q.emplace("d");
+    ASSERT_FALSE(q.try_push("e"));
+    ASSERT_EQ(q.size(), 4U);
+
+    ASSERT_EQ(q.front(), "a");
+    q.pop();
+    ASSERT_TRUE(q.try_pop(value));
+    ASSERT_EQ(value, "b");
+    q.pop(value);
+    ASSERT_EQ(value, "ccc");
+    ASSERT_EQ(q.size(), 1U);
+}
+
+TEST(SpscQueue, batches_wrap_around) {
+    s21::spsc_queue<int> q(8);
+    std::vector<int> input(20);
+    for (int i = 0; i < 20; ++i) {
+        input[i] = i;
+    }
+    std::vector<int> output;
+
+    ASSERT_EQ(q.push_n(input.begin(), 5), 5U);
+    ASSERT_EQ(q.pop_n(std::back_inserter(output), 3), 3U);
+    // Остается 2 элемента, помещается только 6 из 10
+    ASSERT_EQ(q.push_n(input.begin() + 5, 10), 6U);
+    ASSERT_TRUE(q.size() == q.capacity());
+    ASSERT_EQ(q.pop_n(std::back_inserter(output), 100), 8U);
+    ASSERT_EQ(q.pop_n(std::back_inserter(output), 1), 0U);
+
+    ASSERT_EQ(output.size(), 11U);
+    for (int i = 0; i < 11; ++i) {
+        ASSERT_EQ(output[i], i);
+    }
+}
+
+TEST(SpscQueue, destroys_remaining_elements) {
+    {
+        s21::spsc_queue<Counted> q(4);
+        Counted item;
+        q.push(item);
+        q.push(item);
+        q.push(item);
+        q.pop();
+        ASSERT_EQ(Counted::alive, 3);
+    }
+    ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(SpscQueue, move_only_elements) {
+    s21::spsc_queue<std::unique_ptr<int>> q(2);
+    q.push(std::make_unique<int>(7));
+    std::unique_ptr<int> out;
+    ASSERT_TRUE(q.try_pop(out));
+    ASSERT_EQ(*out, 7);
+}
+
+TEST(SpscQueue, over_aligned_elements) {
+    struct alignas(256) Wide {
+        int value;
+    };
+    s21::spsc_queue<Wide> q(8);
+    for (int i = 0; i < 20; ++i) {
+        q.push(Wide{i});
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&q.front()) % alignof(Wide),
+                  0u);
+        ASSERT_EQ(q.front().value, i);
+        q.pop();
+    }
+}
+
+TEST(SpscQueue, two_threads_spin) {
+    // Активное ожидание на одном ядре длится до конца кванта времени, поэтому
+    // очередь вмещает почти все элементы
+    TransferInOrder<s21::spin_wait>(4096, 20000);
+}
+
+TEST(SpscQueue, two_threads_yield) {
+    TransferInOrder<s21::yield_wait>(16, 200000);
+}
+
+TEST(SpscQueue, two_threads_futex) {
+    // Маленькая емкость, чтобы обе стороны часто засыпали
+    TransferInOrder<s21::futex_wait>(2, 50000);
+}
+
+TEST(SpscQueue, two_threads_batches) {
+    constexpr int kCount = 200000;
+    s21::spsc_queue<int, s21::spin_wait> q(64);
+    std::thread producer([&] {
+        int buffer[32];
+        int next = 0;
+        while (next < kCount) {
+            int n = std::min(32, kCount - next);
+            for (int i = 0; i < n; ++i) {
+                buffer[i] = next + i;
+            }
+            std::size_t pushed = q.push_n(buffer, n);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += static_cast<int>(pushed);
+        }
+    });
+    int expected = 0;
+    int buffer[17];
+    while (expected < kCount) {
+        std::size_t n = q.pop_n(buffer, 17);
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(buffer[i], expected++);
+        }
+    }
+    producer.join();
+}
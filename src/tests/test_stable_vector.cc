@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Throws from the copy constructor once the counter runs out
+struct Fragile {
+    static int copies_left;
+    std::shared_ptr<int> owner;
+
+    explicit Fragile(std::shared_ptr<int> owner) : owner(std::move(owner)) {
+    }
+    Fragile(const Fragile &other) : owner(other.owner) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("Fragile copy");
+        }
+    }
+    Fragile &operator=(const Fragile &) = default;
+};
+
+int Fragile::copies_left = 0;
+
+}  // namespace
+
+TEST(StableVector, push_back_and_indexing) {
+    s21::stable_vector<int> v;
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(v.capacity(), 0U);
+
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(i);
+    }
+    ASSERT_EQ(v.size(), 10000U);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+    ASSERT_EQ(v.front(), 0);
+    ASSERT_EQ(v.back(), 9999);
+    ASSERT_EQ(v.at(4321), 4321);
+    ASSERT_THROW(v.at(10000), std::out_of_range);
+    // Blocks of 16, 32, 64, ...: never more than twice the size
+    ASSERT_GE(v.capacity(), 10000U);
+    ASSERT_LT(v.capacity(), 2 * 10000U + 16);
+
+    v.pop_back();
+    ASSERT_EQ(v.back(), 9998);
+    ASSERT_EQ(std::accumulate(v.begin(), v.end(), 0LL),
+              9998LL * 9999 / 2);
+}
+
+TEST(StableVector, growing_never_moves_elements) {
+    s21::stable_vector<std::string> v;
+    std::vector<const std::string *> addresses;
+    for (int i = 0; i < 5000; ++i) {
+        const std::string &added = v.emplace_back(3, static_cast<char>(i));
+        addresses.push_back(&added);
+    }
+    v.reserve(100000);
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_EQ(&v[i], addresses[i]);
+        ASSERT_EQ(v[i], std::string(3, static_cast<char>(i)));
+    }
+
+    auto it = v.begin() + 100;
+    const std::string *first = &v.front();
+    v.push_back("more");
+    ASSERT_EQ(&*it, addresses[100]);
+    ASSERT_EQ(&v.front(), first);
+}
+
+TEST(StableVector, emplace_back_from_own_element) {
+    s21::stable_vector<std::string> v;
+    v.emplace_back("first");
+    while (v.size() != v.capacity()) {
+        v.emplace_back("filler");
+    }
+    // A new block is added, the referenced element stays in place
+    v.emplace_back(v.front());
+    ASSERT_EQ(v.back(), "first");
+
+    s21::stable_vector<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(7));
+    ASSERT_EQ(*owners.emplace_back(new int(8)), 8);
+    ASSERT_EQ(*owners[0], 7);
+}
+
+TEST(StableVector, clear_keeps_blocks) {
+    s21::stable_vector<std::string> v{"a", "b", "c"};
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(std::to_string(i));
+    }
+    std::size_t capacity = v.capacity();
+    const std::string *slot = &v[50];
+    v.clear();
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(v.capacity(), capacity);
+
+    for (int i = 0; i < 100; ++i) {
+        v.push_back("again");
+    }
+    ASSERT_EQ(&v[50], slot);
+    ASSERT_EQ(v.capacity(), capacity);
+
+    v.resize(0);
+    v.push_back("x");
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), s21::stable_vector<std::string>::kFirstBlockSize);
+    v.clear();
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), 0U);
+}
+
+TEST(StableVector, copy_move_and_iterators) {
+    s21::stable_vector<int> v(40);
+    ASSERT_EQ(v.size(), 40U);
+    ASSERT_EQ(v[39], 0);
+    std::iota(v.begin(), v.end(), 1);
+
+    s21::stable_vector<int> copy(v);
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), copy.begin(), copy.end()));
+    ASSERT_NE(&copy[0], &v[0]);
+
+    const int *address = &v[20];
+    s21::stable_vector<int> moved(std::move(v));
+    ASSERT_EQ(&moved[20], address);
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(v.capacity(), 0U);
+
+    v = moved;
+    ASSERT_EQ(v.size(), 40U);
+    moved = std::move(copy);
+    ASSERT_EQ(moved.back(), 40);
+    v.swap(moved);
+    ASSERT_EQ(v[0], 1);
+
+    auto it = v.end();
+    --it;
+    ASSERT_EQ(*it, 40);
+    ASSERT_EQ(it - v.begin(), 39);
+    ASSERT_EQ(v.begin()[5], 6);
+    s21::stable_vector<int>::const_iterator cit = v.begin();
+    ASSERT_TRUE(cit < it);
+    std::reverse(v.begin(), v.end());
+    ASSERT_EQ(v.front(), 40);
+    ASSERT_EQ(v.back(), 1);
+    ASSERT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+}
+
+TEST(StableVector, throwing_constructor_releases_elements) {
+    auto shared = std::make_shared<int>(5);
+    Fragile::copies_left = 1000;
+    s21::stable_vector<Fragile> items;
+    for (int i = 0; i < 100; ++i) {
+        items.emplace_back(shared);
+    }
+    ASSERT_EQ(shared.use_count(), 101);
+
+    // Fails in the third block
+    Fragile::copies_left = 60;
+    ASSERT_THROW(s21::stable_vector<Fragile> copy(items), std::runtime_error);
+    ASSERT_EQ(shared.use_count(), 101);
+
+    Fragile::copies_left = 1000;
+    s21::stable_vector<Fragile> copy(items);
+    ASSERT_EQ(shared.use_count(), 201);
+}
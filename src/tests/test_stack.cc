@@ -1,4 +1,6 @@
+#include <iterator>
 #include <stack>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -525,3 +527,50 @@ TEST(Stack, size) {
     ASSERT_EQ(s0.size(), 1);
     ASSERT_FALSE(s0.empty());
 }
+
+TEST(Stack, emplace_forwards_to_the_container) {
+    s21::stack<std::string, s21::list<std::string>> s;
+    std::string long_string(100, 'x');
+    const char *buffer = long_string.data();
+    s.push(std::move(long_string));
+    ASSERT_EQ(s.emplace(3, 'a'), "aaa");
+    s.emplace_front(std::string(200, 'y'), std::string("z"));
+    ASSERT_EQ(s.size(), 4U);
+    ASSERT_EQ(s.top(), "z");
+    s.pop();
+    s.pop();
+    s.pop();
+    // Moved all the way into the list node, not copied
+    ASSERT_EQ(s.top().data(), buffer);
+
+    s21::stack<std::string> d;
+    d.emplace(2, 'q');
+    ASSERT_EQ(d.top(), "qq");
+}
+
+template <typename Container>
+void CheckStackBatches() {
+    s21::stack<int, Container> s;
+    std::vector<int> input{1, 2, 3, 4, 5, 6, 7};
+    s.push_range(input.begin(), input.end());
+    ASSERT_EQ(s.size(), 7U);
+    ASSERT_EQ(s.top(), 7);
+
+    std::vector<int> out;
+    s.pop_n(std::back_inserter(out), 3);
+    ASSERT_EQ(out, (std::vector<int>{7, 6, 5}));
+    ASSERT_EQ(s.top(), 4);
+
+    std::vector<int> rest;
+    ASSERT_EQ(s.drain([&rest](int &&value) { rest.push_back(value); }), 4U);
+    ASSERT_EQ(rest, (std::vector<int>{4, 3, 2, 1}));
+    ASSERT_TRUE(s.empty());
+    s.pop_n(std::back_inserter(out), 5);
+    ASSERT_EQ(out.size(), 3U);
+}
+
+TEST(Stack, push_range_pop_n_drain) {
+    CheckStackBatches<s21::deque<int>>();
+    CheckStackBatches<s21::list<int>>();
+    CheckStackBatches<s21::vector<int>>();
+}
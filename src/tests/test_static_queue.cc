@@ -0,0 +1,332 @@
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// No default constructor; counts the live objects
+struct Counted {
+    static int live;
+
+    explicit Counted(int value) : value(value) {
+        ++live;
+    }
+    Counted(const Counted &other) : value(other.value) {
+        ++live;
+    }
+    Counted &operator=(const Counted &) = default;
+    ~Counted() {
+        --live;
+    }
+
+    int value;
+};
+
+int Counted::live = 0;
+
+}  // namespace
+
+TEST(StaticQueueTest, initializer_list_constructor) {
+    s21::static_queue<int, 5> q{1, 2, 3};
+    ASSERT_EQ(q.size(), 3);
+    ASSERT_EQ(q.front(), 1);
+    ASSERT_EQ(q.back(), 3);
+    ASSERT_EQ(q.capacity(), 5);
+    ASSERT_FALSE(q.full());
+    using Queue = s21::static_queue<int, 2>;
+    ASSERT_THROW(Queue({1, 2, 3}), std::length_error);
+}
+
+TEST(StaticQueueTest, wraps_around) {
+    // 5 is rounded up to 8 slots: push/pop many times to go round the ring
+    s21::static_queue<int, 5> q;
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 20; ++round) {
+        while (q.try_push(next_in)) {
+            ++next_in;
+        }
+        ASSERT_TRUE(q.full());
+        ASSERT_EQ(q.size(), 5);
+        ASSERT_EQ(q.back(), next_in - 1);
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_EQ(q.front(), next_out++);
+            q.pop();
+        }
+    }
+}
+
+TEST(StaticQueueTest, push_pop_full_and_empty) {
+    s21::static_queue<int, 2> q;
+    int value = -1;
+    ASSERT_FALSE(q.try_pop(value));
+    ASSERT_EQ(value, -1);
+    q.push(1);
+    q.push(2);
+    ASSERT_FALSE(q.try_push(3));
+    ASSERT_THROW(q.push(3), std::length_error);
+    ASSERT_TRUE(q.try_pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_EQ(q.size(), 1);
+}
+
+TEST(StaticQueueTest, moves_and_releases_elements) {
+    s21::static_queue<std::string, 4> q;
+    std::string long_string(100, 'x');
+    q.push(std::move(long_string));
+    q.emplace_back("a", "b");
+    ASSERT_EQ(q.size(), 3);
+    ASSERT_EQ(q.back(), "b");
+    std::string out;
+    ASSERT_TRUE(q.try_pop(out));
+    ASSERT_EQ(out, std::string(100, 'x'));
+    ASSERT_EQ(q.front(), "a");
+}
+
+TEST(StaticQueueTest, copy_and_swap) {
+    s21::static_queue<int, 3> q1{1, 2, 3};
+    q1.pop();
+    q1.push(4);
+    s21::static_queue<int, 3> q2(q1);
+    ASSERT_EQ(q2.front(), 2);
+    ASSERT_EQ(q2.back(), 4);
+    s21::static_queue<int, 3> q3{7};
+    q3.swap(q1);
+    ASSERT_EQ(q1.size(), 1);
+    ASSERT_EQ(q1.front(), 7);
+    ASSERT_EQ(q3.size(), 3);
+    ASSERT_EQ(q3.front(), 2);
+}
+
+TEST(StaticQueueTest, swaps_in_for_queue) {
+    s21::queue<int> dynamic;
+    s21::static_queue<int, 16> fixed;
+    for (int i = 0; i < 10; ++i) {
+        dynamic.push(i);
+        fixed.push(i);
+    }
+    while (!dynamic.empty()) {
+        ASSERT_EQ(dynamic.front(), fixed.front());
+        ASSERT_EQ(dynamic.back(), fixed.back());
+        dynamic.pop();
+        fixed.pop();
+    }
+    ASSERT_TRUE(fixed.empty());
+}
+
+TEST(StaticQueueTest, holds_only_live_elements) {
+    {
+        s21::static_queue<Counted, 3> q;
+        ASSERT_EQ(Counted::live, 0);
+        q.push(Counted(1));
+        q.push(Counted(2));
+        q.push(Counted(3));
+        q.pop();
+        q.push(Counted(4));
+        ASSERT_EQ(Counted::live, 3);
+        q.pop();
+        ASSERT_EQ(Counted::live, 2);
+
+        // Wrapped ring of 2 against 1 element, both ways
+        s21::static_queue<Counted, 3> other;
+        other.push(Counted(9));
+        q.swap(other);
+        ASSERT_EQ(q.size(), 1U);
+        ASSERT_EQ(q.front().value, 9);
+        ASSERT_EQ(other.size(), 2U);
+        ASSERT_EQ(other.front().value, 3);
+        ASSERT_EQ(other.back().value, 4);
+        ASSERT_EQ(Counted::live, 3);
+        other.swap(q);
+        ASSERT_EQ(q.front().value, 3);
+        ASSERT_EQ(q.back().value, 4);
+        ASSERT_EQ(other.front().value, 9);
+
+        s21::static_queue<Counted, 3> copy(q);
+        ASSERT_EQ(Counted::live, 5);
+        s21::static_queue<Counted, 3> moved(std::move(copy));
+        ASSERT_TRUE(copy.empty());
+        ASSERT_EQ(moved.back().value, 4);
+        ASSERT_EQ(Counted::live, 5);
+        other = moved;
+        ASSERT_EQ(other.size(), 2U);
+        ASSERT_EQ(Counted::live, 6);
+        moved = std::move(other);
+        ASSERT_TRUE(other.empty());
+        ASSERT_EQ(Counted::live, 4);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(StaticQueueTest, emplace_constructs_in_place) {
+    s21::static_queue<Counted, 2> q;
+    ASSERT_EQ(q.emplace(5).value, 5);
+    Counted &second = q.emplace(6);
+    ASSERT_EQ(&second, &q.back());
+    ASSERT_EQ(Counted::live, 2);
+    ASSERT_THROW(q.emplace(7), std::length_error);
+    ASSERT_EQ(Counted::live, 2);
+    q.pop();
+    ASSERT_EQ(q.emplace(7).value, 7);
+    ASSERT_EQ(q.front().value, 6);
+
+    s21::static_queue<std::string, 2> strings;
+    strings.emplace(3, 'a');
+    ASSERT_EQ(strings.front(), "aaa");
+}
+
+TEST(StaticQueueTest, push_range_pop_n_drain) {
+    s21::static_queue<int, 6> q{0, 0};
+    q.pop();
+    q.pop();
+    std::vector<int> input{1, 2, 3, 4, 5};
+    // The batch wraps around the end of the ring
+    q.push_range(input.begin(), input.end());
+    ASSERT_THROW(q.push_range(input.begin(), input.begin() + 2),
+                 std::length_error);
+    ASSERT_EQ(q.size(), 5U);
+    ASSERT_EQ(q.back(), 5);
+
+    std::vector<int> out;
+    q.pop_n(std::back_inserter(out), 2);
+    ASSERT_EQ(out, (std::vector<int>{1, 2}));
+    ASSERT_EQ(q.front(), 3);
+    q.pop_n(std::back_inserter(out), 100);
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3, 4, 5}));
+    ASSERT_TRUE(q.empty());
+
+    // Input iterators push one by one
+    std::istringstream numbers("7 8 9");
+    q.push_range(std::istream_iterator<int>(numbers),
+                 std::istream_iterator<int>());
+    int sum = 0;
+    ASSERT_EQ(q.drain([&sum](int &&value) { sum = sum * 10 + value; }), 3U);
+    ASSERT_EQ(sum, 789);
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(StaticQueueTest, drain_keeps_unconsumed_elements_on_throw) {
+    {
+        s21::static_queue<Counted, 4> q;
+        for (int i = 1; i <= 4; ++i) {
+            q.emplace(i);
+        }
+        std::vector<int> seen;
+        auto consume = [&seen](Counted &&item) {
+            if (item.value == 3) {
+                throw std::runtime_error("stop");
+            }
+            seen.push_back(item.value);
+        };
+        ASSERT_THROW(q.drain(consume), std::runtime_error);
+        ASSERT_EQ(seen, (std::vector<int>{1, 2}));
+        ASSERT_EQ(q.size(), 2U);
+        ASSERT_EQ(q.front().value, 3);
+        ASSERT_EQ(Counted::live, 2);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(StaticStackTest, push_pop_full_and_empty) {
+    s21::static_stack<int, 3> s{1, 2};
+    ASSERT_EQ(s.top(), 2);
+    s.push(3);
+    ASSERT_TRUE(s.full());
+    ASSERT_FALSE(s.try_push(4));
+    ASSERT_THROW(s.push(4), std::length_error);
+    int value = 0;
+    ASSERT_TRUE(s.try_pop(value));
+    ASSERT_EQ(value, 3);
+    s.pop();
+    s.pop();
+    ASSERT_TRUE(s.empty());
+    ASSERT_FALSE(s.try_pop(value));
+    ASSERT_EQ(value, 3);
+}
+
+TEST(StaticStackTest, emplace_front_and_swap) {
+    s21::static_stack<std::string, 4> s1;
+    s1.emplace_front("a", "b", "c");
+    ASSERT_EQ(s1.size(), 3);
+    ASSERT_EQ(s1.top(), "c");
+    s21::static_stack<std::string, 4> s2{"z"};
+    s1.swap(s2);
+    ASSERT_EQ(s1.top(), "z");
+    ASSERT_EQ(s2.size(), 3);
+    s21::static_stack<std::string, 4> copy(s2);
+    ASSERT_EQ(copy.top(), "c");
+}
+
+TEST(StaticStackTest, holds_only_live_elements) {
+    {
+        s21::static_stack<Counted, 4> s;
+        s.push(Counted(1));
+        s.push(Counted(2));
+        s.push(Counted(3));
+        s.pop();
+        ASSERT_EQ(Counted::live, 2);
+
+        s21::static_stack<Counted, 4> other;
+        other.push(Counted(7));
+        s.swap(other);
+        ASSERT_EQ(s.size(), 1U);
+        ASSERT_EQ(s.top().value, 7);
+        ASSERT_EQ(other.size(), 2U);
+        ASSERT_EQ(other.top().value, 2);
+        ASSERT_EQ(Counted::live, 3);
+
+        s21::static_stack<Counted, 4> moved(std::move(other));
+        ASSERT_TRUE(other.empty());
+        ASSERT_EQ(moved.top().value, 2);
+        s = moved;
+        ASSERT_EQ(s.size(), 2U);
+        ASSERT_EQ(Counted::live, 4);
+        s.pop();
+        s.pop();
+        ASSERT_EQ(Counted::live, 2);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(StaticStackTest, emplace_constructs_in_place) {
+    s21::static_stack<Counted, 2> s;
+    ASSERT_EQ(s.emplace(5).value, 5);
+    Counted &second = s.emplace(6);
+    ASSERT_EQ(&second, &s.top());
+    ASSERT_EQ(Counted::live, 2);
+    ASSERT_THROW(s.emplace(7), std::length_error);
+    ASSERT_EQ(Counted::live, 2);
+    s.pop();
+    ASSERT_EQ(s.emplace(7).value, 7);
+
+    s21::static_stack<std::string, 2> strings;
+    strings.emplace(3, 'a');
+    ASSERT_EQ(strings.top(), "aaa");
+}
+
+TEST(StaticStackTest, push_range_pop_n_drain) {
+    s21::static_stack<std::string, 5> s{"a"};
+    std::vector<std::string> input{"b", "c", "d"};
+    s.push_range(input.begin(), input.end());
+    ASSERT_THROW(s.push_range(input.begin(), input.end()), std::length_error);
+    ASSERT_EQ(s.size(), 4U);
+    ASSERT_EQ(s.top(), "d");
+
+    std::vector<std::string> out;
+    s.pop_n(std::back_inserter(out), 2);
+    ASSERT_EQ(out, (std::vector<std::string>{"d", "c"}));
+    ASSERT_EQ(s.top(), "b");
+
+    std::string rest;
+    ASSERT_EQ(s.drain([&rest](std::string &&value) { rest += value; }), 2U);
+    ASSERT_EQ(rest, "ba");
+    ASSERT_TRUE(s.empty());
+    s.pop_n(std::back_inserter(out), 5);
+    ASSERT_EQ(out.size(), 2U);
+}
@@ -0,0 +1,153 @@
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_unrolled_list.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+template <typename List>
+std::vector<typename List::value_type> ToVector(const List &l) {
+    return std::vector<typename List::value_type>(l.begin(), l.end());
+}
+
+// Перенос бросает исключение, когда счетчик доходит до нуля
+struct Fragile {
+    static inline int moves_left = 1000;
+
+    explicit Fragile(int value) : value(value) {
+    }
+    Fragile(const Fragile &) = default;
+    Fragile(Fragile &&other) : value(other.value) {
+        if (moves_left-- == 0) {
+            throw std::runtime_error("Fragile move");
+        }
+    }
+    Fragile &operator=(const Fragile &) = default;
+    Fragile &operator=(Fragile &&) = default;
+
+    bool operator==(const Fragile &other) const {
+        return value == other.value;
+    }
+
+    int value;
+};
+
+}  // namespace
+
+TEST(UnrolledList, basic_operations) {
+    s21::unrolled_list<int> l{1, 2, 3};
+    ASSERT_EQ(l.size(), 3U);
+    ASSERT_EQ(l.front(), 1);
+    ASSERT_EQ(l.back(), 3);
+
+    l.push_front(0);
+    l.push_back(4);
+    l.emplace_back(5);
+    l.pop_front();
+    ASSERT_EQ(ToVector(l), (std::vector<int>{1, 2, 3, 4, 5}));
+
+    auto it = l.insert(++l.begin(), 10);
+    ASSERT_EQ(*it, 10);
+    it = l.erase(it);
+    ASSERT_EQ(*it, 2);
+    l.pop_back();
+    ASSERT_EQ(ToVector(l), (std::vector<int>{1, 2, 3, 4}));
+
+    std::vector<int> backward;
+    for (auto rit = l.end(); rit != l.begin();) {
+        backward.push_back(*--rit);
+    }
+    ASSERT_EQ(backward, (std::vector<int>{4, 3, 2, 1}));
+
+    s21::unrolled_list<int> copy(l);
+    s21::unrolled_list<int> moved(std::move(l));
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(ToVector(copy), ToVector(moved));
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(copy.begin(), copy.end());
+}
+
+TEST(UnrolledList, matches_std_list_on_random_operations) {
+    // Маленькие блоки (по 4 строки), чтобы чаще делить и сливать блоки
+    using List = s21::unrolled_list<std::string, 4 * sizeof(std::string) + 24>;
+    ASSERT_EQ(List::chunk_capacity, 4U);
+
+    std::mt19937 generator(11);
+    List l;
+    std::list<std::string> expected;
+    for (int step = 0; step < 20000; ++step) {
+        std::size_t position = expected.empty() ? 0 : generator() %
+                                                          (expected.size() + 1);
+        auto it = l.begin();
+        auto expected_it = expected.begin();
+        std::advance(it, position);
+        std::advance(expected_it, position);
+
+        if (generator() % 5 < 3 || expected_it == expected.end()) {
+            std::string value = std::to_string(step);
+            ASSERT_EQ(*l.insert(it, value), value);
+            expected.insert(expected_it, value);
+        } else {
+            auto next = l.erase(it);
+            auto expected_next = expected.erase(expected_it);
+            if (expected_next == expected.end()) {
+                ASSERT_EQ(next, l.end());
+            } else {
+                ASSERT_EQ(*next, *expected_next);
+            }
+        }
+        ASSERT_EQ(l.size(), expected.size());
+    }
+    ASSERT_EQ(ToVector(l),
+              std::vector<std::string>(expected.begin(), expected.end()));
+
+    while (!expected.empty()) {
+        l.pop_front();
+        expected.pop_front();
+        if (!expected.empty()) {
+            ASSERT_EQ(l.front(), expected.front());
+        }
+    }
+    ASSERT_TRUE(l.empty());
+}
+
+TEST(UnrolledList, insert_own_element_into_full_chunk) {
+    s21::unrolled_list<std::string, 1> l;
+    ASSERT_EQ(l.chunk_capacity, 2U);
+    l.push_back("a");
+    l.push_back("b");
+    // Блок заполнен и будет разделен, а аргумент лежит в этом же блоке
+    l.insert(l.begin(), l.back());
+    ASSERT_EQ(ToVector(l), (std::vector<std::string>{"b", "a", "b"}));
+}
+
+TEST(UnrolledList, throwing_move_during_split) {
+    using List = s21::unrolled_list<Fragile, 128>;
+    static_assert(!noexcept(std::declval<List &>().pop_back()));
+    static_assert(noexcept(std::declval<s21::unrolled_list<int> &>().erase(
+        std::declval<s21::unrolled_list<int>::const_iterator>())));
+
+    List l;
+    for (size_t i = 0; i < List::chunk_capacity; ++i) {
+        l.emplace_back(static_cast<int>(i));
+    }
+    std::vector<Fragile> before = ToVector(l);
+
+    // Одно перемещение - в значение, два - в новый блок, третье бросает
+    Fragile::moves_left = 3;
+    ASSERT_THROW(l.insert(std::next(l.begin()), Fragile(-1)),
+                 std::runtime_error);
+    Fragile::moves_left = 1000;
+    ASSERT_EQ(l.size(), before.size());
+    ASSERT_EQ(ToVector(l), before);
+
+    l.insert(std::next(l.begin()), Fragile(-1));
+    ASSERT_EQ(l.size(), before.size() + 1);
+    ASSERT_EQ(std::next(l.begin())->value, -1);
+}
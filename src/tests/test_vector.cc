@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -568,3 +570,56 @@ TEST(vector, reserve_exception) {
     s21::vector<int> vzero;
     ASSERT_ANY_THROW(vzero.reserve(vzero.max_size() + 1));
 }
+
+namespace {
+
+bool IsAligned(const void *pointer, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(vector, over_aligned_storage) {
+    s21::vector<float, 64> floats;
+    for (int i = 0; i < 100; ++i) {
+        floats.push_back(static_cast<float>(i));
+        ASSERT_TRUE(IsAligned(floats.data(), 64));
+    }
+    floats.reserve(1000);
+    ASSERT_TRUE(IsAligned(floats.data(), 64));
+    floats.shrink_to_fit();
+    ASSERT_TRUE(IsAligned(floats.data(), 64));
+
+    s21::vector<float, 64> copy(floats);
+    ASSERT_TRUE(IsAligned(copy.data(), 64));
+    ASSERT_EQ(copy.size(), 100U);
+    ASSERT_EQ(copy[99], 99.0F);
+
+    s21::vector<float, 64> assigned{1.0F};
+    assigned = copy;
+    ASSERT_TRUE(IsAligned(assigned.data(), 64));
+    ASSERT_EQ(assigned[50], 50.0F);
+
+    s21::vector<float, 64> moved(std::move(copy));
+    ASSERT_TRUE(IsAligned(moved.data(), 64));
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.size(), 100U);
+}
+
+TEST(vector, over_aligned_non_trivial) {
+    s21::vector<std::string, 128> words{"aligned", "strings"};
+    ASSERT_TRUE(IsAligned(words.data(), 128));
+    for (int i = 0; i < 50; ++i) {
+        words.push_back(std::string(40, 'x'));
+    }
+    ASSERT_TRUE(IsAligned(words.data(), 128));
+    words.insert(words.begin(), "first");
+    ASSERT_EQ(words.front(), "first");
+    ASSERT_EQ(words[1], "aligned");
+    ASSERT_EQ(words.size(), 53U);
+
+    s21::vector<std::string, 128> copy = words;
+    ASSERT_EQ(copy.back(), std::string(40, 'x'));
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+}